@@ -0,0 +1,847 @@
+// Microbenchmarks of anton_math.
+//
+// Measures the throughput and the latency of the public operations of the library.
+// Throughput is the time per operation when count independent operations are
+// performed over arrays of arguments and results. It is measured for a working set
+// that fits in the L1 cache (cache) and for one that does not fit in any cache
+// (stream). Latency is the time per operation when each operation depends on the
+// result of the previous one. The result is fed back into the argument by a copy
+// for most operations and by a single arithmetic operation where a copy would
+// diverge or degenerate. The latency includes that operation.
+//
+// Every measurement is repeated until --min-time seconds pass and at least 5
+// samples are taken. The minimum and the median time per operation over the samples
+// are reported.
+//
+// The array functions are measured under every instruction set supported by the
+// processor. The remaining operations use the instruction set selected at startup.
+//
+// Usage: anton_math_bench [--filter <substring>] [--min-time <seconds>] [--threads <n>] [--json <path>]
+//   --filter <text>     run only the benchmarks whose name contains text.
+//   --min-time <s>      the minimum duration of each measurement. Defaults to 0.02.
+//   --threads <n>       run the array functions on a Thread_Pool of n threads
+//                       including the calling one. Defaults to 1, i.e. no executor.
+//   --json <path>       write the results to path as JSON, one result per line, so
+//                       that results of two versions may be compared with diff.
+
+#include <anton/math/affine3.hpp>
+#include <anton/math/batch.hpp>
+#include <anton/math/blend.hpp>
+#include <anton/math/clip.hpp>
+#include <anton/math/dispatch.hpp>
+#include <anton/math/dual_quat.hpp>
+#include <anton/math/executor.hpp>
+#include <anton/math/fast.hpp>
+#include <anton/math/hierarchy.hpp>
+#include <anton/math/mat2.hpp>
+#include <anton/math/mat3.hpp>
+#include <anton/math/mat4.hpp>
+#include <anton/math/math.hpp>
+#include <anton/math/quat.hpp>
+#include <anton/math/quat_array.hpp>
+#include <anton/math/soa.hpp>
+#include <anton/math/track.hpp>
+#include <anton/math/transform.hpp>
+#include <anton/math/vec2.hpp>
+#include <anton/math/vec3.hpp>
+#include <anton/math/vec3_array.hpp>
+#include <anton/math/vec4.hpp>
+#include <anton/math/vec4_array.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+using namespace anton;
+namespace math = anton::math;
+
+namespace {
+    struct Options {
+        char const* filter = nullptr;
+        char const* json = nullptr;
+        f64 min_time = 0.02;
+        i64 threads = 1;
+    };
+
+    Options options;
+
+    enum struct Mode { throughput, latency };
+
+    struct Result {
+        std::string name;
+        Mode mode;
+        // The number of bytes of the arguments and the results, 0 for latency.
+        i64 working_set;
+        f64 min_ns;
+        f64 median_ns;
+    };
+
+    std::vector<Result> results;
+
+    // The working sets of the throughput measurements.
+    constexpr i64 cache_working_set = 16 * 1024;
+    constexpr i64 stream_working_set = 64 * 1024 * 1024;
+    // The number of operations of a latency measurement.
+    constexpr i64 chain_length = 1 << 14;
+
+    // Forces the compiler to assume that value is read and that any memory might be
+    // read or written.
+    template<typename T>
+    void do_not_optimize(T const& value) {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r,m"(value) : "memory");
+#else
+        static char volatile sink;
+        sink = *reinterpret_cast<char const volatile*>(&value);
+#endif
+    }
+
+    // splitmix64
+    struct Random {
+        u64 state;
+
+        u64 next() {
+            u64 z = (state += 0x9E3779B97F4A7C15ull);
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+            return z ^ (z >> 31);
+        }
+
+        // Uniform in [lo, hi].
+        f32 uniform(f32 const lo, f32 const hi) {
+            return lo + (hi - lo) * static_cast<f32>(static_cast<f64>(next() >> 11) * 0x1.0p-53);
+        }
+    };
+
+    Random random{1};
+
+    math::Vec2 random_vec2() {
+        return {random.uniform(-1.0f, 1.0f), random.uniform(-1.0f, 1.0f)};
+    }
+
+    math::Vec3 random_vec3() {
+        return {random.uniform(-1.0f, 1.0f), random.uniform(-1.0f, 1.0f), random.uniform(-1.0f, 1.0f)};
+    }
+
+    math::Vec4 random_vec4() {
+        return {random.uniform(-1.0f, 1.0f), random.uniform(-1.0f, 1.0f), random.uniform(-1.0f, 1.0f), random.uniform(-1.0f, 1.0f)};
+    }
+
+    math::Vec3 random_unit_vec3() {
+        return math::normalize(random_vec3());
+    }
+
+    math::Quat random_quat() {
+        math::Vec4 const v = random_vec4();
+        return math::normalize(math::Quat{v.x, v.y, v.z, v.w});
+    }
+
+    math::TRS random_trs() {
+        return {random_quat(), random_vec3() * 10.0f, {random.uniform(0.5f, 2.0f), random.uniform(0.5f, 2.0f), random.uniform(0.5f, 2.0f)}};
+    }
+
+    // An affine transformation with a non-uniform scale.
+    math::Mat4 random_mat4() {
+        return math::compose(random_trs());
+    }
+
+    // A rotation. Multiplying by it preserves the magnitude of the other operand.
+    math::Mat4 random_rotation() {
+        return math::rotate(random_quat());
+    }
+
+    math::Mat3 random_mat3() {
+        math::Mat4 const m = random_mat4();
+        return {math::Vec3(m[0]), math::Vec3(m[1]), math::Vec3(m[2])};
+    }
+
+    // A rotation scaled by less than 1, hence the chains of determinants converge.
+    math::Mat2 random_mat2() {
+        f32 const angle = random.uniform(-3.0f, 3.0f);
+        f32 const s = random.uniform(0.5f, 0.9f);
+        return {{s * math::cos(angle), s * math::sin(angle)}, {-s * math::sin(angle), s * math::cos(angle)}};
+    }
+
+    template<typename T, typename Generator>
+    std::vector<T> generate(i64 const count, Generator&& generator) {
+        std::vector<T> v;
+        v.reserve(static_cast<std::size_t>(count));
+        for(i64 i = 0; i < count; ++i) {
+            v.push_back(generator());
+        }
+        return v;
+    }
+
+    bool is_selected(std::string const& name) {
+        return options.filter == nullptr || name.find(options.filter) != std::string::npos;
+    }
+
+    // Runs run, which performs operations operations, until options.min_time passes
+    // and at least 5 samples are taken, and records the time per operation.
+    template<typename F>
+    void measure(std::string const& name, Mode const mode, i64 const working_set, i64 const operations, F&& run) {
+        using Clock = std::chrono::steady_clock;
+        // Warm up the caches and the branch predictors.
+        run();
+        std::vector<f64> samples;
+        Clock::time_point const start = Clock::now();
+        while(samples.size() < 5 || (samples.size() < 100000 && std::chrono::duration<f64>(Clock::now() - start).count() < options.min_time)) {
+            Clock::time_point const begin = Clock::now();
+            run();
+            Clock::time_point const end = Clock::now();
+            samples.push_back(std::chrono::duration<f64, std::nano>(end - begin).count() / static_cast<f64>(operations));
+        }
+
+        std::sort(samples.begin(), samples.end());
+        results.push_back({name, mode, working_set, samples.front(), samples[samples.size() / 2]});
+    }
+
+    // Chain that replaces the argument with the result.
+    auto const replace = [](auto& argument, auto const& result) {
+        argument = result;
+    };
+
+    // bench
+    // Measures op over arrays of arguments generated by generator. When chain is not
+    // nullptr, additionally measures the latency of op. chain(argument, result)
+    // updates the argument in place to become the argument of the next operation.
+    // Updating in place instead of returning a new argument avoids the stores of
+    // whole arguments that would stall the following loads.
+    //
+    template<typename Argument, typename Generator, typename Op, typename Chain = std::nullptr_t>
+    void bench(std::string const& name, Generator&& generator, Op&& op, Chain&& chain = nullptr) {
+        if(!is_selected(name)) {
+            return;
+        }
+
+        using Return = decltype(op(std::declval<Argument const&>()));
+        i64 const element_size = sizeof(Argument) + sizeof(Return);
+        for(i64 const working_set: {cache_working_set, stream_working_set}) {
+            i64 const count = std::max<i64>(1, working_set / element_size);
+            std::vector<Argument> const arguments = generate<Argument>(count, generator);
+            std::vector<Return> out(static_cast<std::size_t>(count));
+            measure(name, Mode::throughput, count * element_size, count, [&] {
+                Argument const* const a = arguments.data();
+                Return* const r = out.data();
+                for(i64 i = 0; i < count; ++i) {
+                    r[i] = op(a[i]);
+                }
+                do_not_optimize(r);
+            });
+        }
+
+        if constexpr(!std::is_same_v<std::decay_t<Chain>, std::nullptr_t>) {
+            Argument argument = generator();
+            measure(name, Mode::latency, 0, chain_length, [&] {
+                // A local copy lets the compiler keep the chain in registers.
+                Argument a = argument;
+                for(i64 i = 0; i < chain_length; ++i) {
+                    chain(a, op(a));
+                }
+                do_not_optimize(a);
+                argument = a;
+            });
+        }
+    }
+
+    // bench_array
+    // Measures an array function. setup(count) allocates the arrays for count
+    // elements and returns a function that processes them. element_size is the
+    // number of bytes read and written per element.
+    //
+    template<typename Setup>
+    void bench_array(std::string const& name, i64 const element_size, Setup&& setup) {
+        if(!is_selected(name)) {
+            return;
+        }
+
+        for(i64 const working_set: {cache_working_set, stream_working_set}) {
+            i64 const count = std::max<i64>(1, working_set / element_size);
+            auto run = setup(count);
+            measure(name, Mode::throughput, count * element_size, count, run);
+        }
+    }
+
+    template<typename A, typename B>
+    struct Pair {
+        A a;
+        B b;
+    };
+
+    //
+    // Vectors, matrices, quaternions and transforms
+    //
+
+    void bench_types() {
+        using P2 = Pair<math::Vec2, math::Vec2>;
+        using P3 = Pair<math::Vec3, math::Vec3>;
+        using P4 = Pair<math::Vec4, math::Vec4>;
+        auto p2 = [] { return P2{random_vec2(), random_vec2()}; };
+        auto p3 = [] { return P3{random_vec3(), random_unit_vec3()}; };
+        auto p4 = [] { return P4{random_vec4(), random_vec4()}; };
+
+        bench<P2>("Vec2 + Vec2", p2, [](P2 const& p) { return p.a + p.b; }, [](P2& p, math::Vec2 const& r) { p.a = r * 0.5f; });
+        bench<P2>("dot(Vec2, Vec2)", p2, [](P2 const& p) { return math::dot(p.a, p.b); },
+                  [](P2& p, f32 r) { p.a.x = r; });
+        bench<math::Vec2>("normalize(Vec2)", random_vec2, [](math::Vec2 const& v) { return math::normalize(v); },
+                          replace);
+
+        bench<P3>("Vec3 + Vec3", p3, [](P3 const& p) { return p.a + p.b; }, [](P3& p, math::Vec3 const& r) { p.a = r * 0.5f; });
+        // The components of b are 1 or -1, hence the chain neither overflows nor
+        // underflows.
+        bench<P3>("Vec3 * Vec3", [] { return P3{random_vec3(), math::Vec3{random.uniform(-1.0f, 1.0f) < 0.0f ? -1.0f : 1.0f, 1.0f, -1.0f}}; },
+                  [](P3 const& p) { return p.a * p.b; }, [](P3& p, math::Vec3 const& r) { p.a = r; });
+        bench<P3>("dot(Vec3, Vec3)", p3, [](P3 const& p) { return math::dot(p.a, p.b); },
+                  [](P3& p, f32 r) { p.a.x = r; });
+        // The result is perpendicular to the unit vector b, hence its length is
+        // preserved by the following operations.
+        bench<P3>("cross(Vec3, Vec3)", p3, [](P3 const& p) { return math::cross(p.a, p.b); }, [](P3& p, math::Vec3 const& r) { p.a = r; });
+        bench<math::Vec3>("length(Vec3)", random_vec3, [](math::Vec3 const& v) { return math::length(v); },
+                          [](math::Vec3& v, f32 r) { v.x = r; });
+        bench<math::Vec3>("normalize(Vec3)", random_vec3, [](math::Vec3 const& v) { return math::normalize(v); },
+                          replace);
+        bench<math::Vec3>("fast::normalize(Vec3)", random_vec3, [](math::Vec3 const& v) { return math::fast::normalize(v); },
+                          replace);
+        bench<P3>("slerp(Vec3, Vec3)", [] { return P3{random_unit_vec3(), random_unit_vec3()}; },
+                  [](P3 const& p) { return math::slerp(p.a, p.b, 0.25f); }, [](P3& p, math::Vec3 const& r) { p.a = r; });
+
+        bench<P4>("Vec4 + Vec4", p4, [](P4 const& p) { return p.a + p.b; }, [](P4& p, math::Vec4 const& r) { p.a = r * 0.5f; });
+        bench<P4>("dot(Vec4, Vec4)", p4, [](P4 const& p) { return math::dot(p.a, p.b); },
+                  [](P4& p, f32 r) { p.a.x = r; });
+        bench<math::Vec4>("normalize(Vec4)", random_vec4, [](math::Vec4 const& v) { return math::normalize(v); },
+                          replace);
+
+        using PM2 = Pair<math::Mat2, math::Mat2>;
+        using PM3 = Pair<math::Mat3, math::Mat3>;
+        using PM4 = Pair<math::Mat4, math::Mat4>;
+        using PM4V = Pair<math::Mat4, math::Vec4>;
+        bench<PM2>("Mat2 * Mat2", [] { return PM2{random_mat2(), random_mat2()}; }, [](PM2 const& p) { return p.a * p.b; });
+        bench<math::Mat2>("inverse(Mat2)", random_mat2, [](math::Mat2 const& m) { return math::inverse(m); }, replace);
+        bench<math::Mat2>("determinant(Mat2)", random_mat2, [](math::Mat2 const& m) { return math::determinant(m); },
+                          [](math::Mat2& m, f32 r) { m[1][1] = r; });
+        bench<PM3>("Mat3 * Mat3", [] { return PM3{random_mat3(), random_mat3()}; }, [](PM3 const& p) { return p.a * p.b; });
+        bench<math::Mat3>("inverse(Mat3)", random_mat3, [](math::Mat3 const& m) { return math::inverse(m); }, replace);
+        bench<math::Mat3>("determinant(Mat3)", random_mat3, [](math::Mat3 const& m) { return math::determinant(m); });
+        bench<math::Mat3>("transpose(Mat3)", random_mat3, [](math::Mat3 const& m) { return math::transpose(m); },
+                          replace);
+        bench<PM4>("Mat4 * Mat4", [] { return PM4{random_mat4(), random_rotation()}; }, [](PM4 const& p) { return p.a * p.b; },
+                   [](PM4& p, math::Mat4 const& r) { p.a = r; });
+        bench<PM4V>("Mat4 * Vec4", [] { return PM4V{random_rotation(), random_vec4()}; }, [](PM4V const& p) { return p.a * p.b; },
+                    [](PM4V& p, math::Vec4 const& r) { p.b = r; });
+        bench<math::Mat4>("inverse(Mat4)", random_mat4, [](math::Mat4 const& m) { return math::inverse(m); }, replace);
+        bench<math::Mat4>("inverse_affine(Mat4)", random_mat4, [](math::Mat4 const& m) { return math::inverse_affine(m); },
+                          replace);
+        bench<math::Mat4>("inverse_rigid(Mat4)", random_rotation, [](math::Mat4 const& m) { return math::inverse_rigid(m); },
+                          replace);
+        // The determinant of an affine transformation does not depend on the
+        // translation, which therefore carries the dependency.
+        bench<math::Mat4>("determinant(Mat4)", random_mat4, [](math::Mat4 const& m) { return math::determinant(m); },
+                          [](math::Mat4& m, f32 r) { m[3][0] = r; });
+        bench<math::Mat4>("transpose(Mat4)", random_mat4, [](math::Mat4 const& m) { return math::transpose(m); },
+                          replace);
+        bench<math::Mat4>("adjugate(Mat4)", random_mat4, [](math::Mat4 const& m) { return math::adjugate(m); });
+
+        using PQ = Pair<math::Quat, math::Quat>;
+        using PQV = Pair<math::Quat, math::Vec3>;
+        auto pq = [] { return PQ{random_quat(), random_quat()}; };
+        bench<PQ>("Quat * Quat", pq, [](PQ const& p) { return p.a * p.b; }, [](PQ& p, math::Quat const& r) { p.a = r; });
+        bench<PQV>("Quat * Vec3", [] { return PQV{random_quat(), random_vec3()}; }, [](PQV const& p) { return p.a * p.b; },
+                   [](PQV& p, math::Vec3 const& r) { p.b = r; });
+        bench<math::Quat>("normalize(Quat)", random_quat, [](math::Quat const& q) { return math::normalize(q); },
+                          replace);
+        bench<PQ>("slerp(Quat, Quat)", pq, [](PQ const& p) { return math::slerp(p.a, p.b, 0.25f); }, [](PQ& p, math::Quat const& r) { p.a = r; });
+        bench<PQ>("fast::slerp(Quat, Quat)", pq, [](PQ const& p) { return math::fast::slerp(p.a, p.b, 0.25f); },
+                  [](PQ& p, math::Quat const& r) { p.a = r; });
+        bench<PQV>("Quat::from_axis_angle", [] { return PQV{{}, random_unit_vec3()}; },
+                   [](PQV const& p) { return math::Quat::from_axis_angle(p.b, 0.5f); });
+        bench<math::Quat>("to_axis_angle(Quat)", random_quat, [](math::Quat const& q) { return math::to_axis_angle(q); });
+        bench<P3>("orient_towards(Vec3, Vec3)", [] { return P3{random_unit_vec3(), random_unit_vec3()}; },
+                  [](P3 const& p) { return math::orient_towards(p.a, p.b); });
+        bench<P3>("fast::orient_towards(Vec3, Vec3)", [] { return P3{random_unit_vec3(), random_unit_vec3()}; },
+                  [](P3 const& p) { return math::fast::orient_towards(p.a, p.b); });
+
+        bench<math::TRS>("compose(TRS)", random_trs, [](math::TRS const& trs) { return math::compose(trs); },
+                         [](math::TRS& trs, math::Mat4 const& r) { trs.translation.x = r[3][0]; });
+        // The translation passes through decompose and carries the dependency.
+        bench<math::Mat4>("decompose(Mat4)", random_mat4, [](math::Mat4 const& m) { return math::decompose(m); },
+                          [](math::Mat4& m, math::TRS const& r) { m[3][0] = r.translation.x; });
+        bench<math::Quat>("rotate(Quat)", random_quat, [](math::Quat const& q) { return math::rotate(q); });
+        bench<f32>("rotate_x(f32)", [] { return random.uniform(-3.0f, 3.0f); }, [](f32 const angle) { return math::rotate_x(angle); },
+                   [](f32& angle, math::Mat4 const& r) { angle = r[1][1]; });
+        bench<f32>("perspective_rh", [] { return random.uniform(0.5f, 2.0f); }, [](f32 const fov) { return math::perspective_rh(fov, 1.5f, 0.1f, 100.0f); });
+        bench<P3>("lookat_rh", p3, [](P3 const& p) { return math::lookat_rh(p.a, p.b, {0.0f, 1.0f, 0.0f}); });
+
+        using PA = Pair<math::Affine3, math::Affine3>;
+        using PAV = Pair<math::Affine3, math::Vec3>;
+        auto random_affine3 = [] { return math::Affine3(random_mat4()); };
+        bench<PA>("Affine3 * Affine3", [] { return PA{math::Affine3(random_mat4()), math::Affine3(random_rotation())}; },
+                  [](PA const& p) { return p.a * p.b; }, [](PA& p, math::Affine3 const& r) { p.a = r; });
+        bench<math::Affine3>("inverse(Affine3)", random_affine3, [](math::Affine3 const& m) { return math::inverse(m); },
+                             replace);
+        bench<PAV>("transform_point(Affine3, Vec3)", [] { return PAV{math::Affine3(random_rotation()), random_vec3()}; },
+                   [](PAV const& p) { return math::transform_point(p.a, p.b); }, [](PAV& p, math::Vec3 const& r) { p.b = r; });
+        bench<math::Affine3>("decompose(Affine3)", random_affine3, [](math::Affine3 const& m) { return math::decompose(m); });
+        bench<math::TRS>("compose_affine(TRS)", random_trs, [](math::TRS const& trs) { return math::compose_affine(trs); });
+    }
+
+    //
+    // Scalar functions
+    //
+
+    void bench_scalar() {
+        auto angle = [] { return random.uniform(-10.0f, 10.0f); };
+        auto unit = [] { return random.uniform(-1.0f, 1.0f); };
+        auto positive = [] { return random.uniform(0.001f, 1000.0f); };
+        auto exponent = [] { return random.uniform(-20.0f, 20.0f); };
+        // Stable fixed points of x = r * k + c keep the chains finite.
+        auto tan_chain = [](f32& x, f32 r) { x = r * 0.25f + 0.5f; };
+        auto asin_chain = [](f32& x, f32 r) { x = r * 0.5f + 0.25f; };
+        auto acos_chain = [](f32& x, f32 r) { x = r * 0.3f; };
+        auto smoothstep_chain = [](f32& x, f32 r) { x = r * 0.5f + 0.25f; };
+        auto exp_chain = [](f32& x, f32 r) { x = r - 2.0f; };
+        auto log_chain = [](f32& x, f32 r) { x = r + 3.0f; };
+
+        using P = Pair<f32, f32>;
+        bench<f32>("sqrt", positive, [](f32 x) { return math::sqrt(x); }, replace);
+        bench<f32>("inv_sqrt", positive, [](f32 x) { return math::inv_sqrt(x); }, replace);
+        bench<f32>("fast::inv_sqrt", positive, [](f32 x) { return math::fast::inv_sqrt(x); }, replace);
+        bench<f32>("cbrt", positive, [](f32 x) { return math::cbrt(x); }, replace);
+        bench<P>("pow", [] { return P{random.uniform(0.001f, 1000.0f), random.uniform(-4.0f, 4.0f)}; }, [](P const& p) { return math::pow(p.a, p.b); },
+                 [](P& p, f32 r) { p.a = r; p.b = 0.5f; });
+        bench<f32>("sin", angle, [](f32 x) { return math::sin(x); }, replace);
+        bench<f32>("fast::sin", angle, [](f32 x) { return math::fast::sin(x); }, replace);
+        bench<f32>("cos", angle, [](f32 x) { return math::cos(x); }, replace);
+        bench<f32>("fast::cos", angle, [](f32 x) { return math::fast::cos(x); }, replace);
+        bench<f32>("sincos", angle, [](f32 x) { return math::sincos(x); }, [](f32& x, math::Sin_Cos r) { x = r.sin + r.cos; });
+        bench<f32>("tan", angle, [](f32 x) { return math::tan(x); }, tan_chain);
+        bench<f32>("asin", unit, [](f32 x) { return math::asin(x); }, asin_chain);
+        bench<f32>("fast::asin", unit, [](f32 x) { return math::fast::asin(x); }, asin_chain);
+        bench<f32>("acos", unit, [](f32 x) { return math::acos(x); }, acos_chain);
+        bench<f32>("fast::acos", unit, [](f32 x) { return math::fast::acos(x); }, acos_chain);
+        bench<f32>("atan", angle, [](f32 x) { return math::atan(x); }, replace);
+        bench<f32>("fast::atan", angle, [](f32 x) { return math::fast::atan(x); }, replace);
+        bench<P>("atan2", [] { return P{random.uniform(-10.0f, 10.0f), random.uniform(-10.0f, 10.0f)}; }, [](P const& p) { return math::atan2(p.a, p.b); },
+                 [](P& p, f32 const& r) { p.a = r; });
+        bench<P>("fast::atan2", [] { return P{random.uniform(-10.0f, 10.0f), random.uniform(-10.0f, 10.0f)}; },
+                 [](P const& p) { return math::fast::atan2(p.a, p.b); }, [](P& p, f32 const& r) { p.a = r; });
+        bench<f32>("exp", exponent, [](f32 x) { return math::exp(x); }, exp_chain);
+        bench<f32>("fast::exp", exponent, [](f32 x) { return math::fast::exp(x); }, exp_chain);
+        bench<f32>("fast::exp2", exponent, [](f32 x) { return math::fast::exp2(x); }, exp_chain);
+        bench<f32>("log", positive, [](f32 x) { return math::log(x); }, log_chain);
+        bench<f32>("fast::log", positive, [](f32 x) { return math::fast::log(x); }, log_chain);
+        bench<f32>("log2", positive, [](f32 x) { return math::log2(x); }, log_chain);
+        bench<f32>("fast::log2", positive, [](f32 x) { return math::fast::log2(x); }, log_chain);
+        bench<f32>("log10", positive, [](f32 x) { return math::log10(x); }, log_chain);
+        bench<f32>("smoothstep", unit, [](f32 x) { return math::smoothstep(0.0f, 1.0f, x); }, smoothstep_chain);
+        bench<f32>("smootherstep", unit, [](f32 x) { return math::smootherstep(0.0f, 1.0f, x); }, smoothstep_chain);
+    }
+
+    //
+    // Array functions
+    //
+
+    using Unary_Array_Function = void (*)(f32 const*, f32*, i64);
+
+    void bench_unary_array(std::string const& name, Unary_Array_Function const function, f32 const lo, f32 const hi) {
+        bench_array(name, 2 * sizeof(f32), [&](i64 const count) {
+            std::vector<f32> in(static_cast<std::size_t>(count));
+            for(f32& v: in) {
+                v = random.uniform(lo, hi);
+            }
+            return [function, count, in = std::move(in), out = std::vector<f32>(static_cast<std::size_t>(count))]() mutable {
+                function(in.data(), out.data(), count);
+                do_not_optimize(out.data());
+            };
+        });
+    }
+
+    void bench_arrays(std::string const& suffix) {
+        bench_array("multiply(Mat4[], Mat4[])" + suffix, 3 * sizeof(math::Mat4), [](i64 const count) {
+            return [count, a = generate<math::Mat4>(count, random_mat4), b = generate<math::Mat4>(count, random_mat4),
+                    out = std::vector<math::Mat4>(static_cast<std::size_t>(count))]() mutable {
+                math::multiply(a.data(), b.data(), out.data(), count);
+                do_not_optimize(out.data());
+            };
+        });
+        bench_array("multiply(Mat4, Mat4[])" + suffix, 2 * sizeof(math::Mat4), [](i64 const count) {
+            return [count, a = random_mat4(), b = generate<math::Mat4>(count, random_mat4),
+                    out = std::vector<math::Mat4>(static_cast<std::size_t>(count))]() mutable {
+                math::multiply(a, b.data(), out.data(), count);
+                do_not_optimize(out.data());
+            };
+        });
+
+        using Mat4_Array_Function = void (*)(math::Mat4 const*, math::Mat4*, i64);
+        std::pair<char const*, Mat4_Array_Function> const mat4_functions[] = {
+            {"inverse(Mat4[])", [](math::Mat4 const* in, math::Mat4* out, i64 n) { math::inverse(in, out, n); }},
+            {"inverse_affine(Mat4[])", [](math::Mat4 const* in, math::Mat4* out, i64 n) { math::inverse_affine(in, out, n); }},
+            {"inverse_rigid(Mat4[])", [](math::Mat4 const* in, math::Mat4* out, i64 n) { math::inverse_rigid(in, out, n); }},
+        };
+        for(auto const& [name, function]: mat4_functions) {
+            bench_array(name + suffix, 2 * sizeof(math::Mat4), [function = function](i64 const count) {
+                return [function, count, in = generate<math::Mat4>(count, random_mat4), out = std::vector<math::Mat4>(static_cast<std::size_t>(count))]() mutable {
+                    function(in.data(), out.data(), count);
+                    do_not_optimize(out.data());
+                };
+            });
+        }
+
+        bench_array("compose(TRS[])" + suffix, sizeof(math::TRS) + sizeof(math::Mat4), [](i64 const count) {
+            return [count, in = generate<math::TRS>(count, random_trs), out = std::vector<math::Mat4>(static_cast<std::size_t>(count))]() mutable {
+                math::compose(in.data(), out.data(), count);
+                do_not_optimize(out.data());
+            };
+        });
+        bench_array("compose(TRS[]) -> Affine3" + suffix, sizeof(math::TRS) + sizeof(math::Affine3), [](i64 const count) {
+            return [count, in = generate<math::TRS>(count, random_trs), out = std::vector<math::Affine3>(static_cast<std::size_t>(count))]() mutable {
+                math::compose(in.data(), out.data(), count);
+                do_not_optimize(out.data());
+            };
+        });
+        bench_array("decompose(Mat4[])" + suffix, sizeof(math::Mat4) + sizeof(math::TRS), [](i64 const count) {
+            return [count, in = generate<math::Mat4>(count, random_mat4), out = std::vector<math::TRS>(static_cast<std::size_t>(count))]() mutable {
+                math::decompose(in.data(), out.data(), count);
+                do_not_optimize(out.data());
+            };
+        });
+
+        // A tree with 8 children per node, numbered in level order.
+        bench_array("compute_world_transforms(TRS[])" + suffix, sizeof(math::TRS) + sizeof(math::Mat4) + sizeof(i64), [](i64 const count) {
+            std::vector<i64> parents(static_cast<std::size_t>(count));
+            for(i64 i = 0; i < count; ++i) {
+                parents[i] = i == 0 ? -1 : (i - 1) / 8;
+            }
+            return [count, hierarchy = math::Hierarchy(parents.data(), count), locals = generate<math::TRS>(count, random_trs),
+                    worlds = std::vector<math::Mat4>(static_cast<std::size_t>(count))]() mutable {
+                math::compute_world_transforms(hierarchy, locals.data(), worlds.data());
+                do_not_optimize(worlds.data());
+            };
+        });
+
+        // Playback at 60 frames per second of tracks with 16 keys at 30 frames per second.
+        static constexpr i64 track_keys = 16;
+        bench_array("sample(Quat_Track[])" + suffix,
+                    sizeof(math::Quat_Track) + track_keys * (sizeof(f32) + sizeof(math::Quat)) + sizeof(i64) + sizeof(math::Quat), [](i64 const count) {
+                        std::vector<math::Quat_Track> tracks;
+                        tracks.reserve(static_cast<std::size_t>(count));
+                        f32 times[track_keys];
+                        math::Quat keys[track_keys];
+                        for(i64 i = 0; i < count; ++i) {
+                            for(i64 k = 0; k < track_keys; ++k) {
+                                times[k] = static_cast<f32>(k) / 30.0f;
+                                keys[k] = random_quat();
+                            }
+                            tracks.emplace_back(times, keys, track_keys);
+                        }
+                        return [count, tracks = std::move(tracks), cursors = std::vector<i64>(static_cast<std::size_t>(count)), out = math::Quat_Array(count),
+                                time = 0.0f]() mutable {
+                            math::sample(tracks.data(), count, time, math::Slerp_Method::nlerp_corrected, cursors.data(), out);
+                            time = time < static_cast<f32>(track_keys) / 30.0f ? time + 1.0f / 60.0f : 0.0f;
+                            do_not_optimize(out.x());
+                        };
+                    });
+
+        // Playback at 60 frames per second of a clip of 2 segments at 30 frames per
+        // second, whose bones rotate and translate between 2 random poses. The clip
+        // takes about 160 bytes per bone.
+        static constexpr i64 clip_frames = 33;
+        bench_array("sample(Compressed_Clip) -> Mat4" + suffix, sizeof(math::Mat4) + 160, [](i64 const count) {
+            std::vector<math::TRS> frames(static_cast<std::size_t>(clip_frames * count));
+            for(i64 i = 0; i < count; ++i) {
+                math::Quat const r0 = random_quat();
+                math::Quat const r1 = random_quat();
+                math::Vec3 const t0 = random_vec3();
+                math::Vec3 const t1 = random_vec3();
+                for(i64 f = 0; f < clip_frames; ++f) {
+                    f32 const t = static_cast<f32>(f) / static_cast<f32>(clip_frames - 1);
+                    frames[f * count + i] = {math::slerp(r0, r1, t), math::lerp(t0, t1, t), math::Vec3{1.0f}};
+                }
+            }
+            std::vector<math::Bone_Error> const errors(static_cast<std::size_t>(count), math::Bone_Error{0.001f, 1.0f});
+            return [count, clip = math::compress_clip(frames.data(), count, clip_frames, 30.0f, errors.data()),
+                    out = std::vector<math::Mat4>(static_cast<std::size_t>(count)), time = 0.0f]() mutable {
+                math::sample(clip, time, out.data());
+                time = time < clip.get_duration() ? time + 1.0f / 60.0f : 0.0f;
+                do_not_optimize(out.data());
+            };
+        });
+
+        using Vec3_Array_Function = void (*)(math::Mat4 const&, math::Vec3 const*, math::Vec3*, i64);
+        std::pair<char const*, Vec3_Array_Function> const vec3_functions[] = {
+            {"transform_points(Mat4, Vec3[])",
+             [](math::Mat4 const& m, math::Vec3 const* in, math::Vec3* out, i64 n) { math::transform_points(m, in, out, n); }},
+            {"transform_directions(Mat4, Vec3[])",
+             [](math::Mat4 const& m, math::Vec3 const* in, math::Vec3* out, i64 n) { math::transform_directions(m, in, out, n); }},
+            {"transform_points_projective(Mat4, Vec3[])",
+             [](math::Mat4 const& m, math::Vec3 const* in, math::Vec3* out, i64 n) { math::transform_points_projective(m, in, out, n); }},
+        };
+        for(auto const& [name, function]: vec3_functions) {
+            bench_array(name + suffix, 2 * sizeof(math::Vec3), [function = function](i64 const count) {
+                return [function, count, m = random_mat4(), in = generate<math::Vec3>(count, random_vec3),
+                        out = std::vector<math::Vec3>(static_cast<std::size_t>(count))]() mutable {
+                    function(m, in.data(), out.data(), count);
+                    do_not_optimize(out.data());
+                };
+            });
+        }
+
+        bench_array("transform(Mat4, Vec4[])" + suffix, 2 * sizeof(math::Vec4), [](i64 const count) {
+            return [count, m = random_mat4(), in = generate<math::Vec4>(count, random_vec4),
+                    out = std::vector<math::Vec4>(static_cast<std::size_t>(count))]() mutable {
+                math::transform(m, in.data(), out.data(), count);
+                do_not_optimize(out.data());
+            };
+        });
+
+        // Vertices with 4 influences of a palette of 64 bones, which stays in the L1 cache.
+        static constexpr i64 palette_size = 64;
+        bench_array("skin(Dual_Quat[])" + suffix, 2 * sizeof(math::Vec3) + 4 * (sizeof(u16) + sizeof(f32)), [](i64 const count) {
+            std::vector<u16> bones(static_cast<std::size_t>(4 * count));
+            std::vector<f32> weights(static_cast<std::size_t>(4 * count));
+            for(i64 i = 0; i < 4 * count; ++i) {
+                bones[i] = static_cast<u16>(random.next() % palette_size);
+                weights[i] = 0.25f;
+            }
+            return [count, palette = generate<math::Dual_Quat>(palette_size, [] { return math::Dual_Quat::from_rotation_translation(random_quat(), random_vec3()); }),
+                    bones = std::move(bones), weights = std::move(weights), in = generate<math::Vec3>(count, random_vec3),
+                    out = std::vector<math::Vec3>(static_cast<std::size_t>(count))]() mutable {
+                math::skin(palette.data(), bones.data(), weights.data(), in.data(), out.data(), count);
+                do_not_optimize(out.data());
+            };
+        });
+
+        bench_unary_array("sin(f32[])" + suffix, [](f32 const* in, f32* out, i64 n) { math::sin(in, out, n); }, -10.0f, 10.0f);
+        bench_unary_array("cos(f32[])" + suffix, [](f32 const* in, f32* out, i64 n) { math::cos(in, out, n); }, -10.0f, 10.0f);
+        bench_unary_array("tan(f32[])" + suffix, [](f32 const* in, f32* out, i64 n) { math::tan(in, out, n); }, -10.0f, 10.0f);
+        bench_unary_array("asin(f32[])" + suffix, [](f32 const* in, f32* out, i64 n) { math::asin(in, out, n); }, -1.0f, 1.0f);
+        bench_unary_array("acos(f32[])" + suffix, [](f32 const* in, f32* out, i64 n) { math::acos(in, out, n); }, -1.0f, 1.0f);
+        bench_unary_array("atan(f32[])" + suffix, [](f32 const* in, f32* out, i64 n) { math::atan(in, out, n); }, -10.0f, 10.0f);
+        bench_unary_array("exp(f32[])" + suffix, [](f32 const* in, f32* out, i64 n) { math::exp(in, out, n); }, -20.0f, 20.0f);
+        bench_unary_array("log(f32[])" + suffix, [](f32 const* in, f32* out, i64 n) { math::log(in, out, n); }, 0.001f, 1000.0f);
+        bench_unary_array("log2(f32[])" + suffix, [](f32 const* in, f32* out, i64 n) { math::log2(in, out, n); }, 0.001f, 1000.0f);
+        bench_array("sincos(f32[])" + suffix, 3 * sizeof(f32), [](i64 const count) {
+            return [count, in = generate<f32>(count, [] { return random.uniform(-10.0f, 10.0f); }), s = std::vector<f32>(static_cast<std::size_t>(count)),
+                    c = std::vector<f32>(static_cast<std::size_t>(count))]() mutable {
+                math::sincos(in.data(), s.data(), c.data(), count);
+                do_not_optimize(s.data());
+                do_not_optimize(c.data());
+            };
+        });
+        bench_array("atan2(f32[], f32[])" + suffix, 3 * sizeof(f32), [](i64 const count) {
+            return [count, y = generate<f32>(count, [] { return random.uniform(-10.0f, 10.0f); }),
+                    x = generate<f32>(count, [] { return random.uniform(-10.0f, 10.0f); }), out = std::vector<f32>(static_cast<std::size_t>(count))]() mutable {
+                math::atan2(y.data(), x.data(), out.data(), count);
+                do_not_optimize(out.data());
+            };
+        });
+        bench_array("pow(f32[], f32[])" + suffix, 3 * sizeof(f32), [](i64 const count) {
+            return [count, b = generate<f32>(count, [] { return random.uniform(0.001f, 1000.0f); }),
+                    e = generate<f32>(count, [] { return random.uniform(-4.0f, 4.0f); }), out = std::vector<f32>(static_cast<std::size_t>(count))]() mutable {
+                math::pow(b.data(), e.data(), out.data(), count);
+                do_not_optimize(out.data());
+            };
+        });
+
+        auto vec3_array = [](i64 const count) {
+            math::Vec3_Array a(count);
+            for(i64 i = 0; i < count; ++i) {
+                a.set(i, random_vec3());
+            }
+            return a;
+        };
+        auto vec4_array = [](i64 const count) {
+            math::Vec4_Array a(count);
+            for(i64 i = 0; i < count; ++i) {
+                a.set(i, random_vec4());
+            }
+            return a;
+        };
+        auto quat_array = [](i64 const count) {
+            math::Quat_Array a(count);
+            for(i64 i = 0; i < count; ++i) {
+                a.set(i, random_quat());
+            }
+            return a;
+        };
+        bench_array("add(Vec3_Array, Vec3_Array)" + suffix, 3 * sizeof(math::Vec3), [&](i64 const count) {
+            return [a = vec3_array(count), b = vec3_array(count), out = math::Vec3_Array(count)]() mutable {
+                math::add(a, b, out);
+                do_not_optimize(out.x());
+            };
+        });
+        bench_array("cross(Vec3_Array, Vec3_Array)" + suffix, 3 * sizeof(math::Vec3), [&](i64 const count) {
+            return [a = vec3_array(count), b = vec3_array(count), out = math::Vec3_Array(count)]() mutable {
+                math::cross(a, b, out);
+                do_not_optimize(out.x());
+            };
+        });
+        bench_array("dot(Vec3_Array, Vec3_Array)" + suffix, 2 * sizeof(math::Vec3) + sizeof(f32), [&](i64 const count) {
+            return [a = vec3_array(count), b = vec3_array(count), out = std::vector<f32>(static_cast<std::size_t>(count))]() mutable {
+                math::dot(a, b, out.data());
+                do_not_optimize(out.data());
+            };
+        });
+        bench_array("normalize(Vec3_Array)" + suffix, 2 * sizeof(math::Vec3), [&](i64 const count) {
+            return [a = vec3_array(count), out = math::Vec3_Array(count)]() mutable {
+                math::normalize(a, out);
+                do_not_optimize(out.x());
+            };
+        });
+        bench_array("lerp(Vec4_Array, Vec4_Array)" + suffix, 3 * sizeof(math::Vec4), [&](i64 const count) {
+            return [a = vec4_array(count), b = vec4_array(count), out = math::Vec4_Array(count)]() mutable {
+                math::lerp(a, b, 0.25f, out);
+                do_not_optimize(out.x());
+            };
+        });
+        bench_array("normalize(Vec4_Array)" + suffix, 2 * sizeof(math::Vec4), [&](i64 const count) {
+            return [a = vec4_array(count), out = math::Vec4_Array(count)]() mutable {
+                math::normalize(a, out);
+                do_not_optimize(out.x());
+            };
+        });
+        bench_array("multiply(Quat_Array, Quat_Array)" + suffix, 3 * sizeof(math::Quat), [&](i64 const count) {
+            return [a = quat_array(count), b = quat_array(count), out = math::Quat_Array(count)]() mutable {
+                math::multiply(a, b, out);
+                do_not_optimize(out.x());
+            };
+        });
+        bench_array("rotate(Quat_Array, Vec3_Array)" + suffix, sizeof(math::Quat) + 2 * sizeof(math::Vec3), [&](i64 const count) {
+            return [q = quat_array(count), v = vec3_array(count), out = math::Vec3_Array(count)]() mutable {
+                math::rotate(q, v, out);
+                do_not_optimize(out.x());
+            };
+        });
+        bench_array("rotate(Quat, Vec3_Array)" + suffix, 2 * sizeof(math::Vec3), [&](i64 const count) {
+            return [q = random_quat(), v = vec3_array(count), out = math::Vec3_Array(count)]() mutable {
+                math::rotate(q, v, out);
+                do_not_optimize(out.x());
+            };
+        });
+        std::pair<char const*, math::Slerp_Method> const slerp_methods[] = {
+            {"exact", math::Slerp_Method::exact},
+            {"nlerp", math::Slerp_Method::nlerp},
+            {"nlerp_corrected", math::Slerp_Method::nlerp_corrected},
+        };
+        for(auto const& [method_name, method]: slerp_methods) {
+            bench_array(std::string("slerp(Quat_Array, Quat_Array, ") + method_name + ")" + suffix, 3 * sizeof(math::Quat), [&](i64 const count) {
+                return [method = method, a = quat_array(count), b = quat_array(count), out = math::Quat_Array(count)]() mutable {
+                    math::slerp(a, b, 0.25f, method, out);
+                    do_not_optimize(out.x());
+                };
+            });
+        }
+        // 4 animation layers.
+        bench_array("blend(Quat_Array[4])" + suffix, 5 * sizeof(math::Quat), [&](i64 const count) {
+            return [layers = std::vector<math::Quat_Array>{quat_array(count), quat_array(count), quat_array(count), quat_array(count)},
+                    out = math::Quat_Array(count)]() mutable {
+                math::Quat_Array const* const inputs[4] = {&layers[0], &layers[1], &layers[2], &layers[3]};
+                f32 const weights[4] = {0.4f, 0.3f, 0.2f, 0.1f};
+                math::blend(inputs, weights, 4, out);
+                do_not_optimize(out.x());
+            };
+        });
+        bench_array("to_soa(Vec3[])" + suffix, 2 * sizeof(math::Vec3), [&](i64 const count) {
+            return [in = generate<math::Vec3>(count, random_vec3), out = math::Vec3_Array(count)]() mutable {
+                math::to_soa(in.data(), out);
+                do_not_optimize(out.x());
+            };
+        });
+        bench_array("to_aos(Vec3_Array)" + suffix, 2 * sizeof(math::Vec3), [&](i64 const count) {
+            return [in = vec3_array(count), out = std::vector<math::Vec3>(static_cast<std::size_t>(count))]() mutable {
+                math::to_aos(in, out.data());
+                do_not_optimize(out.data());
+            };
+        });
+    }
+
+    //
+    // Output
+    //
+
+    char const* get_mode_name(Mode const mode) {
+        return mode == Mode::throughput ? "throughput" : "latency";
+    }
+
+    bool write_json(char const* const path) {
+        FILE* const file = std::fopen(path, "w");
+        if(file == nullptr) {
+            std::fprintf(stderr, "error: could not open %s for writing\n", path);
+            return false;
+        }
+
+        std::fprintf(file, "{\n  \"inline\": %s,\n  \"simd\": %s,\n  \"instruction_set\": \"%s\",\n  \"threads\": %lld,\n  \"results\": [",
+                     ANTON_MATH_INLINE ? "true" : "false", ANTON_MATH_SIMD ? "true" : "false", math::get_instruction_set_name(math::get_instruction_set()),
+                     static_cast<long long>(options.threads));
+        for(std::size_t i = 0; i < results.size(); ++i) {
+            Result const& r = results[i];
+            std::fprintf(file,
+                         "%s\n    {\"name\": \"%s\", \"mode\": \"%s\", \"working_set\": %lld, \"ns_per_op_min\": %.4g, \"ns_per_op_median\": %.4g, "
+                         "\"ops_per_sec\": %.6g}",
+                         i == 0 ? "" : ",", r.name.c_str(), get_mode_name(r.mode), static_cast<long long>(r.working_set), r.min_ns, r.median_ns,
+                         1e9 / r.median_ns);
+        }
+        std::fputs("\n  ]\n}\n", file);
+        std::fclose(file);
+        return true;
+    }
+} // namespace
+
+int main(int argc, char** argv) {
+    for(int i = 1; i < argc; ++i) {
+        if(std::strcmp(argv[i], "--filter") == 0 && i + 1 < argc) {
+            options.filter = argv[++i];
+        } else if(std::strcmp(argv[i], "--json") == 0 && i + 1 < argc) {
+            options.json = argv[++i];
+        } else if(std::strcmp(argv[i], "--min-time") == 0 && i + 1 < argc) {
+            options.min_time = std::atof(argv[++i]);
+        } else if(std::strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+            options.threads = std::atoll(argv[++i]);
+        } else {
+            std::fprintf(stderr, "usage: %s [--filter <substring>] [--min-time <seconds>] [--threads <n>] [--json <path>]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    std::unique_ptr<math::Thread_Pool> pool;
+    if(options.threads > 1) {
+        pool = std::make_unique<math::Thread_Pool>(options.threads - 1);
+        math::set_executor(pool.get());
+    }
+
+    bench_types();
+    bench_scalar();
+
+    math::Instruction_Set const previous = math::get_instruction_set();
+    for(u8 i = 0; i <= static_cast<u8>(math::Instruction_Set::avx512); ++i) {
+        math::Instruction_Set const instruction_set = static_cast<math::Instruction_Set>(i);
+        if(math::is_instruction_set_supported(instruction_set)) {
+            math::set_instruction_set(instruction_set);
+            bench_arrays(std::string(" [") + math::get_instruction_set_name(instruction_set) + "]");
+        }
+    }
+    math::set_instruction_set(previous);
+    math::set_executor(nullptr);
+
+    std::printf("%-48s %-10s %12s %12s %12s %14s\n", "name", "mode", "working set", "ns/op min", "ns/op median", "ops/s");
+    for(Result const& r: results) {
+        char working_set[32] = "-";
+        if(r.mode == Mode::throughput) {
+            std::snprintf(working_set, sizeof(working_set), "%lld KiB", static_cast<long long>(r.working_set / 1024));
+        }
+        std::printf("%-48s %-10s %12s %12.3f %12.3f %14.4g\n", r.name.c_str(), get_mode_name(r.mode), working_set, r.min_ns, r.median_ns, 1e9 / r.median_ns);
+    }
+
+    if(options.json != nullptr && !write_json(options.json)) {
+        return 2;
+    }
+
+    return 0;
+}
@@ -0,0 +1 @@
+#include <anton/math/detail/affine3_impl.hpp>
@@ -0,0 +1,178 @@
+#include <anton/math/batch.hpp>
+#include <detail/kernels.hpp>
+#include <detail/parallel.hpp>
+
+namespace anton::math {
+    void multiply(Mat4 const* const lhs, Mat4 const* const rhs, Mat4* const out, i64 const count) {
+        detail::parallel_for(count, detail::grain_matrix, [&](i64 const begin, i64 const end) {
+            detail::get_kernels().mat4_multiply(lhs + begin, rhs + begin, out + begin, end - begin);
+        });
+    }
+
+    void multiply(Mat4 const& lhs, Mat4 const* const rhs, Mat4* const out, i64 const count) {
+        detail::parallel_for(count, detail::grain_matrix, [&](i64 const begin, i64 const end) {
+            detail::get_kernels().mat4_multiply_lhs(lhs, rhs + begin, out + begin, end - begin);
+        });
+    }
+
+    void multiply(Mat4 const* const lhs, Mat4 const& rhs, Mat4* const out, i64 const count) {
+        detail::parallel_for(count, detail::grain_matrix, [&](i64 const begin, i64 const end) {
+            detail::get_kernels().mat4_multiply_rhs(lhs + begin, rhs, out + begin, end - begin);
+        });
+    }
+
+    void inverse(Mat4 const* const m, Mat4* const out, i64 const count) {
+        detail::parallel_for(count, detail::grain_matrix, [&](i64 const begin, i64 const end) {
+            detail::get_kernels().mat4_inverse(m + begin, out + begin, end - begin);
+        });
+    }
+
+    void inverse_affine(Mat4 const* const m, Mat4* const out, i64 const count) {
+        detail::parallel_for(count, detail::grain_matrix, [&](i64 const begin, i64 const end) {
+            detail::get_kernels().mat4_inverse_affine(m + begin, out + begin, end - begin);
+        });
+    }
+
+    void inverse_rigid(Mat4 const* const m, Mat4* const out, i64 const count) {
+        detail::parallel_for(count, detail::grain_matrix, [&](i64 const begin, i64 const end) {
+            detail::get_kernels().mat4_inverse_rigid(m + begin, out + begin, end - begin);
+        });
+    }
+
+    void compose(TRS const* const in, Mat4* const out, i64 const count) {
+        detail::parallel_for(count, detail::grain_matrix, [&](i64 const begin, i64 const end) {
+            detail::get_kernels().trs_compose_mat4(in + begin, out + begin, end - begin);
+        });
+    }
+
+    void compose(TRS const* const in, Affine3* const out, i64 const count) {
+        detail::parallel_for(count, detail::grain_matrix, [&](i64 const begin, i64 const end) {
+            detail::get_kernels().trs_compose_affine3(in + begin, out + begin, end - begin);
+        });
+    }
+
+    void decompose(Mat4 const* const in, TRS* const out, i64 const count) {
+        detail::parallel_for(count, detail::grain_matrix, [&](i64 const begin, i64 const end) {
+            detail::get_kernels().trs_decompose(in + begin, out + begin, end - begin);
+        });
+    }
+
+    void transform_points(Mat4 const& m, Vec3 const* const in, Vec3* const out, i64 const count) {
+        detail::parallel_for(count, detail::grain_vector, [&](i64 const begin, i64 const end) {
+            detail::get_kernels().transform_points(m, in + begin, out + begin, end - begin);
+        });
+    }
+
+    void transform_directions(Mat4 const& m, Vec3 const* const in, Vec3* const out, i64 const count) {
+        detail::parallel_for(count, detail::grain_vector, [&](i64 const begin, i64 const end) {
+            detail::get_kernels().transform_directions(m, in + begin, out + begin, end - begin);
+        });
+    }
+
+    void rotate(Quat const& q, Vec3 const* const in, Vec3* const out, i64 const count) {
+        Mat4 const m = math::rotate(q);
+        detail::parallel_for(count, detail::grain_vector, [&](i64 const begin, i64 const end) {
+            detail::get_kernels().transform_directions(m, in + begin, out + begin, end - begin);
+        });
+    }
+
+    void transform_points_projective(Mat4 const& m, Vec3 const* const in, Vec3* const out, i64 const count) {
+        detail::parallel_for(count, detail::grain_vector, [&](i64 const begin, i64 const end) {
+            detail::get_kernels().transform_points_projective(m, in + begin, out + begin, end - begin);
+        });
+    }
+
+    void transform(Mat4 const& m, Vec4 const* const in, Vec4* const out, i64 const count) {
+        detail::parallel_for(count, detail::grain_vector, [&](i64 const begin, i64 const end) {
+            detail::get_kernels().transform_vec4(m, in + begin, out + begin, end - begin);
+        });
+    }
+
+    void skin(Dual_Quat const* const palette, u16 const* const bones, f32 const* const weights, Vec3 const* const positions, Vec3* const out,
+              i64 const count) {
+        detail::parallel_for(count, detail::grain_matrix, [&](i64 const begin, i64 const end) {
+            detail::get_kernels().dual_quat_skin(palette, bones + 4 * begin, weights + 4 * begin, positions + begin, nullptr, out + begin, nullptr,
+                                                 end - begin);
+        });
+    }
+
+    void skin(Dual_Quat const* const palette, u16 const* const bones, f32 const* const weights, Vec3 const* const positions,
+              Vec3 const* const normals, Vec3* const out_positions, Vec3* const out_normals, i64 const count) {
+        detail::parallel_for(count, detail::grain_matrix, [&](i64 const begin, i64 const end) {
+            detail::get_kernels().dual_quat_skin(palette, bones + 4 * begin, weights + 4 * begin, positions + begin, normals + begin,
+                                                 out_positions + begin, out_normals + begin, end - begin);
+        });
+    }
+
+    void sin(f32 const* const in, f32* const out, i64 const count) {
+        detail::parallel_for(count, detail::grain_function, [&](i64 const begin, i64 const end) {
+            detail::get_kernels().unary_function(detail::Unary_Function::sin, in + begin, out + begin, end - begin);
+        });
+    }
+
+    void cos(f32 const* const in, f32* const out, i64 const count) {
+        detail::parallel_for(count, detail::grain_function, [&](i64 const begin, i64 const end) {
+            detail::get_kernels().unary_function(detail::Unary_Function::cos, in + begin, out + begin, end - begin);
+        });
+    }
+
+    void tan(f32 const* const in, f32* const out, i64 const count) {
+        detail::parallel_for(count, detail::grain_function, [&](i64 const begin, i64 const end) {
+            detail::get_kernels().unary_function(detail::Unary_Function::tan, in + begin, out + begin, end - begin);
+        });
+    }
+
+    void sincos(f32 const* const in, f32* const sin, f32* const cos, i64 const count) {
+        detail::parallel_for(count, detail::grain_function, [&](i64 const begin, i64 const end) {
+            detail::get_kernels().sincos(in + begin, sin + begin, cos + begin, end - begin);
+        });
+    }
+
+    void asin(f32 const* const in, f32* const out, i64 const count) {
+        detail::parallel_for(count, detail::grain_function, [&](i64 const begin, i64 const end) {
+            detail::get_kernels().unary_function(detail::Unary_Function::asin, in + begin, out + begin, end - begin);
+        });
+    }
+
+    void acos(f32 const* const in, f32* const out, i64 const count) {
+        detail::parallel_for(count, detail::grain_function, [&](i64 const begin, i64 const end) {
+            detail::get_kernels().unary_function(detail::Unary_Function::acos, in + begin, out + begin, end - begin);
+        });
+    }
+
+    void atan(f32 const* const in, f32* const out, i64 const count) {
+        detail::parallel_for(count, detail::grain_function, [&](i64 const begin, i64 const end) {
+            detail::get_kernels().unary_function(detail::Unary_Function::atan, in + begin, out + begin, end - begin);
+        });
+    }
+
+    void atan2(f32 const* const y, f32 const* const x, f32* const out, i64 const count) {
+        detail::parallel_for(count, detail::grain_function, [&](i64 const begin, i64 const end) {
+            detail::get_kernels().binary_function(detail::Binary_Function::atan2, y + begin, x + begin, out + begin, end - begin);
+        });
+    }
+
+    void exp(f32 const* const in, f32* const out, i64 const count) {
+        detail::parallel_for(count, detail::grain_function, [&](i64 const begin, i64 const end) {
+            detail::get_kernels().unary_function(detail::Unary_Function::exp, in + begin, out + begin, end - begin);
+        });
+    }
+
+    void log(f32 const* const in, f32* const out, i64 const count) {
+        detail::parallel_for(count, detail::grain_function, [&](i64 const begin, i64 const end) {
+            detail::get_kernels().unary_function(detail::Unary_Function::log, in + begin, out + begin, end - begin);
+        });
+    }
+
+    void log2(f32 const* const in, f32* const out, i64 const count) {
+        detail::parallel_for(count, detail::grain_function, [&](i64 const begin, i64 const end) {
+            detail::get_kernels().unary_function(detail::Unary_Function::log2, in + begin, out + begin, end - begin);
+        });
+    }
+
+    void pow(f32 const* const base, f32 const* const exp, f32* const out, i64 const count) {
+        detail::parallel_for(count, detail::grain_function, [&](i64 const begin, i64 const end) {
+            detail::get_kernels().binary_function(detail::Binary_Function::pow, base + begin, exp + begin, out + begin, end - begin);
+        });
+    }
+} // namespace anton::math
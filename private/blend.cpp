@@ -0,0 +1,83 @@
+#include <anton/math/blend.hpp>
+#include <anton/math/quat_array.hpp>
+#include <anton/math/vec3_array.hpp>
+#include <detail/kernels.hpp>
+#include <detail/parallel.hpp>
+
+namespace anton::math {
+    // The exact method evaluates acos and sin, the remaining ones a few products.
+    static i64 get_slerp_grain(Slerp_Method const method) {
+        return method == Slerp_Method::exact ? detail::grain_function : detail::grain_vector;
+    }
+
+    void slerp(Quat_Array const& a, Quat_Array const& b, f32 const t, Slerp_Method const method, Quat_Array& out) {
+        detail::parallel_for(a.size(), get_slerp_grain(method), [&](i64 const begin, i64 const end) {
+            f32 const* const ca[4] = {a.x() + begin, a.y() + begin, a.z() + begin, a.w() + begin};
+            f32 const* const cb[4] = {b.x() + begin, b.y() + begin, b.z() + begin, b.w() + begin};
+            f32* const co[4] = {out.x() + begin, out.y() + begin, out.z() + begin, out.w() + begin};
+            detail::get_kernels().soa_slerp(method, ca, cb, 4, t, co, end - begin);
+        });
+    }
+
+    void slerp(Vec3_Array const& a, Vec3_Array const& b, f32 const t, Slerp_Method const method, Vec3_Array& out) {
+        detail::parallel_for(a.size(), get_slerp_grain(method), [&](i64 const begin, i64 const end) {
+            f32 const* const ca[3] = {a.x() + begin, a.y() + begin, a.z() + begin};
+            f32 const* const cb[3] = {b.x() + begin, b.y() + begin, b.z() + begin};
+            f32* const co[3] = {out.x() + begin, out.y() + begin, out.z() + begin};
+            detail::get_kernels().soa_slerp(method, ca, cb, 3, t, co, end - begin);
+        });
+    }
+
+    // The kernel takes the pointers to the components of all inputs in a single array,
+    // which lives on the stack unless there are more than max_inputs inputs.
+    constexpr i64 max_inputs = 16;
+
+    static f32 const* get_component(Quat_Array const& a, i64 const c) {
+        f32 const* const components[4] = {a.x(), a.y(), a.z(), a.w()};
+        return components[c];
+    }
+
+    static f32* get_component(Quat_Array& a, i64 const c) {
+        f32* const components[4] = {a.x(), a.y(), a.z(), a.w()};
+        return components[c];
+    }
+
+    static f32 const* get_component(Vec3_Array const& a, i64 const c) {
+        f32 const* const components[3] = {a.x(), a.y(), a.z()};
+        return components[c];
+    }
+
+    static f32* get_component(Vec3_Array& a, i64 const c) {
+        f32* const components[3] = {a.x(), a.y(), a.z()};
+        return components[c];
+    }
+
+    template<i64 components, typename Array>
+    static void blend_arrays(Array const* const* const inputs, f32 const* const weights, i64 const input_count, Array& out) {
+        detail::parallel_for(out.size(), detail::grain_vector, [&](i64 const begin, i64 const end) {
+            f32 const* stack_in[components * max_inputs];
+            f32 const** const in = input_count <= max_inputs ? stack_in : new f32 const*[components * input_count];
+            for(i64 k = 0; k < input_count; ++k) {
+                for(i64 c = 0; c < components; ++c) {
+                    in[components * k + c] = get_component(*inputs[k], c) + begin;
+                }
+            }
+            f32* co[components];
+            for(i64 c = 0; c < components; ++c) {
+                co[c] = get_component(out, c) + begin;
+            }
+            detail::get_kernels().soa_blend(in, weights, input_count, components, co, end - begin);
+            if(in != stack_in) {
+                delete[] in;
+            }
+        });
+    }
+
+    void blend(Quat_Array const* const* const inputs, f32 const* const weights, i64 const input_count, Quat_Array& out) {
+        blend_arrays<4>(inputs, weights, input_count, out);
+    }
+
+    void blend(Vec3_Array const* const* const inputs, f32 const* const weights, i64 const input_count, Vec3_Array& out) {
+        blend_arrays<3>(inputs, weights, input_count, out);
+    }
+} // namespace anton::math
@@ -0,0 +1,658 @@
+#include <anton/math/clip.hpp>
+#include <anton/math/mat4.hpp>
+#include <anton/math/math.hpp>
+#include <anton/math/quat.hpp>
+#include <anton/math/transform.hpp>
+#include <anton/math/vec3.hpp>
+#include <anton/math/detail/utility.hpp>
+#include <detail/kernels.hpp>
+#include <detail/parallel.hpp>
+
+#include <cstring>
+
+namespace anton::math {
+    // Layout of a clip
+    //
+    // Clip_Header
+    // Track_Descriptor[3 * bone_count] - the rotation, translation and scale of each bone.
+    // u32[segment_count + 1] - the offsets of the segments from the start of the clip.
+    // segments
+    //
+    // A segment covers the frames [segment * segment_frames, segment * segment_frames + segment_frames]
+    // and shares its boundary frames with the neighbouring segments. It stores the
+    // tracks that are not constant in the order of the descriptors. A track in a
+    // segment is
+    //
+    // u8 key_count
+    // u8[key_count] - the increasing frames of the keys relative to the segment.
+    // values[key_count] - the encoded values of the keys.
+    //
+    // The first and the last frame of a segment are always keys. The values are read
+    // with memcpy, hence nothing in the clip is aligned.
+
+    constexpr i64 segment_frames = 16;
+
+    enum struct Track_Format : u32 {
+        // The value is stored in the descriptor.
+        constant,
+        // Rotations are stored as the smallest 3 components, 15 bits each, with the
+        // index of the largest component in the high bits of the first 2 components.
+        // Vectors are stored as 16 bits per component in the range of the track, which
+        // is stored in the descriptor as the minimum and the extent.
+        quantized,
+        // The components are stored as f32.
+        raw,
+    };
+
+    struct Clip_Header {
+        u32 bone_count;
+        u32 frame_count;
+        u32 segment_count;
+        f32 sample_rate;
+    };
+
+    struct Track_Descriptor {
+        Track_Format format;
+        f32 data[6];
+    };
+
+    enum struct Channel : i64 { rotation, translation, scale };
+
+    template<typename T>
+    static T read(u8 const* const data) {
+        T value;
+        memcpy(&value, data, sizeof(T));
+        return value;
+    }
+
+    template<typename T>
+    static void write(u8* const data, T const& value) {
+        memcpy(data, &value, sizeof(T));
+    }
+
+    static i64 get_segment_count(i64 const frame_count) {
+        return frame_count > 1 ? (frame_count - 2) / segment_frames + 1 : 1;
+    }
+
+    static i64 get_value_size(Channel const channel, Track_Format const format) {
+        switch(format) {
+            case Track_Format::constant:
+                return 0;
+            case Track_Format::quantized:
+                return 3 * sizeof(u16);
+            case Track_Format::raw:
+                return channel == Channel::rotation ? 4 * sizeof(f32) : 3 * sizeof(f32);
+        }
+        return 0;
+    }
+
+    // The components of a unit quaternion other than the largest one lie in
+    // [-1 / sqrt(2), 1 / sqrt(2)].
+    constexpr f32 smallest_three_range = 0.70710678f;
+    constexpr u16 max_u15 = 0x7FFF;
+    constexpr u16 max_u16 = 0xFFFF;
+
+    static void encode(Track_Descriptor const& descriptor, Quat const& value, u8* const data) {
+        if(descriptor.format == Track_Format::raw) {
+            f32 const components[4] = {value.x, value.y, value.z, value.w};
+            memcpy(data, components, sizeof(components));
+            return;
+        }
+
+        f32 const components[4] = {value.x, value.y, value.z, value.w};
+        i64 largest = 0;
+        for(i64 i = 1; i < 4; ++i) {
+            if(math::abs(components[i]) > math::abs(components[largest])) {
+                largest = i;
+            }
+        }
+
+        // q and -q are the same rotation. The sign is chosen so that the largest
+        // component is positive.
+        f32 const sign = components[largest] < 0.0f ? -1.0f : 1.0f;
+        u16 quantized[3];
+        for(i64 i = 0, j = 0; i < 4; ++i) {
+            if(i != largest) {
+                f32 const normalized = clamp((sign * components[i] / smallest_three_range + 1.0f) * 0.5f, 0.0f, 1.0f);
+                quantized[j] = static_cast<u16>(normalized * max_u15 + 0.5f);
+                j += 1;
+            }
+        }
+        quantized[0] |= static_cast<u16>((largest & 1) << 15);
+        quantized[1] |= static_cast<u16>((largest >> 1) << 15);
+        memcpy(data, quantized, sizeof(quantized));
+    }
+
+    static void encode(Track_Descriptor const& descriptor, Vec3 const& value, u8* const data) {
+        if(descriptor.format == Track_Format::raw) {
+            f32 const components[3] = {value.x, value.y, value.z};
+            memcpy(data, components, sizeof(components));
+            return;
+        }
+
+        u16 quantized[3];
+        for(i32 i = 0; i < 3; ++i) {
+            f32 const extent = descriptor.data[3 + i];
+            f32 const normalized = extent > 0.0f ? clamp((value[i] - descriptor.data[i]) / extent, 0.0f, 1.0f) : 0.0f;
+            quantized[i] = static_cast<u16>(normalized * max_u16 + 0.5f);
+        }
+        memcpy(data, quantized, sizeof(quantized));
+    }
+
+    static void decode(Track_Descriptor const& descriptor, u8 const* const data, Quat& value) {
+        if(descriptor.format == Track_Format::raw) {
+            f32 components[4];
+            memcpy(components, data, sizeof(components));
+            value = Quat(components[0], components[1], components[2], components[3]);
+            return;
+        }
+
+        u16 quantized[3];
+        memcpy(quantized, data, sizeof(quantized));
+        i64 const largest = (quantized[0] >> 15) | ((quantized[1] >> 15) << 1);
+        f32 smallest[3];
+        for(i64 i = 0; i < 3; ++i) {
+            smallest[i] = (static_cast<f32>(quantized[i] & max_u15) * (2.0f / max_u15) - 1.0f) * smallest_three_range;
+        }
+        f32 const sum = smallest[0] * smallest[0] + smallest[1] * smallest[1] + smallest[2] * smallest[2];
+        f32 components[4];
+        for(i64 i = 0, j = 0; i < 4; ++i) {
+            if(i == largest) {
+                components[i] = math::sqrt(math::max(1.0f - sum, 0.0f));
+            } else {
+                components[i] = smallest[j];
+                j += 1;
+            }
+        }
+        value = Quat(components[0], components[1], components[2], components[3]);
+    }
+
+    static void decode(Track_Descriptor const& descriptor, u8 const* const data, Vec3& value) {
+        if(descriptor.format == Track_Format::raw) {
+            f32 components[3];
+            memcpy(components, data, sizeof(components));
+            value = Vec3(components[0], components[1], components[2]);
+            return;
+        }
+
+        u16 quantized[3];
+        memcpy(quantized, data, sizeof(quantized));
+        for(i32 i = 0; i < 3; ++i) {
+            value[i] = descriptor.data[i] + descriptor.data[3 + i] * (static_cast<f32>(quantized[i]) * (1.0f / max_u16));
+        }
+    }
+
+    static void get_constant(Track_Descriptor const& descriptor, Quat& value) {
+        value = Quat(descriptor.data[0], descriptor.data[1], descriptor.data[2], descriptor.data[3]);
+    }
+
+    static void get_constant(Track_Descriptor const& descriptor, Vec3& value) {
+        value = Vec3(descriptor.data[0], descriptor.data[1], descriptor.data[2]);
+    }
+
+    // The rotations are interpolated with nlerp along the shorter path. The keys are
+    // dense enough for the nonuniform speed of nlerp to stay within the budget.
+    static Quat interpolate(Quat const& a, Quat b, f32 const t) {
+        if(a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w < 0.0f) {
+            b = -b;
+        }
+        return normalize(a + (b - a) * t);
+    }
+
+    static Vec3 interpolate(Vec3 const& a, Vec3 const& b, f32 const t) {
+        return a + (b - a) * t;
+    }
+
+    // Samples a track of a segment at frame, which is relative to the segment.
+    template<typename T>
+    static T sample_track(Track_Descriptor const& descriptor, i64 const value_size, u8 const* const keys, f32 const frame) {
+        i64 const key_count = keys[0];
+        u8 const* const frames = keys + 1;
+        u8 const* const values = frames + key_count;
+        i64 k = 0;
+        while(k + 1 < key_count && frames[k + 1] <= frame) {
+            k += 1;
+        }
+
+        T a;
+        decode(descriptor, values + k * value_size, a);
+        if(k + 1 == key_count) {
+            return a;
+        }
+
+        T b;
+        decode(descriptor, values + (k + 1) * value_size, b);
+        f32 const t = (frame - frames[k]) / static_cast<f32>(frames[k + 1] - frames[k]);
+        return interpolate(a, b, t);
+    }
+
+    Compressed_Clip::Compressed_Clip(): _data(nullptr), _size(0) {}
+
+    Compressed_Clip::Compressed_Clip(u8 const* const data, i64 const size): _data(size > 0 ? new u8[size] : nullptr), _size(size) {
+        if(size > 0) {
+            memcpy(_data, data, size);
+        }
+    }
+
+    Compressed_Clip::Compressed_Clip(Compressed_Clip const& other): Compressed_Clip(other._data, other._size) {}
+
+    Compressed_Clip::Compressed_Clip(Compressed_Clip&& other): Compressed_Clip() {
+        *this = static_cast<Compressed_Clip&&>(other);
+    }
+
+    Compressed_Clip::~Compressed_Clip() {
+        delete[] _data;
+    }
+
+    Compressed_Clip& Compressed_Clip::operator=(Compressed_Clip const& other) {
+        if(this != &other) {
+            Compressed_Clip copy(other);
+            *this = static_cast<Compressed_Clip&&>(copy);
+        }
+        return *this;
+    }
+
+    Compressed_Clip& Compressed_Clip::operator=(Compressed_Clip&& other) {
+        detail::swap(_data, other._data);
+        detail::swap(_size, other._size);
+        return *this;
+    }
+
+    i64 Compressed_Clip::get_bone_count() const {
+        return _size > 0 ? read<Clip_Header>(_data).bone_count : 0;
+    }
+
+    i64 Compressed_Clip::get_frame_count() const {
+        return _size > 0 ? read<Clip_Header>(_data).frame_count : 0;
+    }
+
+    f32 Compressed_Clip::get_sample_rate() const {
+        return _size > 0 ? read<Clip_Header>(_data).sample_rate : 0.0f;
+    }
+
+    f32 Compressed_Clip::get_duration() const {
+        if(_size == 0) {
+            return 0.0f;
+        }
+
+        Clip_Header const header = read<Clip_Header>(_data);
+        return static_cast<f32>(header.frame_count - 1) / header.sample_rate;
+    }
+
+    i64 Compressed_Clip::size() const {
+        return _size;
+    }
+
+    u8 const* Compressed_Clip::get_data() const {
+        return _data;
+    }
+
+    // prepare_descriptor
+    // Stores the range of the track in the descriptor and returns the candidate for a
+    // constant track. Rotations are not averaged and the first key is the candidate.
+    //
+    static Quat prepare_descriptor(Quat const* const values, i64, Track_Descriptor&) {
+        return values[0];
+    }
+
+    // prepare_descriptor
+    // Stores the range of the track in the descriptor and returns the candidate for a
+    // constant track, which is the midpoint of the range of each component.
+    //
+    static Vec3 prepare_descriptor(Vec3 const* const values, i64 const frame_count, Track_Descriptor& descriptor) {
+        Vec3 minimum = values[0];
+        Vec3 maximum = values[0];
+        for(i64 f = 1; f < frame_count; ++f) {
+            minimum = math::min(minimum, values[f]);
+            maximum = math::max(maximum, values[f]);
+        }
+        for(i32 i = 0; i < 3; ++i) {
+            descriptor.data[i] = minimum[i];
+            descriptor.data[3 + i] = maximum[i] - minimum[i];
+        }
+        return (minimum + maximum) * 0.5f;
+    }
+
+    static void set_constant(Track_Descriptor& descriptor, Quat const& value) {
+        descriptor = {Track_Format::constant, {value.x, value.y, value.z, value.w, 0.0f, 0.0f}};
+    }
+
+    static void set_constant(Track_Descriptor& descriptor, Vec3 const& value) {
+        descriptor = {Track_Format::constant, {value.x, value.y, value.z, 0.0f, 0.0f, 0.0f}};
+    }
+
+    // Track_Plan
+    // The encoding of a track chosen by the compressor. keys has a flag for every
+    // frame of the clip that is set when the frame is a key. Unused by the constant
+    // tracks.
+    //
+    struct Track_Plan {
+        Track_Descriptor descriptor;
+        u8* keys;
+    };
+
+    // plan_track
+    // Chooses the smallest encoding of a track within budget and removes the keys that
+    // are within budget of the interpolation of their neighbours. The errors are
+    // measured at the frames against the original values with the same decoding and
+    // interpolation as the sampling.
+    //
+    // Parameters:
+    // values - array of frame_count values of the track.
+    // error - callable (T const& value, i64 frame) -> f32 that returns the error of value
+    //         at frame.
+    // reconstructed - scratch array of frame_count values.
+    //
+    // Returns:
+    // The maximum error of the track.
+    //
+    template<typename T, typename Error>
+    static f32 plan_track(T const* const values, i64 const frame_count, f32 const budget, Error const& error, T* const reconstructed,
+                          Track_Plan& plan) {
+        Track_Descriptor& descriptor = plan.descriptor;
+        descriptor = {};
+
+        T const constant = prepare_descriptor(values, frame_count, descriptor);
+        f32 constant_error = 0.0f;
+        for(i64 f = 0; f < frame_count; ++f) {
+            constant_error = math::max(constant_error, error(constant, f));
+        }
+
+        if(constant_error <= budget) {
+            set_constant(descriptor, constant);
+            return constant_error;
+        }
+
+        // Half of the budget is left for the removal of the keys. The tracks that do not
+        // quantize within it are stored raw.
+        descriptor.format = Track_Format::quantized;
+        f32 quantization_error = 0.0f;
+        for(i64 f = 0; f < frame_count; ++f) {
+            u8 encoded[3 * sizeof(u16)];
+            encode(descriptor, values[f], encoded);
+            decode(descriptor, encoded, reconstructed[f]);
+            quantization_error = math::max(quantization_error, error(reconstructed[f], f));
+        }
+
+        if(quantization_error > 0.5f * budget) {
+            descriptor.format = Track_Format::raw;
+            for(i64 f = 0; f < frame_count; ++f) {
+                reconstructed[f] = values[f];
+            }
+        }
+
+        // Greedy removal within the segments. From every key the next key is the
+        // farthest frame of the segment whose interpolation with the key is within
+        // budget at all frames in between.
+        f32 max_error = descriptor.format == Track_Format::raw ? 0.0f : quantization_error;
+        i64 const segment_count = get_segment_count(frame_count);
+        for(i64 segment = 0; segment < segment_count; ++segment) {
+            i64 const first = segment * segment_frames;
+            i64 const last = math::min(first + segment_frames, frame_count - 1);
+            plan.keys[first] = true;
+            plan.keys[last] = true;
+            i64 key = first;
+            while(key < last) {
+                i64 next = key + 1;
+                f32 next_error = 0.0f;
+                for(i64 candidate = last; candidate > key + 1; --candidate) {
+                    f32 candidate_error = 0.0f;
+                    for(i64 f = key + 1; f < candidate && candidate_error <= budget; ++f) {
+                        f32 const t = static_cast<f32>(f - key) / static_cast<f32>(candidate - key);
+                        candidate_error = math::max(candidate_error, error(interpolate(reconstructed[key], reconstructed[candidate], t), f));
+                    }
+
+                    if(candidate_error <= budget) {
+                        next = candidate;
+                        next_error = candidate_error;
+                        break;
+                    }
+                }
+
+                plan.keys[next] = true;
+                max_error = math::max(max_error, next_error);
+                key = next;
+            }
+        }
+        return max_error;
+    }
+
+    static f64 length_squared_f64(Quat const& q) {
+        return static_cast<f64>(q.x) * q.x + static_cast<f64>(q.y) * q.y + static_cast<f64>(q.z) * q.z + static_cast<f64>(q.w) * q.w;
+    }
+
+    Compressed_Clip compress_clip(TRS const* const frames, i64 const bone_count, i64 const frame_count, f32 const sample_rate,
+                                  Bone_Error const* const errors) {
+        // The negated comparison rejects NaN as well.
+        if(!(sample_rate > 0.0f)) {
+            return Compressed_Clip();
+        }
+
+        i64 const track_count = 3 * bone_count;
+        Track_Plan* const plans = new Track_Plan[track_count];
+        u8* const keys = new u8[track_count * frame_count]();
+        Quat* const rotations = new Quat[frame_count];
+        Vec3* const vectors = new Vec3[frame_count];
+        Quat* const reconstructed_rotations = new Quat[frame_count];
+        Vec3* const reconstructed_vectors = new Vec3[frame_count];
+        f32* const max_scales = new f32[frame_count];
+
+        for(i64 bone = 0; bone < bone_count; ++bone) {
+            f32 const budget = errors[bone].max_error;
+            f32 const shell = errors[bone].shell_distance;
+            Track_Plan& rotation_plan = plans[3 * bone];
+            Track_Plan& translation_plan = plans[3 * bone + 1];
+            Track_Plan& scale_plan = plans[3 * bone + 2];
+            rotation_plan.keys = keys + (3 * bone) * frame_count;
+            translation_plan.keys = keys + (3 * bone + 1) * frame_count;
+            scale_plan.keys = keys + (3 * bone + 2) * frame_count;
+
+            // The error of a bone is at most the sum of the errors of its tracks. The
+            // scale takes a third of the budget, the translation half of the rest and the
+            // rotation all that remains, so that the budget left unused by a track goes
+            // to the following ones.
+            for(i64 f = 0; f < frame_count; ++f) {
+                Vec3 const scale = frames[f * bone_count + bone].scale;
+                vectors[f] = scale;
+                max_scales[f] = math::max(math::abs(scale.x), math::abs(scale.y), math::abs(scale.z));
+            }
+            f32 const scale_error = plan_track(
+                vectors, frame_count, budget / 3.0f,
+                [&](Vec3 const& value, i64 const f) {
+                    Vec3 const d = value - vectors[f];
+                    return shell * math::max(math::abs(d.x), math::abs(d.y), math::abs(d.z));
+                },
+                reconstructed_vectors, scale_plan);
+
+            for(i64 f = 0; f < frame_count; ++f) {
+                vectors[f] = frames[f * bone_count + bone].translation;
+            }
+            f32 const translation_error = plan_track(
+                vectors, frame_count, (budget - scale_error) * 0.5f, [&](Vec3 const& value, i64 const f) { return length(value - vectors[f]); },
+                reconstructed_vectors, translation_plan);
+
+            // A rotation by angle a moves a point at distance r by 2r sin(a / 2), where
+            // sin(a / 2) is sqrt(1 - dot^2) of the unit quaternions. The difference is
+            // computed in f64 since 1 - dot^2 cancels for small angles. The dot is divided
+            // by the lengths, because the rounding errors of normalized f32 quaternions
+            // exceed the difference.
+            for(i64 f = 0; f < frame_count; ++f) {
+                rotations[f] = frames[f * bone_count + bone].rotation;
+            }
+            plan_track(
+                rotations, frame_count, budget - scale_error - translation_error,
+                [&](Quat const& value, i64 const f) {
+                    Quat const& q = rotations[f];
+                    f64 const d = static_cast<f64>(value.x) * q.x + static_cast<f64>(value.y) * q.y + static_cast<f64>(value.z) * q.z +
+                                  static_cast<f64>(value.w) * q.w;
+                    f64 const lengths = length_squared_f64(value) * length_squared_f64(q);
+                    f64 const sin_squared = d * d < lengths ? 1.0 - d * d / lengths : 0.0;
+                    return 2.0f * shell * max_scales[f] * math::sqrt(static_cast<f32>(sin_squared));
+                },
+                reconstructed_rotations, rotation_plan);
+        }
+
+        i64 const segment_count = get_segment_count(frame_count);
+        i64 const descriptors_offset = sizeof(Clip_Header);
+        i64 const segment_offsets_offset = descriptors_offset + track_count * sizeof(Track_Descriptor);
+        i64 const segments_offset = segment_offsets_offset + (segment_count + 1) * sizeof(u32);
+
+        // The first pass computes the sizes of the segments, the second one writes them.
+        i64 size = segments_offset;
+        for(i64 segment = 0; segment < segment_count; ++segment) {
+            i64 const first = segment * segment_frames;
+            i64 const last = math::min(first + segment_frames, frame_count - 1);
+            for(i64 track = 0; track < track_count; ++track) {
+                Track_Plan const& plan = plans[track];
+                if(plan.descriptor.format == Track_Format::constant) {
+                    continue;
+                }
+
+                i64 key_count = 0;
+                for(i64 f = first; f <= last; ++f) {
+                    key_count += plan.keys[f];
+                }
+                size += 1 + key_count * (1 + get_value_size(static_cast<Channel>(track % 3), plan.descriptor.format));
+            }
+        }
+
+        u8* const data = new u8[size];
+        write(data, Clip_Header{static_cast<u32>(bone_count), static_cast<u32>(frame_count), static_cast<u32>(segment_count), sample_rate});
+        for(i64 track = 0; track < track_count; ++track) {
+            write(data + descriptors_offset + track * sizeof(Track_Descriptor), plans[track].descriptor);
+        }
+
+        u8* stream = data + segments_offset;
+        for(i64 segment = 0; segment < segment_count; ++segment) {
+            write(data + segment_offsets_offset + segment * sizeof(u32), static_cast<u32>(stream - data));
+            i64 const first = segment * segment_frames;
+            i64 const last = math::min(first + segment_frames, frame_count - 1);
+            for(i64 track = 0; track < track_count; ++track) {
+                Track_Plan const& plan = plans[track];
+                if(plan.descriptor.format == Track_Format::constant) {
+                    continue;
+                }
+
+                u8* const key_count = stream;
+                stream += 1;
+                *key_count = 0;
+                for(i64 f = first; f <= last; ++f) {
+                    if(plan.keys[f]) {
+                        *stream = static_cast<u8>(f - first);
+                        stream += 1;
+                        *key_count += 1;
+                    }
+                }
+
+                Channel const channel = static_cast<Channel>(track % 3);
+                i64 const value_size = get_value_size(channel, plan.descriptor.format);
+                TRS const* const bone_frames = frames + track / 3;
+                for(i64 f = first; f <= last; ++f) {
+                    if(!plan.keys[f]) {
+                        continue;
+                    }
+
+                    TRS const& trs = bone_frames[f * bone_count];
+                    switch(channel) {
+                        case Channel::rotation:
+                            encode(plan.descriptor, trs.rotation, stream);
+                            break;
+                        case Channel::translation:
+                            encode(plan.descriptor, trs.translation, stream);
+                            break;
+                        case Channel::scale:
+                            encode(plan.descriptor, trs.scale, stream);
+                            break;
+                    }
+                    stream += value_size;
+                }
+            }
+        }
+        write(data + segment_offsets_offset + segment_count * sizeof(u32), static_cast<u32>(stream - data));
+
+        Compressed_Clip clip(data, size);
+        delete[] data;
+        delete[] max_scales;
+        delete[] reconstructed_vectors;
+        delete[] reconstructed_rotations;
+        delete[] vectors;
+        delete[] rotations;
+        delete[] keys;
+        delete[] plans;
+        return clip;
+    }
+
+    // Clip_Decoder
+    // Decodes the bones of a clip at a time in order. The tracks of a segment are
+    // read sequentially.
+    //
+    struct Clip_Decoder {
+    public:
+        Clip_Decoder(Compressed_Clip const& clip, f32 const time) {
+            u8 const* const data = clip.get_data();
+            Clip_Header const header = read<Clip_Header>(data);
+            i64 const segment_count = header.segment_count;
+            f32 const frame = math::clamp(time * header.sample_rate, 0.0f, static_cast<f32>(header.frame_count - 1));
+            i64 const segment = math::min(static_cast<i64>(frame) / segment_frames, segment_count - 1);
+            _descriptors = data + sizeof(Clip_Header);
+            u8 const* const segment_offsets = _descriptors + 3 * header.bone_count * sizeof(Track_Descriptor);
+            _stream = data + read<u32>(segment_offsets + segment * sizeof(u32));
+            _frame = frame - static_cast<f32>(segment * segment_frames);
+        }
+
+        void decode(TRS* const out, i64 const count) {
+            for(i64 i = 0; i < count; ++i) {
+                decode_track(out[i].rotation, Channel::rotation);
+                decode_track(out[i].translation, Channel::translation);
+                decode_track(out[i].scale, Channel::scale);
+            }
+        }
+
+    private:
+        u8 const* _descriptors;
+        u8 const* _stream;
+        f32 _frame;
+
+        template<typename T>
+        void decode_track(T& value, Channel const channel) {
+            Track_Descriptor const descriptor = read<Track_Descriptor>(_descriptors);
+            _descriptors += sizeof(Track_Descriptor);
+            if(descriptor.format == Track_Format::constant) {
+                get_constant(descriptor, value);
+                return;
+            }
+
+            i64 const value_size = get_value_size(channel, descriptor.format);
+            value = sample_track<T>(descriptor, value_size, _stream, _frame);
+            _stream += 1 + _stream[0] * (1 + value_size);
+        }
+    };
+
+    void sample(Compressed_Clip const& clip, f32 const time, TRS* const out) {
+        if(clip.size() == 0) {
+            return;
+        }
+
+        Clip_Decoder decoder(clip, time);
+        decoder.decode(out, clip.get_bone_count());
+    }
+
+    // The bones are decoded in batches of detail::gather_batch_size and composed with
+    // the kernel.
+
+    void sample(Compressed_Clip const& clip, f32 const time, Mat4* const out) {
+        if(clip.size() == 0) {
+            return;
+        }
+
+        detail::Kernels const& kernels = detail::get_kernels();
+        Clip_Decoder decoder(clip, time);
+        i64 const bone_count = clip.get_bone_count();
+        TRS batch[detail::gather_batch_size];
+        for(i64 i = 0; i < bone_count; i += detail::gather_batch_size) {
+            i64 const n = bone_count - i < detail::gather_batch_size ? bone_count - i : detail::gather_batch_size;
+            decoder.decode(batch, n);
+            kernels.trs_compose_mat4(batch, out + i, n);
+        }
+    }
+} // namespace anton::math
@@ -0,0 +1,160 @@
+#pragma once
+
+#include <anton/types.hpp>
+#include <anton/math/affine3.hpp>
+#include <anton/math/blend.hpp>
+#include <anton/math/dispatch.hpp>
+#include <anton/math/dual_quat.hpp>
+#include <anton/math/mat4.hpp>
+#include <anton/math/transform.hpp>
+#include <anton/math/vec3.hpp>
+#include <anton/math/vec4.hpp>
+
+namespace anton::math::detail {
+    enum struct Elementwise_Op : u8 {
+        add,
+        subtract,
+        multiply,
+        divide,
+        min,
+        max,
+    };
+
+    enum struct Unary_Function : u8 {
+        sin,
+        cos,
+        tan,
+        asin,
+        acos,
+        atan,
+        exp,
+        log,
+        log2,
+    };
+
+    enum struct Binary_Function : u8 {
+        // function(y, x)
+        atan2,
+        // function(base, exponent)
+        pow,
+    };
+
+    // Kernels
+    // Table of the array kernels compiled for a single instruction set.
+    //
+    // The kernels are compiled once per instruction set from detail/kernels_impl.hpp
+    // in kernels_<instruction set>.cpp. Unless stated otherwise, the output arrays
+    // may be equal to the input arrays, but must not overlap them otherwise.
+    //
+    struct Kernels {
+        // out[i] = lhs[i] * rhs[i]
+        void (*mat4_multiply)(Mat4 const* lhs, Mat4 const* rhs, Mat4* out, i64 count);
+        // out[i] = lhs * rhs[i]
+        // lhs must not overlap out.
+        void (*mat4_multiply_lhs)(Mat4 const& lhs, Mat4 const* rhs, Mat4* out, i64 count);
+        // out[i] = lhs[i] * rhs
+        // rhs must not overlap out.
+        void (*mat4_multiply_rhs)(Mat4 const* lhs, Mat4 const& rhs, Mat4* out, i64 count);
+        // out[i] = inverse(m[i])
+        void (*mat4_inverse)(Mat4 const* m, Mat4* out, i64 count);
+        // out[i] = inverse_affine(m[i])
+        void (*mat4_inverse_affine)(Mat4 const* m, Mat4* out, i64 count);
+        // out[i] = inverse_rigid(m[i])
+        void (*mat4_inverse_rigid)(Mat4 const* m, Mat4* out, i64 count);
+        // out[i] = compose(in[i])
+        void (*trs_compose_mat4)(TRS const* in, Mat4* out, i64 count);
+        // out[i] = compose_affine(in[i])
+        void (*trs_compose_affine3)(TRS const* in, Affine3* out, i64 count);
+        // out[i] = decompose(in[i])
+        void (*trs_decompose)(Mat4 const* in, TRS* out, i64 count);
+        // out[i] = (m * Vec4(in[i], 1)).xyz
+        void (*transform_points)(Mat4 const& m, Vec3 const* in, Vec3* out, i64 count);
+        // out[i] = (m * Vec4(in[i], 0)).xyz
+        void (*transform_directions)(Mat4 const& m, Vec3 const* in, Vec3* out, i64 count);
+        // out[i] = (m * Vec4(in[i], 1)).xyz / (m * Vec4(in[i], 1)).w
+        void (*transform_points_projective)(Mat4 const& m, Vec3 const* in, Vec3* out, i64 count);
+        // out[i] = m * in[i]
+        void (*transform_vec4)(Mat4 const& m, Vec4 const* in, Vec4* out, i64 count);
+        // out_positions[i] = transform_point(b, positions[i]) and
+        // out_normals[i] = transform_direction(b, normals[i]) where b is the normalized
+        // sum of weights[4 * i + k] * palette[bones[4 * i + k]] over k in [0, 4) with the
+        // influences in the opposite hemisphere of the first one negated. normals and
+        // out_normals may both be nullptr.
+        void (*dual_quat_skin)(Dual_Quat const* palette, u16 const* bones, f32 const* weights, Vec3 const* positions, Vec3 const* normals,
+                               Vec3* out_positions, Vec3* out_normals, i64 count);
+
+        // Kernels operating on structures of arrays. a, b and out are arrays of
+        // components-many pointers to arrays of count floats (components is 3 or 4).
+        //
+        // out[i] = a[i] op b[i]
+        void (*soa_elementwise)(Elementwise_Op op, f32 const* a, f32 const* b, f32* out, i64 count);
+        // out[i] = a[i] op b
+        void (*soa_elementwise_scalar)(Elementwise_Op op, f32 const* a, f32 b, f32* out, i64 count);
+        // out[i] = (1 - t) * a[i] + t * b[i]
+        void (*soa_lerp)(f32 const* a, f32 const* b, f32 t, f32* out, i64 count);
+        // out[i] = (1 - t[i]) * a[i] + t[i] * b[i]
+        void (*soa_lerp_varying)(f32 const* a, f32 const* b, f32 const* t, f32* out, i64 count);
+        // out[i] = dot(a[i], b[i])
+        void (*soa_dot)(f32 const* const* a, f32 const* const* b, i64 components, f32* out, i64 count);
+        // out[i] = length(a[i])
+        void (*soa_length)(f32 const* const* a, i64 components, f32* out, i64 count);
+        // out[i] = normalize(a[i], tolerance)
+        void (*soa_normalize)(f32 const* const* a, i64 components, f32 tolerance, f32* const* out, i64 count);
+        // out[i] = cross(a[i], b[i]), components is 3.
+        void (*soa_cross)(f32 const* const* a, f32 const* const* b, f32* const* out, i64 count);
+        // out[i] = a[i] * b[i], the Hamilton product of quaternions (components is 4).
+        void (*soa_quat_multiply)(f32 const* const* a, f32 const* const* b, f32* const* out, i64 count);
+        // out[i] = q[i] * v[i], the rotation of vectors (components is 3) by unit
+        // quaternions (components is 4).
+        void (*soa_quat_rotate)(f32 const* const* q, f32 const* const* v, f32* const* out, i64 count);
+        // out[i] = (m * Vec4(in[i], 0)).xyz, components is 3.
+        void (*soa_transform_directions)(Mat4 const& m, f32 const* const* in, f32* const* out, i64 count);
+        // out[i] = slerp(a[i], b[i], t) evaluated with method. components is 3 for unit
+        // vectors or 4 for unit quaternions, which are interpolated along the shorter path.
+        void (*soa_slerp)(Slerp_Method method, f32 const* const* a, f32 const* const* b, i64 components, f32 t, f32* const* out, i64 count);
+        // out[i] = slerp(a[i], b[i], t[i]) like soa_slerp.
+        void (*soa_slerp_varying)(Slerp_Method method, f32 const* const* a, f32 const* const* b, i64 components, f32 const* t, f32* const* out,
+                                  i64 count);
+        // out[i] = weights[0] * in[0][i] + ... + weights[input_count - 1] * in[input_count - 1][i]
+        // where in[k] are the components-many pointers in[k * components]. Quaternions
+        // (components is 4) in the opposite hemisphere of in[0][i] are negated and the
+        // sum is normalized. The output may be equal to one of the inputs.
+        void (*soa_blend)(f32 const* const* in, f32 const* weights, i64 input_count, i64 components, f32* const* out, i64 count);
+
+        // Transposition between arrays of structures of components floats and
+        // components arrays of count floats (components is 3, 4 or 16). The input
+        // must not overlap the output.
+        //
+        // out[c][i] = in[components * i + c]
+        void (*aos_to_soa)(f32 const* in, i64 components, f32* const* out, i64 count);
+        // out[components * i + c] = in[c][i]
+        void (*soa_to_aos)(f32 const* const* in, i64 components, f32* out, i64 count);
+
+        // out[i] = function(in[i])
+        void (*unary_function)(Unary_Function function, f32 const* in, f32* out, i64 count);
+        // out[i] = function(a[i], b[i])
+        void (*binary_function)(Binary_Function function, f32 const* a, f32 const* b, f32* out, i64 count);
+        // sin[i] = sin(in[i]), cos[i] = cos(in[i])
+        void (*sincos)(f32 const* in, f32* sin, f32* cos, i64 count);
+    };
+
+    extern Kernels const kernels_scalar;
+    extern Kernels const kernels_sse2;
+    extern Kernels const kernels_avx2;
+    extern Kernels const kernels_avx512;
+    // Kernels that measure and forward to the kernels of the selected instruction
+    // set. Defined only when the library is built with ANTON_MATH_PROFILE.
+    extern Kernels const kernels_profiled;
+
+    // get_kernels
+    // Kernels of instruction_set. Falls back to the scalar kernels if the kernels of
+    // instruction_set have not been compiled into the library.
+    //
+    [[nodiscard]] Kernels const& get_kernels(Instruction_Set instruction_set);
+
+    // get_kernels
+    // Kernels of the currently selected instruction set or, when the library is built
+    // with ANTON_MATH_PROFILE, kernels_profiled.
+    //
+    [[nodiscard]] Kernels const& get_kernels();
+} // namespace anton::math::detail
@@ -0,0 +1,2768 @@
+// Shared source of the array kernels. Included once by each kernels_<instruction set>.cpp,
+// which defines:
+//   ANTON_MATH_KERNEL_ISA   - name of the instruction set (scalar, sse2, avx2 or avx512).
+//   ANTON_MATH_KERNEL_LEVEL - 0 for scalar, 1 for sse2, 2 for avx2 and 3 for avx512.
+//
+// The translation units are compiled with instruction set specific flags. Every function
+// defined here lives in a namespace named after the instruction set. Kernels must not
+// call inline functions defined outside of that namespace (e.g. the operators of Vec4 or
+// Mat4 when ANTON_MATH_INLINE is enabled) since the linker may pick the copy compiled for
+// a newer instruction set and use it in the whole program.
+
+#include <anton/types.hpp>
+#include <anton/math/math.hpp>
+#include <anton/math/detail/libm.hpp>
+#include <detail/kernels.hpp>
+
+#if !defined(ANTON_MATH_KERNEL_ISA) || !defined(ANTON_MATH_KERNEL_LEVEL)
+#    error "ANTON_MATH_KERNEL_ISA and ANTON_MATH_KERNEL_LEVEL must be defined before including kernels_impl.hpp."
+#endif
+
+#if ANTON_MATH_KERNEL_LEVEL >= 3 && !defined(__AVX512F__)
+#    error "kernels_avx512.cpp must be compiled with AVX-512F enabled."
+#endif
+
+#if ANTON_MATH_KERNEL_LEVEL >= 2 && (!defined(__AVX2__) || !(defined(__FMA__) || defined(_MSC_VER)))
+#    error "kernels_avx2.cpp must be compiled with AVX2 and FMA enabled."
+#endif
+
+#if ANTON_MATH_KERNEL_LEVEL >= 2
+#    include <immintrin.h>
+#elif ANTON_MATH_KERNEL_LEVEL >= 1
+#    include <emmintrin.h>
+#endif
+
+#define ANTON_MATH_KERNEL_CONCAT_IMPL(a, b) a##b
+#define ANTON_MATH_KERNEL_CONCAT(a, b) ANTON_MATH_KERNEL_CONCAT_IMPL(a, b)
+
+namespace anton::math::detail::ANTON_MATH_KERNEL_ISA {
+    // Vectors and matrices are accessed through f32 pointers with a stride equal
+    // to their number of components. They are not required to be aligned.
+    template<typename T>
+    [[nodiscard]] static f32 const* elements(T const* p) {
+        return reinterpret_cast<f32 const*>(p);
+    }
+
+    template<typename T>
+    [[nodiscard]] static f32* elements(T* p) {
+        return reinterpret_cast<f32*>(p);
+    }
+
+    // Vf
+    // The widest f32 vector of the instruction set. Kernels written in terms of Vf
+    // and the functions below process lanes elements at a time.
+    //
+#if ANTON_MATH_KERNEL_LEVEL >= 3
+    using Vf = __m512;
+    constexpr i64 lanes = 16;
+
+    [[nodiscard]] static Vf set1(f32 const v) {
+        return _mm512_set1_ps(v);
+    }
+
+    [[nodiscard]] static Vf loadu(f32 const* const p) {
+        return _mm512_loadu_ps(p);
+    }
+
+    static void storeu(f32* const p, Vf const v) {
+        _mm512_storeu_ps(p, v);
+    }
+
+    [[nodiscard]] static Vf add(Vf const a, Vf const b) {
+        return _mm512_add_ps(a, b);
+    }
+
+    [[nodiscard]] static Vf sub(Vf const a, Vf const b) {
+        return _mm512_sub_ps(a, b);
+    }
+
+    [[nodiscard]] static Vf mul(Vf const a, Vf const b) {
+        return _mm512_mul_ps(a, b);
+    }
+
+    [[nodiscard]] static Vf div(Vf const a, Vf const b) {
+        return _mm512_div_ps(a, b);
+    }
+
+    // a * b + c
+    [[nodiscard]] static Vf fmadd(Vf const a, Vf const b, Vf const c) {
+        return _mm512_fmadd_ps(a, b, c);
+    }
+#elif ANTON_MATH_KERNEL_LEVEL >= 2
+    using Vf = __m256;
+    constexpr i64 lanes = 8;
+
+    [[nodiscard]] static Vf set1(f32 const v) {
+        return _mm256_set1_ps(v);
+    }
+
+    [[nodiscard]] static Vf loadu(f32 const* const p) {
+        return _mm256_loadu_ps(p);
+    }
+
+    static void storeu(f32* const p, Vf const v) {
+        _mm256_storeu_ps(p, v);
+    }
+
+    [[nodiscard]] static Vf add(Vf const a, Vf const b) {
+        return _mm256_add_ps(a, b);
+    }
+
+    [[nodiscard]] static Vf sub(Vf const a, Vf const b) {
+        return _mm256_sub_ps(a, b);
+    }
+
+    [[nodiscard]] static Vf mul(Vf const a, Vf const b) {
+        return _mm256_mul_ps(a, b);
+    }
+
+    [[nodiscard]] static Vf div(Vf const a, Vf const b) {
+        return _mm256_div_ps(a, b);
+    }
+
+    // a * b + c
+    [[nodiscard]] static Vf fmadd(Vf const a, Vf const b, Vf const c) {
+        return _mm256_fmadd_ps(a, b, c);
+    }
+#elif ANTON_MATH_KERNEL_LEVEL >= 1
+    using Vf = __m128;
+    constexpr i64 lanes = 4;
+
+    [[nodiscard]] static Vf set1(f32 const v) {
+        return _mm_set1_ps(v);
+    }
+
+    [[nodiscard]] static Vf loadu(f32 const* const p) {
+        return _mm_loadu_ps(p);
+    }
+
+    static void storeu(f32* const p, Vf const v) {
+        _mm_storeu_ps(p, v);
+    }
+
+    [[nodiscard]] static Vf add(Vf const a, Vf const b) {
+        return _mm_add_ps(a, b);
+    }
+
+    [[nodiscard]] static Vf sub(Vf const a, Vf const b) {
+        return _mm_sub_ps(a, b);
+    }
+
+    [[nodiscard]] static Vf mul(Vf const a, Vf const b) {
+        return _mm_mul_ps(a, b);
+    }
+
+    [[nodiscard]] static Vf div(Vf const a, Vf const b) {
+        return _mm_div_ps(a, b);
+    }
+
+    // a * b + c
+    [[nodiscard]] static Vf fmadd(Vf const a, Vf const b, Vf const c) {
+        return _mm_add_ps(_mm_mul_ps(a, b), c);
+    }
+#else
+    using Vf = f32;
+    constexpr i64 lanes = 1;
+
+    [[nodiscard]] static Vf set1(f32 const v) {
+        return v;
+    }
+
+    [[nodiscard]] static Vf loadu(f32 const* const p) {
+        return *p;
+    }
+
+    static void storeu(f32* const p, Vf const v) {
+        *p = v;
+    }
+
+    [[nodiscard]] static Vf add(Vf const a, Vf const b) {
+        return a + b;
+    }
+
+    [[nodiscard]] static Vf sub(Vf const a, Vf const b) {
+        return a - b;
+    }
+
+    [[nodiscard]] static Vf mul(Vf const a, Vf const b) {
+        return a * b;
+    }
+
+    [[nodiscard]] static Vf div(Vf const a, Vf const b) {
+        return a / b;
+    }
+
+    // a * b + c
+    [[nodiscard]] static Vf fmadd(Vf const a, Vf const b, Vf const c) {
+        return a * b + c;
+    }
+#endif
+
+    // load_vec3
+    // Loads lanes consecutive Vec3 from p and transposes them into x, y and z.
+    //
+    // store_vec3
+    // Transposes x, y and z and stores them as lanes consecutive Vec3 to p.
+    //
+#if ANTON_MATH_KERNEL_LEVEL >= 3
+    // Indices for _mm512_permutex2var_ps. Values >= 16 select from the second source.
+    // The first permute gathers the components from the first 32 floats, the second
+    // one merges in the remaining components from the last 16 floats.
+    alignas(64) static constexpr i32 vec3_gather_x0[16] = {0, 3, 6, 9, 12, 15, 18, 21, 24, 27, 30, 0, 0, 0, 0, 0};
+    alignas(64) static constexpr i32 vec3_gather_x1[16] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 17, 20, 23, 26, 29};
+    alignas(64) static constexpr i32 vec3_gather_y0[16] = {1, 4, 7, 10, 13, 16, 19, 22, 25, 28, 31, 0, 0, 0, 0, 0};
+    alignas(64) static constexpr i32 vec3_gather_y1[16] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 18, 21, 24, 27, 30};
+    alignas(64) static constexpr i32 vec3_gather_z0[16] = {2, 5, 8, 11, 14, 17, 20, 23, 26, 29, 0, 0, 0, 0, 0, 0};
+    alignas(64) static constexpr i32 vec3_gather_z1[16] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 16, 19, 22, 25, 28, 31};
+    // Inverse of the above. a, b and c are the 3 vectors of the output.
+    alignas(64) static constexpr i32 vec3_scatter_a0[16] = {0, 16, 0, 1, 17, 0, 2, 18, 0, 3, 19, 0, 4, 20, 0, 5};
+    alignas(64) static constexpr i32 vec3_scatter_a1[16] = {0, 1, 16, 3, 4, 17, 6, 7, 18, 9, 10, 19, 12, 13, 20, 15};
+    alignas(64) static constexpr i32 vec3_scatter_b0[16] = {5, 21, 0, 6, 22, 0, 7, 23, 0, 8, 24, 0, 9, 25, 0, 10};
+    alignas(64) static constexpr i32 vec3_scatter_b1[16] = {0, 1, 22, 3, 4, 23, 6, 7, 24, 9, 10, 25, 12, 13, 26, 15};
+    alignas(64) static constexpr i32 vec3_scatter_c0[16] = {0, 11, 27, 0, 12, 28, 0, 13, 29, 0, 14, 30, 0, 15, 31, 0};
+    alignas(64) static constexpr i32 vec3_scatter_c1[16] = {26, 1, 2, 27, 4, 5, 28, 7, 8, 29, 10, 11, 30, 13, 14, 31};
+
+    static void load_vec3(f32 const* const p, Vf& x, Vf& y, Vf& z) {
+        __m512 const a = _mm512_loadu_ps(p);
+        __m512 const b = _mm512_loadu_ps(p + 16);
+        __m512 const c = _mm512_loadu_ps(p + 32);
+        x = _mm512_permutex2var_ps(_mm512_permutex2var_ps(a, _mm512_load_si512(vec3_gather_x0), b), _mm512_load_si512(vec3_gather_x1), c);
+        y = _mm512_permutex2var_ps(_mm512_permutex2var_ps(a, _mm512_load_si512(vec3_gather_y0), b), _mm512_load_si512(vec3_gather_y1), c);
+        z = _mm512_permutex2var_ps(_mm512_permutex2var_ps(a, _mm512_load_si512(vec3_gather_z0), b), _mm512_load_si512(vec3_gather_z1), c);
+    }
+
+    static void store_vec3(f32* const p, Vf const x, Vf const y, Vf const z) {
+        __m512 const a = _mm512_permutex2var_ps(_mm512_permutex2var_ps(x, _mm512_load_si512(vec3_scatter_a0), y), _mm512_load_si512(vec3_scatter_a1), z);
+        __m512 const b = _mm512_permutex2var_ps(_mm512_permutex2var_ps(y, _mm512_load_si512(vec3_scatter_b0), z), _mm512_load_si512(vec3_scatter_b1), x);
+        __m512 const c = _mm512_permutex2var_ps(_mm512_permutex2var_ps(x, _mm512_load_si512(vec3_scatter_c0), y), _mm512_load_si512(vec3_scatter_c1), z);
+        _mm512_storeu_ps(p, a);
+        _mm512_storeu_ps(p + 16, b);
+        _mm512_storeu_ps(p + 32, c);
+    }
+#elif ANTON_MATH_KERNEL_LEVEL >= 1
+    // The transposition is performed independently in each 128-bit lane. With
+    // AVX2 the low lane holds the Vec3 0-3 and the high lane holds the Vec3 4-7.
+#    if ANTON_MATH_KERNEL_LEVEL >= 2
+    static void load_vec3(f32 const* const p, Vf& x, Vf& y, Vf& z) {
+        __m256 const m03 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p)), _mm_loadu_ps(p + 12), 1);
+        __m256 const m14 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p + 4)), _mm_loadu_ps(p + 16), 1);
+        __m256 const m25 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p + 8)), _mm_loadu_ps(p + 20), 1);
+#        define ANTON_MATH_SHUFFLE _mm256_shuffle_ps
+#    else
+    static void load_vec3(f32 const* const p, Vf& x, Vf& y, Vf& z) {
+        __m128 const m03 = _mm_loadu_ps(p);
+        __m128 const m14 = _mm_loadu_ps(p + 4);
+        __m128 const m25 = _mm_loadu_ps(p + 8);
+#        define ANTON_MATH_SHUFFLE _mm_shuffle_ps
+#    endif
+        // x1 y2 x3 y3 (per lane)
+        Vf const xy = ANTON_MATH_SHUFFLE(m14, m25, _MM_SHUFFLE(2, 1, 3, 2));
+        // y0 z0 y1 z1
+        Vf const yz = ANTON_MATH_SHUFFLE(m03, m14, _MM_SHUFFLE(1, 0, 2, 1));
+        x = ANTON_MATH_SHUFFLE(m03, xy, _MM_SHUFFLE(2, 0, 3, 0));
+        y = ANTON_MATH_SHUFFLE(yz, xy, _MM_SHUFFLE(3, 1, 2, 0));
+        z = ANTON_MATH_SHUFFLE(yz, m25, _MM_SHUFFLE(3, 0, 3, 1));
+    }
+
+    static void store_vec3(f32* const p, Vf const x, Vf const y, Vf const z) {
+        Vf const rxy = ANTON_MATH_SHUFFLE(x, y, _MM_SHUFFLE(2, 0, 2, 0));
+        Vf const ryz = ANTON_MATH_SHUFFLE(y, z, _MM_SHUFFLE(3, 1, 3, 1));
+        Vf const rzx = ANTON_MATH_SHUFFLE(z, x, _MM_SHUFFLE(3, 1, 2, 0));
+        Vf const r03 = ANTON_MATH_SHUFFLE(rxy, rzx, _MM_SHUFFLE(2, 0, 2, 0));
+        Vf const r14 = ANTON_MATH_SHUFFLE(ryz, rxy, _MM_SHUFFLE(3, 1, 2, 0));
+        Vf const r25 = ANTON_MATH_SHUFFLE(rzx, ryz, _MM_SHUFFLE(3, 1, 3, 1));
+#    undef ANTON_MATH_SHUFFLE
+#    if ANTON_MATH_KERNEL_LEVEL >= 2
+        _mm_storeu_ps(p, _mm256_castps256_ps128(r03));
+        _mm_storeu_ps(p + 4, _mm256_castps256_ps128(r14));
+        _mm_storeu_ps(p + 8, _mm256_castps256_ps128(r25));
+        _mm_storeu_ps(p + 12, _mm256_extractf128_ps(r03, 1));
+        _mm_storeu_ps(p + 16, _mm256_extractf128_ps(r14, 1));
+        _mm_storeu_ps(p + 20, _mm256_extractf128_ps(r25, 1));
+#    else
+        _mm_storeu_ps(p, r03);
+        _mm_storeu_ps(p + 4, r14);
+        _mm_storeu_ps(p + 8, r25);
+#    endif
+    }
+#else
+    static void load_vec3(f32 const* const p, Vf& x, Vf& y, Vf& z) {
+        x = p[0];
+        y = p[1];
+        z = p[2];
+    }
+
+    static void store_vec3(f32* const p, Vf const x, Vf const y, Vf const z) {
+        p[0] = x;
+        p[1] = y;
+        p[2] = z;
+    }
+#endif
+
+#if ANTON_MATH_KERNEL_LEVEL >= 1
+    // The following functions operate independently on each 128-bit lane of Vf and
+    // behave like their SSE counterparts.
+
+    // shuffle
+    // (a[imm[1:0]], a[imm[3:2]], b[imm[5:4]], b[imm[7:6]]) in each lane.
+    //
+    template<i32 imm>
+    [[nodiscard]] static Vf shuffle(Vf const a, Vf const b) {
+#    if ANTON_MATH_KERNEL_LEVEL >= 3
+        return _mm512_shuffle_ps(a, b, imm);
+#    elif ANTON_MATH_KERNEL_LEVEL >= 2
+        return _mm256_shuffle_ps(a, b, imm);
+#    else
+        return _mm_shuffle_ps(a, b, imm);
+#    endif
+    }
+
+    // (a0, b0, a1, b1) in each lane.
+    [[nodiscard]] static Vf unpacklo(Vf const a, Vf const b) {
+#    if ANTON_MATH_KERNEL_LEVEL >= 3
+        return _mm512_unpacklo_ps(a, b);
+#    elif ANTON_MATH_KERNEL_LEVEL >= 2
+        return _mm256_unpacklo_ps(a, b);
+#    else
+        return _mm_unpacklo_ps(a, b);
+#    endif
+    }
+
+    // (a2, b2, a3, b3) in each lane.
+    [[nodiscard]] static Vf unpackhi(Vf const a, Vf const b) {
+#    if ANTON_MATH_KERNEL_LEVEL >= 3
+        return _mm512_unpackhi_ps(a, b);
+#    elif ANTON_MATH_KERNEL_LEVEL >= 2
+        return _mm256_unpackhi_ps(a, b);
+#    else
+        return _mm_unpackhi_ps(a, b);
+#    endif
+    }
+
+    // Sum of the components of each lane broadcast to the components of the lane.
+    [[nodiscard]] static Vf lane_sum(Vf const v) {
+        Vf const s = add(v, shuffle<_MM_SHUFFLE(2, 3, 0, 1)>(v, v));
+        return add(s, shuffle<_MM_SHUFFLE(1, 0, 3, 2)>(s, s));
+    }
+
+    // Number of Vec4 or Mat4 columns that fit in Vf.
+    constexpr i64 vec4_lanes = lanes / 4;
+
+    // load_columns
+    // Loads 4 * vec4_lanes Vec4 located stride floats apart from p. c[k] holds the
+    // (4 * i + k)-th Vec4 in the i-th lane, which with the default stride is the k-th
+    // column of the i-th of vec4_lanes consecutive Mat4.
+    //
+    // store_columns
+    // Inverse of load_columns.
+    //
+    // transpose4
+    // Transposes the 4x4 matrix formed by v in each lane.
+    //
+    template<i64 stride = 4>
+    static void load_columns(f32 const* const p, Vf (&c)[4]) {
+        for(i64 k = 0; k < 4; ++k) {
+#    if ANTON_MATH_KERNEL_LEVEL >= 3
+            __m512 v = _mm512_castps128_ps512(_mm_loadu_ps(p + stride * k));
+            v = _mm512_insertf32x4(v, _mm_loadu_ps(p + stride * (4 + k)), 1);
+            v = _mm512_insertf32x4(v, _mm_loadu_ps(p + stride * (8 + k)), 2);
+            c[k] = _mm512_insertf32x4(v, _mm_loadu_ps(p + stride * (12 + k)), 3);
+#    elif ANTON_MATH_KERNEL_LEVEL >= 2
+            c[k] = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p + stride * k)), _mm_loadu_ps(p + stride * (4 + k)), 1);
+#    else
+            c[k] = _mm_loadu_ps(p + stride * k);
+#    endif
+        }
+    }
+
+    template<i64 stride = 4>
+    static void store_columns(f32* const p, Vf const (&c)[4]) {
+        for(i64 k = 0; k < 4; ++k) {
+#    if ANTON_MATH_KERNEL_LEVEL >= 3
+            _mm_storeu_ps(p + stride * k, _mm512_castps512_ps128(c[k]));
+            _mm_storeu_ps(p + stride * (4 + k), _mm512_extractf32x4_ps(c[k], 1));
+            _mm_storeu_ps(p + stride * (8 + k), _mm512_extractf32x4_ps(c[k], 2));
+            _mm_storeu_ps(p + stride * (12 + k), _mm512_extractf32x4_ps(c[k], 3));
+#    elif ANTON_MATH_KERNEL_LEVEL >= 2
+            _mm_storeu_ps(p + stride * k, _mm256_castps256_ps128(c[k]));
+            _mm_storeu_ps(p + stride * (4 + k), _mm256_extractf128_ps(c[k], 1));
+#    else
+            _mm_storeu_ps(p + stride * k, c[k]);
+#    endif
+        }
+    }
+
+    static void transpose4(Vf (&v)[4]) {
+        Vf const t0 = unpacklo(v[0], v[1]);
+        Vf const t1 = unpacklo(v[2], v[3]);
+        Vf const t2 = unpackhi(v[0], v[1]);
+        Vf const t3 = unpackhi(v[2], v[3]);
+        v[0] = shuffle<_MM_SHUFFLE(1, 0, 1, 0)>(t0, t1);
+        v[1] = shuffle<_MM_SHUFFLE(3, 2, 3, 2)>(t0, t1);
+        v[2] = shuffle<_MM_SHUFFLE(1, 0, 1, 0)>(t2, t3);
+        v[3] = shuffle<_MM_SHUFFLE(3, 2, 3, 2)>(t2, t3);
+    }
+#endif
+
+    // Mf
+    // Result of a comparison of two Vf, one bit or one lane per element.
+    //
+    // sqrt, greater, select, mask_and, mask_andnot, mask_or, abs, min, max
+    // select(m, a, b) is m ? a : b and mask_andnot(a, b) is !a && b. min(a, b) is
+    // a < b ? a : b and max(a, b) is a > b ? a : b like min and max of Vec3.
+    //
+#if ANTON_MATH_KERNEL_LEVEL >= 3
+    using Mf = __mmask16;
+
+    [[nodiscard]] static Vf sqrt(Vf const v) {
+        return _mm512_sqrt_ps(v);
+    }
+
+    [[nodiscard]] static Mf greater(Vf const a, Vf const b) {
+        return _mm512_cmp_ps_mask(a, b, _CMP_GT_OQ);
+    }
+
+    [[nodiscard]] static Vf select(Mf const m, Vf const a, Vf const b) {
+        return _mm512_mask_blend_ps(m, b, a);
+    }
+
+    [[nodiscard]] static Mf mask_and(Mf const a, Mf const b) {
+        return (Mf)(a & b);
+    }
+
+    [[nodiscard]] static Mf mask_andnot(Mf const a, Mf const b) {
+        return (Mf)(~a & b);
+    }
+
+    [[nodiscard]] static Mf mask_or(Mf const a, Mf const b) {
+        return (Mf)(a | b);
+    }
+
+    [[nodiscard]] static Vf abs(Vf const v) {
+        return _mm512_castsi512_ps(_mm512_and_si512(_mm512_castps_si512(v), _mm512_set1_epi32(0x7FFFFFFF)));
+    }
+
+    [[nodiscard]] static Vf min(Vf const a, Vf const b) {
+        return _mm512_min_ps(a, b);
+    }
+
+    [[nodiscard]] static Vf max(Vf const a, Vf const b) {
+        return _mm512_max_ps(a, b);
+    }
+#elif ANTON_MATH_KERNEL_LEVEL >= 2
+    using Mf = __m256;
+
+    [[nodiscard]] static Vf sqrt(Vf const v) {
+        return _mm256_sqrt_ps(v);
+    }
+
+    [[nodiscard]] static Mf greater(Vf const a, Vf const b) {
+        return _mm256_cmp_ps(a, b, _CMP_GT_OQ);
+    }
+
+    [[nodiscard]] static Vf select(Mf const m, Vf const a, Vf const b) {
+        return _mm256_blendv_ps(b, a, m);
+    }
+
+    [[nodiscard]] static Mf mask_and(Mf const a, Mf const b) {
+        return _mm256_and_ps(a, b);
+    }
+
+    [[nodiscard]] static Mf mask_andnot(Mf const a, Mf const b) {
+        return _mm256_andnot_ps(a, b);
+    }
+
+    [[nodiscard]] static Mf mask_or(Mf const a, Mf const b) {
+        return _mm256_or_ps(a, b);
+    }
+
+    [[nodiscard]] static Vf abs(Vf const v) {
+        return _mm256_and_ps(v, _mm256_castsi256_ps(_mm256_set1_epi32(0x7FFFFFFF)));
+    }
+
+    [[nodiscard]] static Vf min(Vf const a, Vf const b) {
+        return _mm256_min_ps(a, b);
+    }
+
+    [[nodiscard]] static Vf max(Vf const a, Vf const b) {
+        return _mm256_max_ps(a, b);
+    }
+#elif ANTON_MATH_KERNEL_LEVEL >= 1
+    using Mf = __m128;
+
+    [[nodiscard]] static Vf sqrt(Vf const v) {
+        return _mm_sqrt_ps(v);
+    }
+
+    [[nodiscard]] static Mf greater(Vf const a, Vf const b) {
+        return _mm_cmpgt_ps(a, b);
+    }
+
+    [[nodiscard]] static Vf select(Mf const m, Vf const a, Vf const b) {
+        return _mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b));
+    }
+
+    [[nodiscard]] static Mf mask_and(Mf const a, Mf const b) {
+        return _mm_and_ps(a, b);
+    }
+
+    [[nodiscard]] static Mf mask_andnot(Mf const a, Mf const b) {
+        return _mm_andnot_ps(a, b);
+    }
+
+    [[nodiscard]] static Mf mask_or(Mf const a, Mf const b) {
+        return _mm_or_ps(a, b);
+    }
+
+    [[nodiscard]] static Vf abs(Vf const v) {
+        return _mm_and_ps(v, _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF)));
+    }
+
+    [[nodiscard]] static Vf min(Vf const a, Vf const b) {
+        return _mm_min_ps(a, b);
+    }
+
+    [[nodiscard]] static Vf max(Vf const a, Vf const b) {
+        return _mm_max_ps(a, b);
+    }
+#else
+    using Mf = bool;
+
+    [[nodiscard]] static Vf sqrt(Vf const v) {
+        return math::sqrt(v);
+    }
+
+    [[nodiscard]] static Mf greater(Vf const a, Vf const b) {
+        return a > b;
+    }
+
+    [[nodiscard]] static Vf select(Mf const m, Vf const a, Vf const b) {
+        return m ? a : b;
+    }
+
+    [[nodiscard]] static Mf mask_and(Mf const a, Mf const b) {
+        return a && b;
+    }
+
+    [[nodiscard]] static Mf mask_andnot(Mf const a, Mf const b) {
+        return !a && b;
+    }
+
+    [[nodiscard]] static Mf mask_or(Mf const a, Mf const b) {
+        return a || b;
+    }
+
+    [[nodiscard]] static Vf abs(Vf const v) {
+        return v < 0.0f ? -v : v;
+    }
+
+    [[nodiscard]] static Vf min(Vf const a, Vf const b) {
+        return a < b ? a : b;
+    }
+
+    [[nodiscard]] static Vf max(Vf const a, Vf const b) {
+        return a > b ? a : b;
+    }
+#endif
+
+    // Vi
+    // i32 vector with the same number of lanes as Vf.
+    //
+    // as_i32, as_f32
+    // Reinterpret the bits of a vector.
+    //
+    // to_i32
+    // Converts to the nearest integer. The result is unspecified if the value does
+    // not fit in i32.
+    //
+    // to_f32
+    // Converts to f32.
+    //
+    // shift_left, shift_right
+    // Logical shifts of each lane.
+    //
+    // test_bits
+    // (v & bits) == bits.
+    //
+    // mask_bits
+    // Bit i of the result is set if the i-th lane of m is set.
+    //
+#if ANTON_MATH_KERNEL_LEVEL >= 3
+    using Vi = __m512i;
+
+    [[nodiscard]] static Vi set1_i32(i32 const v) {
+        return _mm512_set1_epi32(v);
+    }
+
+    [[nodiscard]] static Vi as_i32(Vf const v) {
+        return _mm512_castps_si512(v);
+    }
+
+    [[nodiscard]] static Vf as_f32(Vi const v) {
+        return _mm512_castsi512_ps(v);
+    }
+
+    [[nodiscard]] static Vi to_i32(Vf const v) {
+        return _mm512_cvtps_epi32(v);
+    }
+
+    [[nodiscard]] static Vf to_f32(Vi const v) {
+        return _mm512_cvtepi32_ps(v);
+    }
+
+    [[nodiscard]] static Vi add(Vi const a, Vi const b) {
+        return _mm512_add_epi32(a, b);
+    }
+
+    [[nodiscard]] static Vi sub(Vi const a, Vi const b) {
+        return _mm512_sub_epi32(a, b);
+    }
+
+    [[nodiscard]] static Vi bit_and(Vi const a, Vi const b) {
+        return _mm512_and_si512(a, b);
+    }
+
+    [[nodiscard]] static Vi bit_or(Vi const a, Vi const b) {
+        return _mm512_or_si512(a, b);
+    }
+
+    [[nodiscard]] static Vi bit_xor(Vi const a, Vi const b) {
+        return _mm512_xor_si512(a, b);
+    }
+
+    template<i32 n>
+    [[nodiscard]] static Vi shift_left(Vi const v) {
+        return _mm512_slli_epi32(v, n);
+    }
+
+    template<i32 n>
+    [[nodiscard]] static Vi shift_right(Vi const v) {
+        return _mm512_srli_epi32(v, n);
+    }
+
+    [[nodiscard]] static Mf test_bits(Vi const v, i32 const bits) {
+        Vi const b = _mm512_set1_epi32(bits);
+        return _mm512_cmpeq_epi32_mask(_mm512_and_si512(v, b), b);
+    }
+
+    [[nodiscard]] static u32 mask_bits(Mf const m) {
+        return m;
+    }
+#elif ANTON_MATH_KERNEL_LEVEL >= 2
+    using Vi = __m256i;
+
+    [[nodiscard]] static Vi set1_i32(i32 const v) {
+        return _mm256_set1_epi32(v);
+    }
+
+    [[nodiscard]] static Vi as_i32(Vf const v) {
+        return _mm256_castps_si256(v);
+    }
+
+    [[nodiscard]] static Vf as_f32(Vi const v) {
+        return _mm256_castsi256_ps(v);
+    }
+
+    [[nodiscard]] static Vi to_i32(Vf const v) {
+        return _mm256_cvtps_epi32(v);
+    }
+
+    [[nodiscard]] static Vf to_f32(Vi const v) {
+        return _mm256_cvtepi32_ps(v);
+    }
+
+    [[nodiscard]] static Vi add(Vi const a, Vi const b) {
+        return _mm256_add_epi32(a, b);
+    }
+
+    [[nodiscard]] static Vi sub(Vi const a, Vi const b) {
+        return _mm256_sub_epi32(a, b);
+    }
+
+    [[nodiscard]] static Vi bit_and(Vi const a, Vi const b) {
+        return _mm256_and_si256(a, b);
+    }
+
+    [[nodiscard]] static Vi bit_or(Vi const a, Vi const b) {
+        return _mm256_or_si256(a, b);
+    }
+
+    [[nodiscard]] static Vi bit_xor(Vi const a, Vi const b) {
+        return _mm256_xor_si256(a, b);
+    }
+
+    template<i32 n>
+    [[nodiscard]] static Vi shift_left(Vi const v) {
+        return _mm256_slli_epi32(v, n);
+    }
+
+    template<i32 n>
+    [[nodiscard]] static Vi shift_right(Vi const v) {
+        return _mm256_srli_epi32(v, n);
+    }
+
+    [[nodiscard]] static Mf test_bits(Vi const v, i32 const bits) {
+        Vi const b = _mm256_set1_epi32(bits);
+        return _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(v, b), b));
+    }
+
+    [[nodiscard]] static u32 mask_bits(Mf const m) {
+        return (u32)_mm256_movemask_ps(m);
+    }
+#elif ANTON_MATH_KERNEL_LEVEL >= 1
+    using Vi = __m128i;
+
+    [[nodiscard]] static Vi set1_i32(i32 const v) {
+        return _mm_set1_epi32(v);
+    }
+
+    [[nodiscard]] static Vi as_i32(Vf const v) {
+        return _mm_castps_si128(v);
+    }
+
+    [[nodiscard]] static Vf as_f32(Vi const v) {
+        return _mm_castsi128_ps(v);
+    }
+
+    [[nodiscard]] static Vi to_i32(Vf const v) {
+        return _mm_cvtps_epi32(v);
+    }
+
+    [[nodiscard]] static Vf to_f32(Vi const v) {
+        return _mm_cvtepi32_ps(v);
+    }
+
+    [[nodiscard]] static Vi add(Vi const a, Vi const b) {
+        return _mm_add_epi32(a, b);
+    }
+
+    [[nodiscard]] static Vi sub(Vi const a, Vi const b) {
+        return _mm_sub_epi32(a, b);
+    }
+
+    [[nodiscard]] static Vi bit_and(Vi const a, Vi const b) {
+        return _mm_and_si128(a, b);
+    }
+
+    [[nodiscard]] static Vi bit_or(Vi const a, Vi const b) {
+        return _mm_or_si128(a, b);
+    }
+
+    [[nodiscard]] static Vi bit_xor(Vi const a, Vi const b) {
+        return _mm_xor_si128(a, b);
+    }
+
+    template<i32 n>
+    [[nodiscard]] static Vi shift_left(Vi const v) {
+        return _mm_slli_epi32(v, n);
+    }
+
+    template<i32 n>
+    [[nodiscard]] static Vi shift_right(Vi const v) {
+        return _mm_srli_epi32(v, n);
+    }
+
+    [[nodiscard]] static Mf test_bits(Vi const v, i32 const bits) {
+        Vi const b = _mm_set1_epi32(bits);
+        return _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(v, b), b));
+    }
+
+    [[nodiscard]] static u32 mask_bits(Mf const m) {
+        return (u32)_mm_movemask_ps(m);
+    }
+#else
+    using Vi = i32;
+
+    [[nodiscard]] static Vi set1_i32(i32 const v) {
+        return v;
+    }
+
+    [[nodiscard]] static Vi as_i32(Vf const v) {
+        return __builtin_bit_cast(i32, v);
+    }
+
+    [[nodiscard]] static Vf as_f32(Vi const v) {
+        return __builtin_bit_cast(f32, v);
+    }
+
+    [[nodiscard]] static Vi to_i32(Vf const v) {
+        // Clamp to avoid the undefined conversion of values outside of i32. Adding
+        // and subtracting 1.5 * 2^23 rounds to nearest even like cvtps2dq.
+        Vf const clamped = max(min(v, 4194304.0f), -4194304.0f);
+        return (i32)((clamped + 12582912.0f) - 12582912.0f);
+    }
+
+    [[nodiscard]] static Vf to_f32(Vi const v) {
+        return (f32)v;
+    }
+
+    [[nodiscard]] static Vi add(Vi const a, Vi const b) {
+        return (i32)((u32)a + (u32)b);
+    }
+
+    [[nodiscard]] static Vi sub(Vi const a, Vi const b) {
+        return (i32)((u32)a - (u32)b);
+    }
+
+    [[nodiscard]] static Vi bit_and(Vi const a, Vi const b) {
+        return a & b;
+    }
+
+    [[nodiscard]] static Vi bit_or(Vi const a, Vi const b) {
+        return a | b;
+    }
+
+    [[nodiscard]] static Vi bit_xor(Vi const a, Vi const b) {
+        return a ^ b;
+    }
+
+    template<i32 n>
+    [[nodiscard]] static Vi shift_left(Vi const v) {
+        return (i32)((u32)v << n);
+    }
+
+    template<i32 n>
+    [[nodiscard]] static Vi shift_right(Vi const v) {
+        return (i32)((u32)v >> n);
+    }
+
+    [[nodiscard]] static Mf test_bits(Vi const v, i32 const bits) {
+        return (v & bits) == bits;
+    }
+
+    [[nodiscard]] static u32 mask_bits(Mf const m) {
+        return m;
+    }
+#endif
+
+    // Vd
+    // f64 vector holding half of the lanes of Vf. Vf is converted to f64_parts Vd.
+    //
+    // to_f64
+    // Converts the lanes of v to f64, the low lanes into d[0].
+    //
+    // to_f32
+    // Inverse of to_f64.
+    //
+#if ANTON_MATH_KERNEL_LEVEL >= 3
+    using Vd = __m512d;
+    constexpr i64 f64_parts = 2;
+
+    [[nodiscard]] static Vd set1_f64(f64 const v) {
+        return _mm512_set1_pd(v);
+    }
+
+    static void to_f64(Vf const v, Vd (&d)[f64_parts]) {
+        d[0] = _mm512_cvtps_pd(_mm512_castps512_ps256(v));
+        d[1] = _mm512_cvtps_pd(_mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(v), 1)));
+    }
+
+    [[nodiscard]] static Vf to_f32(Vd const (&d)[f64_parts]) {
+        __m512d const lo = _mm512_castps_pd(_mm512_castps256_ps512(_mm512_cvtpd_ps(d[0])));
+        return _mm512_castpd_ps(_mm512_insertf64x4(lo, _mm256_castps_pd(_mm512_cvtpd_ps(d[1])), 1));
+    }
+
+    [[nodiscard]] static Vd add(Vd const a, Vd const b) {
+        return _mm512_add_pd(a, b);
+    }
+
+    [[nodiscard]] static Vd sub(Vd const a, Vd const b) {
+        return _mm512_sub_pd(a, b);
+    }
+
+    [[nodiscard]] static Vd mul(Vd const a, Vd const b) {
+        return _mm512_mul_pd(a, b);
+    }
+
+    [[nodiscard]] static Vd div(Vd const a, Vd const b) {
+        return _mm512_div_pd(a, b);
+    }
+
+    [[nodiscard]] static Vd fmadd(Vd const a, Vd const b, Vd const c) {
+        return _mm512_fmadd_pd(a, b, c);
+    }
+#elif ANTON_MATH_KERNEL_LEVEL >= 2
+    using Vd = __m256d;
+    constexpr i64 f64_parts = 2;
+
+    [[nodiscard]] static Vd set1_f64(f64 const v) {
+        return _mm256_set1_pd(v);
+    }
+
+    static void to_f64(Vf const v, Vd (&d)[f64_parts]) {
+        d[0] = _mm256_cvtps_pd(_mm256_castps256_ps128(v));
+        d[1] = _mm256_cvtps_pd(_mm256_extractf128_ps(v, 1));
+    }
+
+    [[nodiscard]] static Vf to_f32(Vd const (&d)[f64_parts]) {
+        return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm256_cvtpd_ps(d[0])), _mm256_cvtpd_ps(d[1]), 1);
+    }
+
+    [[nodiscard]] static Vd add(Vd const a, Vd const b) {
+        return _mm256_add_pd(a, b);
+    }
+
+    [[nodiscard]] static Vd sub(Vd const a, Vd const b) {
+        return _mm256_sub_pd(a, b);
+    }
+
+    [[nodiscard]] static Vd mul(Vd const a, Vd const b) {
+        return _mm256_mul_pd(a, b);
+    }
+
+    [[nodiscard]] static Vd div(Vd const a, Vd const b) {
+        return _mm256_div_pd(a, b);
+    }
+
+    [[nodiscard]] static Vd fmadd(Vd const a, Vd const b, Vd const c) {
+        return _mm256_fmadd_pd(a, b, c);
+    }
+#elif ANTON_MATH_KERNEL_LEVEL >= 1
+    using Vd = __m128d;
+    constexpr i64 f64_parts = 2;
+
+    [[nodiscard]] static Vd set1_f64(f64 const v) {
+        return _mm_set1_pd(v);
+    }
+
+    static void to_f64(Vf const v, Vd (&d)[f64_parts]) {
+        d[0] = _mm_cvtps_pd(v);
+        d[1] = _mm_cvtps_pd(_mm_movehl_ps(v, v));
+    }
+
+    [[nodiscard]] static Vf to_f32(Vd const (&d)[f64_parts]) {
+        return _mm_movelh_ps(_mm_cvtpd_ps(d[0]), _mm_cvtpd_ps(d[1]));
+    }
+
+    [[nodiscard]] static Vd add(Vd const a, Vd const b) {
+        return _mm_add_pd(a, b);
+    }
+
+    [[nodiscard]] static Vd sub(Vd const a, Vd const b) {
+        return _mm_sub_pd(a, b);
+    }
+
+    [[nodiscard]] static Vd mul(Vd const a, Vd const b) {
+        return _mm_mul_pd(a, b);
+    }
+
+    [[nodiscard]] static Vd div(Vd const a, Vd const b) {
+        return _mm_div_pd(a, b);
+    }
+
+    [[nodiscard]] static Vd fmadd(Vd const a, Vd const b, Vd const c) {
+        return _mm_add_pd(_mm_mul_pd(a, b), c);
+    }
+#else
+    using Vd = f64;
+    constexpr i64 f64_parts = 1;
+
+    [[nodiscard]] static Vd set1_f64(f64 const v) {
+        return v;
+    }
+
+    static void to_f64(Vf const v, Vd (&d)[f64_parts]) {
+        d[0] = v;
+    }
+
+    [[nodiscard]] static Vf to_f32(Vd const (&d)[f64_parts]) {
+        return (f32)d[0];
+    }
+
+    [[nodiscard]] static Vd add(Vd const a, Vd const b) {
+        return a + b;
+    }
+
+    [[nodiscard]] static Vd sub(Vd const a, Vd const b) {
+        return a - b;
+    }
+
+    [[nodiscard]] static Vd mul(Vd const a, Vd const b) {
+        return a * b;
+    }
+
+    [[nodiscard]] static Vd div(Vd const a, Vd const b) {
+        return a / b;
+    }
+
+    [[nodiscard]] static Vd fmadd(Vd const a, Vd const b, Vd const c) {
+        return a * b + c;
+    }
+#endif
+
+    // gather
+    // Loads the component-th float of lanes consecutive elements of stride floats.
+    //
+    // scatter
+    // Stores the lanes of v to the component-th float of lanes consecutive elements
+    // of stride floats.
+    //
+    template<i64 stride>
+    [[nodiscard]] static Vf gather(f32 const* const p, i64 const component) {
+#if ANTON_MATH_KERNEL_LEVEL >= 3
+        __m512i const indices = _mm512_mullo_epi32(_mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15), _mm512_set1_epi32((i32)stride));
+        return _mm512_i32gather_ps(indices, p + component, 4);
+#elif ANTON_MATH_KERNEL_LEVEL >= 2
+        __m256i const indices = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32((i32)stride));
+        return _mm256_i32gather_ps(p + component, indices, 4);
+#elif ANTON_MATH_KERNEL_LEVEL >= 1
+        return _mm_setr_ps(p[component], p[stride + component], p[2 * stride + component], p[3 * stride + component]);
+#else
+        return p[component];
+#endif
+    }
+
+    template<i64 stride>
+    static void scatter(f32* const p, i64 const component, Vf const v) {
+#if ANTON_MATH_KERNEL_LEVEL >= 3
+        __m512i const indices = _mm512_mullo_epi32(_mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15), _mm512_set1_epi32((i32)stride));
+        _mm512_i32scatter_ps(p + component, indices, v, 4);
+#else
+        f32 tmp[lanes];
+        storeu(tmp, v);
+        for(i64 l = 0; l < lanes; ++l) {
+            p[l * stride + component] = tmp[l];
+        }
+#endif
+    }
+
+    // for_each_block
+    // Invokes block(in, out) for consecutive blocks of block_size elements, each
+    // consisting of in_stride floats in the input and out_stride floats in the
+    // output. The remainder is copied into a temporary block so that every element
+    // is processed by the same code.
+    //
+    template<i64 in_stride, i64 out_stride, i64 block_size = lanes, typename Block>
+    static void for_each_block(f32 const* in, f32* out, i64 const count, Block const& block) {
+        i64 i = 0;
+        for(; i + block_size <= count; i += block_size, in += block_size * in_stride, out += block_size * out_stride) {
+            block(in, out);
+        }
+
+        i64 const remainder = count - i;
+        if(remainder > 0) {
+            f32 tmp_in[block_size * in_stride] = {};
+            f32 tmp_out[block_size * out_stride] = {};
+            for(i64 e = 0; e < remainder * in_stride; ++e) {
+                tmp_in[e] = in[e];
+            }
+            block(tmp_in, tmp_out);
+            for(i64 e = 0; e < remainder * out_stride; ++e) {
+                out[e] = tmp_out[e];
+            }
+        }
+    }
+
+    // for_each_soa_block
+    // Invokes block(in, out) for consecutive blocks of lanes elements of n_in input
+    // and n_out output arrays of f32. The remainder is copied into temporary blocks
+    // so that every element is processed by the same code.
+    //
+    template<i64 n_in, i64 n_out, typename Block>
+    static void for_each_soa_block(f32 const* const (&in)[n_in], f32* const (&out)[n_out], i64 const count, Block const& block) {
+        i64 i = 0;
+        for(; i + lanes <= count; i += lanes) {
+            f32 const* block_in[n_in];
+            f32* block_out[n_out];
+            for(i64 k = 0; k < n_in; ++k) {
+                block_in[k] = in[k] + i;
+            }
+            for(i64 k = 0; k < n_out; ++k) {
+                block_out[k] = out[k] + i;
+            }
+            block(block_in, block_out);
+        }
+
+        i64 const remainder = count - i;
+        if(remainder > 0) {
+            f32 tmp_in[n_in][lanes] = {};
+            f32 tmp_out[n_out][lanes] = {};
+            f32 const* block_in[n_in];
+            f32* block_out[n_out];
+            for(i64 k = 0; k < n_in; ++k) {
+                for(i64 e = 0; e < remainder; ++e) {
+                    tmp_in[k][e] = in[k][i + e];
+                }
+                block_in[k] = tmp_in[k];
+            }
+            for(i64 k = 0; k < n_out; ++k) {
+                block_out[k] = tmp_out[k];
+            }
+            block(block_in, block_out);
+            for(i64 k = 0; k < n_out; ++k) {
+                for(i64 e = 0; e < remainder; ++e) {
+                    out[k][i + e] = tmp_out[k][e];
+                }
+            }
+        }
+    }
+
+    // mat4_multiply_strided
+    // Multiplies count pairs of matrices. A stride of 0 reuses the same matrix for
+    // every product.
+    //
+    static void mat4_multiply_strided(f32 const* l, i64 const l_stride, f32 const* r, i64 const r_stride, f32* o, i64 const count) {
+        for(i64 i = 0; i < count; ++i, l += l_stride, r += r_stride, o += 16) {
+            // All of lhs and each column of rhs are loaded before the
+            // corresponding column of out is written.
+#if ANTON_MATH_KERNEL_LEVEL >= 3
+            __m512 const c0 = _mm512_broadcast_f32x4(_mm_loadu_ps(l));
+            __m512 const c1 = _mm512_broadcast_f32x4(_mm_loadu_ps(l + 4));
+            __m512 const c2 = _mm512_broadcast_f32x4(_mm_loadu_ps(l + 8));
+            __m512 const c3 = _mm512_broadcast_f32x4(_mm_loadu_ps(l + 12));
+            __m512 const v = _mm512_loadu_ps(r);
+            __m512 result = _mm512_mul_ps(c0, _mm512_permute_ps(v, 0x00));
+            result = _mm512_fmadd_ps(c1, _mm512_permute_ps(v, 0x55), result);
+            result = _mm512_fmadd_ps(c2, _mm512_permute_ps(v, 0xAA), result);
+            result = _mm512_fmadd_ps(c3, _mm512_permute_ps(v, 0xFF), result);
+            _mm512_storeu_ps(o, result);
+#elif ANTON_MATH_KERNEL_LEVEL >= 2
+            __m256 const c0 = _mm256_broadcast_ps((__m128 const*)l);
+            __m256 const c1 = _mm256_broadcast_ps((__m128 const*)(l + 4));
+            __m256 const c2 = _mm256_broadcast_ps((__m128 const*)(l + 8));
+            __m256 const c3 = _mm256_broadcast_ps((__m128 const*)(l + 12));
+            for(i64 c = 0; c < 16; c += 8) {
+                __m256 const v = _mm256_loadu_ps(r + c);
+                __m256 result = _mm256_mul_ps(c0, _mm256_permute_ps(v, 0x00));
+                result = _mm256_fmadd_ps(c1, _mm256_permute_ps(v, 0x55), result);
+                result = _mm256_fmadd_ps(c2, _mm256_permute_ps(v, 0xAA), result);
+                result = _mm256_fmadd_ps(c3, _mm256_permute_ps(v, 0xFF), result);
+                _mm256_storeu_ps(o + c, result);
+            }
+#elif ANTON_MATH_KERNEL_LEVEL >= 1
+            __m128 const c0 = _mm_loadu_ps(l);
+            __m128 const c1 = _mm_loadu_ps(l + 4);
+            __m128 const c2 = _mm_loadu_ps(l + 8);
+            __m128 const c3 = _mm_loadu_ps(l + 12);
+            for(i64 c = 0; c < 16; c += 4) {
+                __m128 const v = _mm_loadu_ps(r + c);
+                __m128 const r0 = _mm_add_ps(_mm_mul_ps(c0, _mm_shuffle_ps(v, v, 0x00)), _mm_mul_ps(c1, _mm_shuffle_ps(v, v, 0x55)));
+                __m128 const r1 = _mm_add_ps(_mm_mul_ps(c2, _mm_shuffle_ps(v, v, 0xAA)), _mm_mul_ps(c3, _mm_shuffle_ps(v, v, 0xFF)));
+                _mm_storeu_ps(o + c, _mm_add_ps(r0, r1));
+            }
+#else
+            f32 a[16];
+            for(i64 e = 0; e < 16; ++e) {
+                a[e] = l[e];
+            }
+            for(i64 c = 0; c < 16; c += 4) {
+                f32 const v0 = r[c];
+                f32 const v1 = r[c + 1];
+                f32 const v2 = r[c + 2];
+                f32 const v3 = r[c + 3];
+                for(i64 e = 0; e < 4; ++e) {
+                    o[c + e] = v0 * a[e] + v1 * a[4 + e] + v2 * a[8 + e] + v3 * a[12 + e];
+                }
+            }
+#endif
+        }
+    }
+
+    static void mat4_multiply(Mat4 const* const lhs, Mat4 const* const rhs, Mat4* const out, i64 const count) {
+        mat4_multiply_strided(elements(lhs), 16, elements(rhs), 16, elements(out), count);
+    }
+
+    static void mat4_multiply_lhs(Mat4 const& lhs, Mat4 const* const rhs, Mat4* const out, i64 const count) {
+        mat4_multiply_strided(elements(&lhs), 0, elements(rhs), 16, elements(out), count);
+    }
+
+    static void mat4_multiply_rhs(Mat4 const* const lhs, Mat4 const& rhs, Mat4* const out, i64 const count) {
+        mat4_multiply_strided(elements(lhs), 16, elements(&rhs), 0, elements(out), count);
+    }
+
+    static void mat4_inverse(Mat4 const* const m, Mat4* const out, i64 const count) {
+#if ANTON_MATH_KERNEL_LEVEL >= 1
+        // The same expansion as below vectorized within each matrix. Each lane of
+        // Vf holds a different matrix. See inverse(Mat4 const&) for the derivation.
+        for_each_block<16, 16, vec4_lanes>(elements(m), elements(out), count, [](f32 const* const src, f32* const dst) {
+            Vf c[4];
+            load_columns(src, c);
+            // (s0, s1, s2, s3), (c0, c1, c2, c3) and (s4, s5, c4, c5).
+            Vf const s03 = sub(mul(shuffle<_MM_SHUFFLE(1, 0, 0, 0)>(c[0], c[0]), shuffle<_MM_SHUFFLE(2, 3, 2, 1)>(c[1], c[1])),
+                               mul(shuffle<_MM_SHUFFLE(1, 0, 0, 0)>(c[1], c[1]), shuffle<_MM_SHUFFLE(2, 3, 2, 1)>(c[0], c[0])));
+            Vf const c03 = sub(mul(shuffle<_MM_SHUFFLE(1, 0, 0, 0)>(c[2], c[2]), shuffle<_MM_SHUFFLE(2, 3, 2, 1)>(c[3], c[3])),
+                               mul(shuffle<_MM_SHUFFLE(1, 0, 0, 0)>(c[3], c[3]), shuffle<_MM_SHUFFLE(2, 3, 2, 1)>(c[2], c[2])));
+            Vf const sc45 = sub(mul(shuffle<_MM_SHUFFLE(2, 1, 2, 1)>(c[0], c[2]), shuffle<_MM_SHUFFLE(3, 3, 3, 3)>(c[1], c[3])),
+                                mul(shuffle<_MM_SHUFFLE(2, 1, 2, 1)>(c[1], c[3]), shuffle<_MM_SHUFFLE(3, 3, 3, 3)>(c[0], c[2])));
+            Vf const k0 = shuffle<_MM_SHUFFLE(0, 0, 0, 0)>(c03, s03);
+            Vf const k1 = shuffle<_MM_SHUFFLE(1, 1, 1, 1)>(c03, s03);
+            Vf const k2 = shuffle<_MM_SHUFFLE(2, 2, 2, 2)>(c03, s03);
+            Vf const k3 = shuffle<_MM_SHUFFLE(3, 3, 3, 3)>(c03, s03);
+            Vf const k4 = shuffle<_MM_SHUFFLE(0, 0, 2, 2)>(sc45, sc45);
+            Vf const k5 = shuffle<_MM_SHUFFLE(1, 1, 3, 3)>(sc45, sc45);
+            Vf const t0 = unpacklo(c[1], c[0]);
+            Vf const t1 = unpacklo(c[3], c[2]);
+            Vf const t2 = unpackhi(c[1], c[0]);
+            Vf const t3 = unpackhi(c[3], c[2]);
+            Vf const r0 = shuffle<_MM_SHUFFLE(1, 0, 1, 0)>(t0, t1);
+            Vf const r1 = shuffle<_MM_SHUFFLE(3, 2, 3, 2)>(t0, t1);
+            Vf const r2 = shuffle<_MM_SHUFFLE(1, 0, 1, 0)>(t2, t3);
+            Vf const r3 = shuffle<_MM_SHUFFLE(3, 2, 3, 2)>(t2, t3);
+            Vf o[4];
+            o[0] = fmadd(r3, k3, sub(mul(r1, k5), mul(r2, k4)));
+            o[1] = sub(sub(mul(r2, k2), mul(r0, k5)), mul(r3, k1));
+            o[2] = fmadd(r3, k0, sub(mul(r0, k4), mul(r1, k2)));
+            o[3] = sub(sub(mul(r1, k1), mul(r0, k3)), mul(r2, k0));
+            Vf const first_row = shuffle<_MM_SHUFFLE(1, 0, 1, 0)>(unpacklo(o[0], o[1]), unpacklo(o[2], o[3]));
+            Vf const det = lane_sum(mul(first_row, c[0]));
+            Vf const sign = unpacklo(set1(1.0f), set1(-1.0f));
+            Vf const scale = mul(sign, div(set1(1.0f), det));
+            for(i64 k = 0; k < 4; ++k) {
+                o[k] = mul(o[k], scale);
+            }
+            store_columns(dst, o);
+        });
+#else
+        f32 const* p = elements(m);
+        f32* o = elements(out);
+        for(i64 i = 0; i < count; ++i, p += 16, o += 16) {
+            // Laplace expansion by 2x2 minors. The expansion is applied to the
+            // column major storage directly, which computes the transpose of the
+            // inverse of the transpose, i.e. the inverse in column major order.
+            f32 const a00 = p[0], a01 = p[1], a02 = p[2], a03 = p[3];
+            f32 const a10 = p[4], a11 = p[5], a12 = p[6], a13 = p[7];
+            f32 const a20 = p[8], a21 = p[9], a22 = p[10], a23 = p[11];
+            f32 const a30 = p[12], a31 = p[13], a32 = p[14], a33 = p[15];
+            f32 const s0 = a00 * a11 - a10 * a01;
+            f32 const s1 = a00 * a12 - a10 * a02;
+            f32 const s2 = a00 * a13 - a10 * a03;
+            f32 const s3 = a01 * a12 - a11 * a02;
+            f32 const s4 = a01 * a13 - a11 * a03;
+            f32 const s5 = a02 * a13 - a12 * a03;
+            f32 const c5 = a22 * a33 - a32 * a23;
+            f32 const c4 = a21 * a33 - a31 * a23;
+            f32 const c3 = a21 * a32 - a31 * a22;
+            f32 const c2 = a20 * a33 - a30 * a23;
+            f32 const c1 = a20 * a32 - a30 * a22;
+            f32 const c0 = a20 * a31 - a30 * a21;
+            f32 const det = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+            f32 const inv_det = 1.0f / det;
+            o[0] = (a11 * c5 - a12 * c4 + a13 * c3) * inv_det;
+            o[1] = (-a01 * c5 + a02 * c4 - a03 * c3) * inv_det;
+            o[2] = (a31 * s5 - a32 * s4 + a33 * s3) * inv_det;
+            o[3] = (-a21 * s5 + a22 * s4 - a23 * s3) * inv_det;
+            o[4] = (-a10 * c5 + a12 * c2 - a13 * c1) * inv_det;
+            o[5] = (a00 * c5 - a02 * c2 + a03 * c1) * inv_det;
+            o[6] = (-a30 * s5 + a32 * s2 - a33 * s1) * inv_det;
+            o[7] = (a20 * s5 - a22 * s2 + a23 * s1) * inv_det;
+            o[8] = (a10 * c4 - a11 * c2 + a13 * c0) * inv_det;
+            o[9] = (-a00 * c4 + a01 * c2 - a03 * c0) * inv_det;
+            o[10] = (a30 * s4 - a31 * s2 + a33 * s0) * inv_det;
+            o[11] = (-a20 * s4 + a21 * s2 - a23 * s0) * inv_det;
+            o[12] = (-a10 * c3 + a11 * c1 - a12 * c0) * inv_det;
+            o[13] = (a00 * c3 - a01 * c1 + a02 * c0) * inv_det;
+            o[14] = (-a30 * s3 + a31 * s1 - a32 * s0) * inv_det;
+            o[15] = (a20 * s3 - a21 * s1 + a22 * s0) * inv_det;
+        }
+#endif
+    }
+
+    // mat4_inverse_affine_impl
+    // Inverts affine (rigid = false) or rigid (rigid = true) matrices. Only the upper
+    // 3 rows of m are read.
+    //
+    template<bool rigid>
+    static void mat4_inverse_affine_impl(Mat4 const* const m, Mat4* const out, i64 const count) {
+#if ANTON_MATH_KERNEL_LEVEL >= 1
+        for_each_block<16, 16, vec4_lanes>(elements(m), elements(out), count, [](f32 const* const src, f32* const dst) {
+            Vf c[4];
+            load_columns(src, c);
+            Vf const zero = set1(0.0f);
+            // Rows of the inverse of the upper 3x3 block, scaled by the determinant
+            // in the affine case. The w components are discarded by the transpose.
+            Vf r0 = c[0];
+            Vf r1 = c[1];
+            Vf r2 = c[2];
+            if constexpr(!rigid) {
+                // cross(a, b) = a.yzx * b.zxy - a.zxy * b.yzx
+                auto const yzx = [](Vf const v) {
+                    return shuffle<_MM_SHUFFLE(3, 0, 2, 1)>(v, v);
+                };
+                auto const zxy = [](Vf const v) {
+                    return shuffle<_MM_SHUFFLE(3, 1, 0, 2)>(v, v);
+                };
+                r0 = sub(mul(yzx(c[1]), zxy(c[2])), mul(zxy(c[1]), yzx(c[2])));
+                r1 = sub(mul(yzx(c[2]), zxy(c[0])), mul(zxy(c[2]), yzx(c[0])));
+                r2 = sub(mul(yzx(c[0]), zxy(c[1])), mul(zxy(c[0]), yzx(c[1])));
+            }
+            Vf const t0 = unpacklo(r0, r1);
+            Vf const t1 = unpacklo(r2, zero);
+            Vf const t2 = unpackhi(r0, r1);
+            Vf const t3 = unpackhi(r2, zero);
+            Vf o[4];
+            o[0] = shuffle<_MM_SHUFFLE(1, 0, 1, 0)>(t0, t1);
+            o[1] = shuffle<_MM_SHUFFLE(3, 2, 3, 2)>(t0, t1);
+            o[2] = shuffle<_MM_SHUFFLE(1, 0, 1, 0)>(t2, t3);
+            if constexpr(!rigid) {
+                // The w components of the cross products are 0.
+                Vf const det = lane_sum(mul(c[0], r0));
+                Vf const inv_det = div(set1(1.0f), det);
+                o[0] = mul(o[0], inv_det);
+                o[1] = mul(o[1], inv_det);
+                o[2] = mul(o[2], inv_det);
+            }
+            // (0, 0, 0, 1) - inverse * translation
+            Vf const t = c[3];
+            Vf const w_axis = shuffle<_MM_SHUFFLE(1, 0, 0, 0)>(zero, unpacklo(zero, set1(1.0f)));
+            Vf const rotated = fmadd(o[0], shuffle<_MM_SHUFFLE(0, 0, 0, 0)>(t, t),
+                                     fmadd(o[1], shuffle<_MM_SHUFFLE(1, 1, 1, 1)>(t, t), mul(o[2], shuffle<_MM_SHUFFLE(2, 2, 2, 2)>(t, t))));
+            o[3] = sub(w_axis, rotated);
+            store_columns(dst, o);
+        });
+#else
+        f32 const* p = elements(m);
+        f32* o = elements(out);
+        for(i64 i = 0; i < count; ++i, p += 16, o += 16) {
+            f32 r[9];
+            if constexpr(rigid) {
+                for(i64 k = 0; k < 3; ++k) {
+                    r[3 * k] = p[4 * k];
+                    r[3 * k + 1] = p[4 * k + 1];
+                    r[3 * k + 2] = p[4 * k + 2];
+                }
+            } else {
+                r[0] = p[5] * p[10] - p[6] * p[9];
+                r[1] = p[6] * p[8] - p[4] * p[10];
+                r[2] = p[4] * p[9] - p[5] * p[8];
+                r[3] = p[9] * p[2] - p[10] * p[1];
+                r[4] = p[10] * p[0] - p[8] * p[2];
+                r[5] = p[8] * p[1] - p[9] * p[0];
+                r[6] = p[1] * p[6] - p[2] * p[5];
+                r[7] = p[2] * p[4] - p[0] * p[6];
+                r[8] = p[0] * p[5] - p[1] * p[4];
+                f32 const inv_det = 1.0f / (p[0] * r[0] + p[1] * r[1] + p[2] * r[2]);
+                for(i64 e = 0; e < 9; ++e) {
+                    r[e] *= inv_det;
+                }
+            }
+            f32 const tx = p[12];
+            f32 const ty = p[13];
+            f32 const tz = p[14];
+            for(i64 k = 0; k < 3; ++k) {
+                o[4 * k] = r[k];
+                o[4 * k + 1] = r[3 + k];
+                o[4 * k + 2] = r[6 + k];
+                o[4 * k + 3] = 0.0f;
+            }
+            o[12] = -(r[0] * tx + r[1] * ty + r[2] * tz);
+            o[13] = -(r[3] * tx + r[4] * ty + r[5] * tz);
+            o[14] = -(r[6] * tx + r[7] * ty + r[8] * tz);
+            o[15] = 1.0f;
+        }
+#endif
+    }
+
+    static void mat4_inverse_affine(Mat4 const* const m, Mat4* const out, i64 const count) {
+        mat4_inverse_affine_impl<false>(m, out, count);
+    }
+
+    static void mat4_inverse_rigid(Mat4 const* const m, Mat4* const out, i64 const count) {
+        mat4_inverse_affine_impl<true>(m, out, count);
+    }
+
+    // TRS is accessed as 10 floats: rotation, translation and scale.
+    static_assert(sizeof(TRS) == 10 * sizeof(f32), "TRS must not contain padding");
+
+    // trs_compose
+    // Builds Mat4 (stride = 16) or Affine3 (stride = 12) from TRS. The elements are
+    // transposed into lanes with gather and scatter.
+    //
+    template<i64 stride>
+    static void trs_compose(TRS const* const in, f32* const out, i64 const count) {
+        for_each_block<10, stride>(elements(in), out, count, [](f32 const* const src, f32* const dst) {
+            Vf const qx = gather<10>(src, 0);
+            Vf const qy = gather<10>(src, 1);
+            Vf const qz = gather<10>(src, 2);
+            Vf const qw = gather<10>(src, 3);
+            Vf const two = set1(2.0f);
+            Vf const one = set1(1.0f);
+            Vf const x2 = mul(qx, two);
+            Vf const y2 = mul(qy, two);
+            Vf const z2 = mul(qz, two);
+            Vf const xx = mul(qx, x2);
+            Vf const yy = mul(qy, y2);
+            Vf const zz = mul(qz, z2);
+            Vf const xy = mul(qx, y2);
+            Vf const xz = mul(qx, z2);
+            Vf const yz = mul(qy, z2);
+            Vf const wx = mul(qw, x2);
+            Vf const wy = mul(qw, y2);
+            Vf const wz = mul(qw, z2);
+            Vf const sx = gather<10>(src, 7);
+            Vf const sy = gather<10>(src, 8);
+            Vf const sz = gather<10>(src, 9);
+            // Columns of the rotation scaled by the scale.
+            Vf const columns[9] = {
+                mul(sub(one, add(yy, zz)), sx), mul(add(xy, wz), sx), mul(sub(xz, wy), sx),
+                mul(sub(xy, wz), sy), mul(sub(one, add(xx, zz)), sy), mul(add(yz, wx), sy),
+                mul(add(xz, wy), sz), mul(sub(yz, wx), sz), mul(sub(one, add(xx, yy)), sz),
+            };
+            constexpr i64 column_size = stride / 4;
+            for(i64 c = 0; c < 3; ++c) {
+                for(i64 r = 0; r < 3; ++r) {
+                    scatter<stride>(dst, c * column_size + r, columns[3 * c + r]);
+                }
+            }
+            for(i64 r = 0; r < 3; ++r) {
+                scatter<stride>(dst, 3 * column_size + r, gather<10>(src, 4 + r));
+            }
+            if constexpr(stride == 16) {
+                Vf const zero = set1(0.0f);
+                scatter<stride>(dst, 3, zero);
+                scatter<stride>(dst, 7, zero);
+                scatter<stride>(dst, 11, zero);
+                scatter<stride>(dst, 15, one);
+            }
+        });
+    }
+
+    static void trs_compose_mat4(TRS const* const in, Mat4* const out, i64 const count) {
+        trs_compose<16>(in, elements(out), count);
+    }
+
+    static void trs_compose_affine3(TRS const* const in, Affine3* const out, i64 const count) {
+        trs_compose<12>(in, elements(out), count);
+    }
+
+    static void trs_decompose(Mat4 const* const in, TRS* const out, i64 const count) {
+        for_each_block<16, 10>(elements(in), elements(out), count, [](f32 const* const src, f32* const dst) {
+            Vf m[3][3];
+            Vf scale[3];
+            for(i64 c = 0; c < 3; ++c) {
+                for(i64 r = 0; r < 3; ++r) {
+                    m[c][r] = gather<16>(src, 4 * c + r);
+                }
+                scale[c] = sqrt(fmadd(m[c][0], m[c][0], fmadd(m[c][1], m[c][1], mul(m[c][2], m[c][2]))));
+                Vf const inv_scale = div(set1(1.0f), scale[c]);
+                for(i64 r = 0; r < 3; ++r) {
+                    m[c][r] = mul(m[c][r], inv_scale);
+                }
+            }
+            // Branchless equivalent of decompose(Mat4 const&). The largest of w, x, y, z
+            // (in the order of the branches) is computed from the diagonal as r and the
+            // remaining components from the off-diagonal sums or differences divided by
+            // 4r. v = 4r^2, therefore v / 4r yields r itself.
+            Vf const one = set1(1.0f);
+            Vf const zero = set1(0.0f);
+            Vf const trace = add(add(m[0][0], m[1][1]), m[2][2]);
+            Mf const b0 = greater(trace, zero);
+            Mf const b1 = mask_andnot(b0, mask_and(greater(m[0][0], m[1][1]), greater(m[0][0], m[2][2])));
+            Mf const b2 = mask_andnot(b0, mask_andnot(b1, greater(m[1][1], m[2][2])));
+            Vf const v0 = add(one, trace);
+            Vf const v1 = sub(add(one, m[0][0]), add(m[1][1], m[2][2]));
+            Vf const v2 = sub(add(one, m[1][1]), add(m[0][0], m[2][2]));
+            Vf const v3 = sub(add(one, m[2][2]), add(m[0][0], m[1][1]));
+            Vf const v = select(b0, v0, select(b1, v1, select(b2, v2, v3)));
+            Vf const f = div(set1(0.5f), sqrt(v));
+            Vf const d0 = sub(m[1][2], m[2][1]);
+            Vf const d1 = sub(m[2][0], m[0][2]);
+            Vf const d2 = sub(m[0][1], m[1][0]);
+            Vf const a0 = add(m[0][1], m[1][0]);
+            Vf const a1 = add(m[0][2], m[2][0]);
+            Vf const a2 = add(m[1][2], m[2][1]);
+            Vf const qx = mul(select(b0, d0, select(b1, v, select(b2, a0, a1))), f);
+            Vf const qy = mul(select(b0, d1, select(b1, a0, select(b2, v, a2))), f);
+            Vf const qz = mul(select(b0, d2, select(b1, a1, select(b2, a2, v))), f);
+            Vf const qw = mul(select(b0, v, select(b1, d0, select(b2, d1, d2))), f);
+            scatter<10>(dst, 0, qx);
+            scatter<10>(dst, 1, qy);
+            scatter<10>(dst, 2, qz);
+            scatter<10>(dst, 3, qw);
+            for(i64 r = 0; r < 3; ++r) {
+                scatter<10>(dst, 4 + r, gather<16>(src, 12 + r));
+            }
+            for(i64 c = 0; c < 3; ++c) {
+                scatter<10>(dst, 7 + c, scale[c]);
+            }
+        });
+    }
+
+    template<Elementwise_Op op>
+    [[nodiscard]] static Vf apply(Vf const a, Vf const b) {
+        if constexpr(op == Elementwise_Op::add) {
+            return add(a, b);
+        } else if constexpr(op == Elementwise_Op::subtract) {
+            return sub(a, b);
+        } else if constexpr(op == Elementwise_Op::multiply) {
+            return mul(a, b);
+        } else if constexpr(op == Elementwise_Op::divide) {
+            return div(a, b);
+        } else if constexpr(op == Elementwise_Op::min) {
+            return min(a, b);
+        } else {
+            return max(a, b);
+        }
+    }
+
+    template<Elementwise_Op op>
+    static void soa_elementwise_impl(f32 const* const a, f32 const* const b, f32* const out, i64 const count) {
+        for_each_soa_block<2, 1>({a, b}, {out}, count, [](auto const& in, auto const& o) {
+            storeu(o[0], apply<op>(loadu(in[0]), loadu(in[1])));
+        });
+    }
+
+    template<Elementwise_Op op>
+    static void soa_elementwise_scalar_impl(f32 const* const a, f32 const b, f32* const out, i64 const count) {
+        Vf const vb = set1(b);
+        for_each_soa_block<1, 1>({a}, {out}, count, [vb](auto const& in, auto const& o) {
+            storeu(o[0], apply<op>(loadu(in[0]), vb));
+        });
+    }
+
+    static void soa_elementwise(Elementwise_Op const op, f32 const* const a, f32 const* const b, f32* const out, i64 const count) {
+        switch(op) {
+            case Elementwise_Op::add:
+                return soa_elementwise_impl<Elementwise_Op::add>(a, b, out, count);
+            case Elementwise_Op::subtract:
+                return soa_elementwise_impl<Elementwise_Op::subtract>(a, b, out, count);
+            case Elementwise_Op::multiply:
+                return soa_elementwise_impl<Elementwise_Op::multiply>(a, b, out, count);
+            case Elementwise_Op::divide:
+                return soa_elementwise_impl<Elementwise_Op::divide>(a, b, out, count);
+            case Elementwise_Op::min:
+                return soa_elementwise_impl<Elementwise_Op::min>(a, b, out, count);
+            case Elementwise_Op::max:
+                return soa_elementwise_impl<Elementwise_Op::max>(a, b, out, count);
+        }
+    }
+
+    static void soa_elementwise_scalar(Elementwise_Op const op, f32 const* const a, f32 const b, f32* const out, i64 const count) {
+        switch(op) {
+            case Elementwise_Op::add:
+                return soa_elementwise_scalar_impl<Elementwise_Op::add>(a, b, out, count);
+            case Elementwise_Op::subtract:
+                return soa_elementwise_scalar_impl<Elementwise_Op::subtract>(a, b, out, count);
+            case Elementwise_Op::multiply:
+                return soa_elementwise_scalar_impl<Elementwise_Op::multiply>(a, b, out, count);
+            case Elementwise_Op::divide:
+                return soa_elementwise_scalar_impl<Elementwise_Op::divide>(a, b, out, count);
+            case Elementwise_Op::min:
+                return soa_elementwise_scalar_impl<Elementwise_Op::min>(a, b, out, count);
+            case Elementwise_Op::max:
+                return soa_elementwise_scalar_impl<Elementwise_Op::max>(a, b, out, count);
+        }
+    }
+
+    static void soa_lerp(f32 const* const a, f32 const* const b, f32 const t, f32* const out, i64 const count) {
+        Vf const vt = set1(t);
+        Vf const vs = set1(1.0f - t);
+        for_each_soa_block<2, 1>({a, b}, {out}, count, [vt, vs](auto const& in, auto const& o) {
+            storeu(o[0], fmadd(vs, loadu(in[0]), mul(vt, loadu(in[1]))));
+        });
+    }
+
+    static void soa_lerp_varying(f32 const* const a, f32 const* const b, f32 const* const t, f32* const out, i64 const count) {
+        for_each_soa_block<3, 1>({a, b, t}, {out}, count, [](auto const& in, auto const& o) {
+            Vf const vt = loadu(in[2]);
+            storeu(o[0], fmadd(sub(set1(1.0f), vt), loadu(in[0]), mul(vt, loadu(in[1]))));
+        });
+    }
+
+    template<i64 components>
+    static void soa_dot_impl(f32 const* const* const a, f32 const* const* const b, f32* const out, i64 const count) {
+        f32 const* in[2 * components];
+        for(i64 c = 0; c < components; ++c) {
+            in[c] = a[c];
+            in[components + c] = b[c];
+        }
+        for_each_soa_block<2 * components, 1>(in, {out}, count, [](auto const& in, auto const& o) {
+            Vf r = mul(loadu(in[0]), loadu(in[components]));
+            for(i64 c = 1; c < components; ++c) {
+                r = fmadd(loadu(in[c]), loadu(in[components + c]), r);
+            }
+            storeu(o[0], r);
+        });
+    }
+
+    static void soa_dot(f32 const* const* const a, f32 const* const* const b, i64 const components, f32* const out, i64 const count) {
+        if(components == 3) {
+            soa_dot_impl<3>(a, b, out, count);
+        } else {
+            soa_dot_impl<4>(a, b, out, count);
+        }
+    }
+
+    template<i64 components>
+    static void soa_length_impl(f32 const* const* const a, f32* const out, i64 const count) {
+        f32 const* in[components];
+        for(i64 c = 0; c < components; ++c) {
+            in[c] = a[c];
+        }
+        for_each_soa_block<components, 1>(in, {out}, count, [](auto const& in, auto const& o) {
+            Vf r = mul(loadu(in[0]), loadu(in[0]));
+            for(i64 c = 1; c < components; ++c) {
+                r = fmadd(loadu(in[c]), loadu(in[c]), r);
+            }
+            storeu(o[0], sqrt(r));
+        });
+    }
+
+    static void soa_length(f32 const* const* const a, i64 const components, f32* const out, i64 const count) {
+        if(components == 3) {
+            soa_length_impl<3>(a, out, count);
+        } else {
+            soa_length_impl<4>(a, out, count);
+        }
+    }
+
+    template<i64 components>
+    static void soa_normalize_impl(f32 const* const* const a, f32 const tolerance, f32* const* const out, i64 const count) {
+        f32 const* in[components];
+        f32* o[components];
+        for(i64 c = 0; c < components; ++c) {
+            in[c] = a[c];
+            o[c] = out[c];
+        }
+        Vf const vtolerance = set1(tolerance);
+        for_each_soa_block<components, components>(in, o, count, [vtolerance](auto const& in, auto const& o) {
+            Vf v[components];
+            for(i64 c = 0; c < components; ++c) {
+                v[c] = loadu(in[c]);
+            }
+            // Vectors whose all components are within tolerance of 0 become 0.
+            Mf non_zero = greater(abs(v[0]), vtolerance);
+            Vf length_squared = mul(v[0], v[0]);
+            for(i64 c = 1; c < components; ++c) {
+                non_zero = mask_or(non_zero, greater(abs(v[c]), vtolerance));
+                length_squared = fmadd(v[c], v[c], length_squared);
+            }
+            Vf const scale = select(non_zero, div(set1(1.0f), sqrt(length_squared)), set1(0.0f));
+            for(i64 c = 0; c < components; ++c) {
+                storeu(o[c], mul(v[c], scale));
+            }
+        });
+    }
+
+    static void soa_normalize(f32 const* const* const a, i64 const components, f32 const tolerance, f32* const* const out, i64 const count) {
+        if(components == 3) {
+            soa_normalize_impl<3>(a, tolerance, out, count);
+        } else {
+            soa_normalize_impl<4>(a, tolerance, out, count);
+        }
+    }
+
+    static void soa_cross(f32 const* const* const a, f32 const* const* const b, f32* const* const out, i64 const count) {
+        for_each_soa_block<6, 3>({a[0], a[1], a[2], b[0], b[1], b[2]}, {out[0], out[1], out[2]}, count, [](auto const& in, auto const& o) {
+            Vf const ax = loadu(in[0]);
+            Vf const ay = loadu(in[1]);
+            Vf const az = loadu(in[2]);
+            Vf const bx = loadu(in[3]);
+            Vf const by = loadu(in[4]);
+            Vf const bz = loadu(in[5]);
+            storeu(o[0], sub(mul(ay, bz), mul(az, by)));
+            storeu(o[1], sub(mul(az, bx), mul(ax, bz)));
+            storeu(o[2], sub(mul(ax, by), mul(ay, bx)));
+        });
+    }
+
+    static void soa_quat_multiply(f32 const* const* const a, f32 const* const* const b, f32* const* const out, i64 const count) {
+        for_each_soa_block<8, 4>({a[0], a[1], a[2], a[3], b[0], b[1], b[2], b[3]}, {out[0], out[1], out[2], out[3]}, count,
+                                 [](auto const& in, auto const& o) {
+                                     Vf const px = loadu(in[0]);
+                                     Vf const py = loadu(in[1]);
+                                     Vf const pz = loadu(in[2]);
+                                     Vf const pw = loadu(in[3]);
+                                     Vf const qx = loadu(in[4]);
+                                     Vf const qy = loadu(in[5]);
+                                     Vf const qz = loadu(in[6]);
+                                     Vf const qw = loadu(in[7]);
+                                     storeu(o[0], fmadd(pw, qx, fmadd(qw, px, sub(mul(py, qz), mul(pz, qy)))));
+                                     storeu(o[1], fmadd(pw, qy, fmadd(qw, py, sub(mul(pz, qx), mul(px, qz)))));
+                                     storeu(o[2], fmadd(pw, qz, fmadd(qw, pz, sub(mul(px, qy), mul(py, qx)))));
+                                     storeu(o[3], sub(mul(pw, qw), fmadd(px, qx, fmadd(py, qy, mul(pz, qz)))));
+                                 });
+    }
+
+    static void soa_quat_rotate(f32 const* const* const q, f32 const* const* const v, f32* const* const out, i64 const count) {
+        for_each_soa_block<7, 3>({q[0], q[1], q[2], q[3], v[0], v[1], v[2]}, {out[0], out[1], out[2]}, count, [](auto const& in, auto const& o) {
+            Vf const qx = loadu(in[0]);
+            Vf const qy = loadu(in[1]);
+            Vf const qz = loadu(in[2]);
+            Vf const qw = loadu(in[3]);
+            Vf const vx = loadu(in[4]);
+            Vf const vy = loadu(in[5]);
+            Vf const vz = loadu(in[6]);
+            // v' = v + w * t + cross(q.xyz, t) where t = 2 * cross(q.xyz, v).
+            Vf const two = set1(2.0f);
+            Vf const tx = mul(two, sub(mul(qy, vz), mul(qz, vy)));
+            Vf const ty = mul(two, sub(mul(qz, vx), mul(qx, vz)));
+            Vf const tz = mul(two, sub(mul(qx, vy), mul(qy, vx)));
+            storeu(o[0], fmadd(qw, tx, add(vx, sub(mul(qy, tz), mul(qz, ty)))));
+            storeu(o[1], fmadd(qw, ty, add(vy, sub(mul(qz, tx), mul(qx, tz)))));
+            storeu(o[2], fmadd(qw, tz, add(vz, sub(mul(qx, ty), mul(qy, tx)))));
+        });
+    }
+
+    static void soa_transform_directions(Mat4 const& m, f32 const* const* const in, f32* const* const out, i64 const count) {
+        // a[4 * column + row]
+        f32 const* const a = elements(&m);
+        Vf const m00 = set1(a[0]), m10 = set1(a[1]), m20 = set1(a[2]);
+        Vf const m01 = set1(a[4]), m11 = set1(a[5]), m21 = set1(a[6]);
+        Vf const m02 = set1(a[8]), m12 = set1(a[9]), m22 = set1(a[10]);
+        for_each_soa_block<3, 3>({in[0], in[1], in[2]}, {out[0], out[1], out[2]}, count, [&](auto const& i, auto const& o) {
+            Vf const x = loadu(i[0]);
+            Vf const y = loadu(i[1]);
+            Vf const z = loadu(i[2]);
+            storeu(o[0], fmadd(m00, x, fmadd(m01, y, mul(m02, z))));
+            storeu(o[1], fmadd(m10, x, fmadd(m11, y, mul(m12, z))));
+            storeu(o[2], fmadd(m20, x, fmadd(m21, y, mul(m22, z))));
+        });
+    }
+
+    // aos_to_soa_impl
+    // Transposes count structures of components floats into components arrays. The
+    // Vec3 structures are transposed with load_vec3, the Vec4 and Mat4 structures as
+    // 4x4 blocks in each lane.
+    //
+    // soa_to_aos_impl
+    // Inverse of aos_to_soa_impl.
+    //
+    template<i64 components>
+    static void aos_to_soa_impl(f32 const* const in, f32* const* const out, i64 const count) {
+        i64 i = 0;
+#if ANTON_MATH_KERNEL_LEVEL >= 1
+        for(; i + lanes <= count; i += lanes) {
+            f32 const* const src = in + components * i;
+            if constexpr(components == 3) {
+                Vf x;
+                Vf y;
+                Vf z;
+                load_vec3(src, x, y, z);
+                storeu(out[0] + i, x);
+                storeu(out[1] + i, y);
+                storeu(out[2] + i, z);
+            } else {
+                for(i64 k = 0; k < components; k += 4) {
+                    Vf v[4];
+                    load_columns<components>(src + k, v);
+                    transpose4(v);
+                    for(i64 c = 0; c < 4; ++c) {
+                        storeu(out[k + c] + i, v[c]);
+                    }
+                }
+            }
+        }
+#endif
+        for(; i < count; ++i) {
+            for(i64 c = 0; c < components; ++c) {
+                out[c][i] = in[components * i + c];
+            }
+        }
+    }
+
+    template<i64 components>
+    static void soa_to_aos_impl(f32 const* const* const in, f32* const out, i64 const count) {
+        i64 i = 0;
+#if ANTON_MATH_KERNEL_LEVEL >= 1
+        for(; i + lanes <= count; i += lanes) {
+            f32* const dst = out + components * i;
+            if constexpr(components == 3) {
+                store_vec3(dst, loadu(in[0] + i), loadu(in[1] + i), loadu(in[2] + i));
+            } else {
+                for(i64 k = 0; k < components; k += 4) {
+                    Vf v[4];
+                    for(i64 c = 0; c < 4; ++c) {
+                        v[c] = loadu(in[k + c] + i);
+                    }
+                    transpose4(v);
+                    store_columns<components>(dst + k, v);
+                }
+            }
+        }
+#endif
+        for(; i < count; ++i) {
+            for(i64 c = 0; c < components; ++c) {
+                out[components * i + c] = in[c][i];
+            }
+        }
+    }
+
+    static void aos_to_soa(f32 const* const in, i64 const components, f32* const* const out, i64 const count) {
+        if(components == 3) {
+            aos_to_soa_impl<3>(in, out, count);
+        } else if(components == 4) {
+            aos_to_soa_impl<4>(in, out, count);
+        } else {
+            aos_to_soa_impl<16>(in, out, count);
+        }
+    }
+
+    static void soa_to_aos(f32 const* const* const in, i64 const components, f32* const out, i64 const count) {
+        if(components == 3) {
+            soa_to_aos_impl<3>(in, out, count);
+        } else if(components == 4) {
+            soa_to_aos_impl<4>(in, out, count);
+        } else {
+            soa_to_aos_impl<16>(in, out, count);
+        }
+    }
+
+    // Transcendental functions
+    //
+    // The functions are evaluated with polynomial approximations on a reduced argument.
+    // Each function has a domain within which the approximation is accurate. The lanes
+    // outside of the domain, including infinities and nans, are recomputed with the
+    // scalar function of the C library so that special values are handled like in
+    // math.hpp. The polynomials are those of the Cephes library.
+    //
+
+    // reduce_half_pi
+    // Reduces x to r in [-pi/4, pi/4] such that x = r + q * pi / 2. The reduction is
+    // performed in f64 with pi / 2 split into 2 parts, the first one having 37
+    // significant bits so that q * pi / 2 is exact in it for |x| < 65536. The error
+    // of r is well below the f32 rounding even for x close to multiples of pi / 2.
+    //
+    static Vf reduce_half_pi(Vf const x, Vi& q) {
+        q = to_i32(mul(x, set1(0.636619772367581343f)));
+        Vd r[f64_parts];
+        Vd qd[f64_parts];
+        to_f64(x, r);
+        to_f64(to_f32(q), qd);
+        for(i64 h = 0; h < f64_parts; ++h) {
+            r[h] = fmadd(qd[h], set1_f64(-1.5707963267923333), r[h]);
+            r[h] = fmadd(qd[h], set1_f64(-2.563344151594519e-12), r[h]);
+        }
+        return to_f32(r);
+    }
+
+    // sin(r) for |r| <= pi / 4. z is r * r.
+    [[nodiscard]] static Vf sin_poly(Vf const r, Vf const z) {
+        Vf p = fmadd(set1(-1.9515295891e-4f), z, set1(8.3321608736e-3f));
+        p = fmadd(p, z, set1(-1.6666654611e-1f));
+        return fmadd(mul(p, z), r, r);
+    }
+
+    // cos(r) for |r| <= pi / 4. z is r * r.
+    [[nodiscard]] static Vf cos_poly(Vf const z) {
+        Vf p = fmadd(set1(2.443315711809948e-5f), z, set1(-1.388731625493765e-3f));
+        p = fmadd(p, z, set1(4.166664568298827e-2f));
+        return fmadd(mul(p, z), z, fmadd(set1(-0.5f), z, set1(1.0f)));
+    }
+
+    // sin(r + q * pi / 2)
+    [[nodiscard]] static Vf sin_quadrant(Vf const r, Vi const q) {
+        Vf const z = mul(r, r);
+        Vf const v = select(test_bits(q, 1), cos_poly(z), sin_poly(r, z));
+        // Negate in the quadrants 2 and 3.
+        return as_f32(bit_xor(as_i32(v), shift_left<30>(bit_and(q, set1_i32(2)))));
+    }
+
+    [[nodiscard]] static Vf tan_kernel(Vf const x) {
+        Vi q;
+        Vf const r = reduce_half_pi(x, q);
+        Vf const z = mul(r, r);
+        Vf p = fmadd(set1(9.38540185543e-3f), z, set1(3.11992232697e-3f));
+        p = fmadd(p, z, set1(2.44301354525e-2f));
+        p = fmadd(p, z, set1(5.34112807005e-2f));
+        p = fmadd(p, z, set1(1.33387994085e-1f));
+        p = fmadd(p, z, set1(3.33331568548e-1f));
+        Vf const t = fmadd(mul(p, z), r, r);
+        // tan(r + pi / 2) = -1 / tan(r)
+        return select(test_bits(q, 1), div(set1(-1.0f), t), t);
+    }
+
+    // Splits of pi and pi / 2 into the nearest f32 and the remainder.
+    constexpr f32 pi_hi = 3.14159274101257324f;
+    constexpr f32 pi_lo = -8.74227800037248566e-8f;
+    constexpr f32 half_pi_hi = 1.57079637050628662f;
+    constexpr f32 half_pi_lo = -4.37113900018624283e-8f;
+
+    [[nodiscard]] static Vf copy_sign(Vf const magnitude, Vf const sign) {
+        return as_f32(bit_or(as_i32(magnitude), bit_and(as_i32(sign), set1_i32((i32)0x80000000))));
+    }
+
+    // asin(t) - t for |t| <= 0.5
+    [[nodiscard]] static Vf asin_poly(Vf const t) {
+        Vf const z = mul(t, t);
+        Vf p = fmadd(set1(4.2163199048e-2f), z, set1(2.4181311049e-2f));
+        p = fmadd(p, z, set1(4.5470025998e-2f));
+        p = fmadd(p, z, set1(7.4953002686e-2f));
+        p = fmadd(p, z, set1(1.6666752422e-1f));
+        return mul(mul(p, z), t);
+    }
+
+    // asin(x) = pi / 2 - 2 * asin(sqrt((1 - x) / 2)) for x > 0.5
+    [[nodiscard]] static Vf asin_kernel(Vf const x) {
+        Vf const a = abs(x);
+        Mf const large = greater(a, set1(0.5f));
+        Vf const t = select(large, sqrt(mul(set1(0.5f), sub(set1(1.0f), a))), a);
+        Vf const p = asin_poly(t);
+        // Subtract the leading term first to limit the cancellation.
+        Vf const r_large = sub(sub(set1(half_pi_hi), add(t, t)), sub(add(p, p), set1(half_pi_lo)));
+        return copy_sign(select(large, r_large, add(t, p)), x);
+    }
+
+    // acos(x) = 2 * asin(sqrt((1 - x) / 2)) for x > 0.5
+    // acos(x) = pi - 2 * asin(sqrt((1 + x) / 2)) for x < -0.5
+    // acos(x) = pi / 2 - asin(x) otherwise
+    [[nodiscard]] static Vf acos_kernel(Vf const x) {
+        Vf const a = abs(x);
+        Mf const large = greater(a, set1(0.5f));
+        Vf const t = select(large, sqrt(mul(set1(0.5f), sub(set1(1.0f), a))), x);
+        Vf const p = asin_poly(t);
+        Vf const t2 = add(t, t);
+        Vf const p2 = add(p, p);
+        Vf const r_large = select(greater(set1(0.0f), x), sub(sub(set1(pi_hi), t2), sub(p2, set1(pi_lo))), add(t2, p2));
+        Vf const r_small = sub(sub(set1(half_pi_hi), t), sub(p, set1(half_pi_lo)));
+        return select(large, r_large, r_small);
+    }
+
+    // atan(x) = atan(c) + atan((x - c) / (1 + x * c)) with c = 0 for x <= tan(pi / 8),
+    // c = 1 for x <= tan(3 * pi / 8) and c = inf otherwise.
+    [[nodiscard]] static Vf atan_kernel(Vf const x) {
+        Vf const a = abs(x);
+        Mf const large = greater(a, set1(2.414213562373095f));
+        Mf const medium = mask_andnot(large, greater(a, set1(0.4142135623730950f)));
+        Vf t = select(medium, div(sub(a, set1(1.0f)), add(a, set1(1.0f))), a);
+        t = select(large, div(set1(-1.0f), a), t);
+        Vf const offset_hi = select(large, set1(half_pi_hi), select(medium, set1(0.5f * half_pi_hi), set1(0.0f)));
+        Vf const offset_lo = select(large, set1(half_pi_lo), select(medium, set1(0.5f * half_pi_lo), set1(0.0f)));
+        Vf const z = mul(t, t);
+        Vf p = fmadd(set1(8.05374449538e-2f), z, set1(-1.38776856032e-1f));
+        p = fmadd(p, z, set1(1.99777106478e-1f));
+        p = fmadd(p, z, set1(-3.33329491539e-1f));
+        p = fmadd(mul(p, z), t, t);
+        return copy_sign(add(offset_hi, add(p, offset_lo)), x);
+    }
+
+    // atan2(y, x) = atan(y / x) + sign(y) * pi for x < 0
+    [[nodiscard]] static Vf atan2_kernel(Vf const y, Vf const x) {
+        Vf const r = atan_kernel(div(y, x));
+        Mf const negative_x = greater(set1(0.0f), x);
+        Vf const offset_hi = select(negative_x, copy_sign(set1(pi_hi), y), set1(0.0f));
+        Vf const offset_lo = select(negative_x, copy_sign(set1(pi_lo), y), set1(0.0f));
+        return add(offset_hi, add(r, offset_lo));
+    }
+
+    // exp(x) = 2^n * exp(r) with x = n * ln(2) + r, |r| <= ln(2) / 2. ln(2) is split
+    // into 2 parts so that n * ln(2) is exact in the first one.
+    [[nodiscard]] static Vf exp_kernel(Vf const x) {
+        Vi const n = to_i32(mul(x, set1(1.44269504088896341f)));
+        Vf const nf = to_f32(n);
+        Vf r = fmadd(nf, set1(-0.693359375f), x);
+        r = fmadd(nf, set1(2.12194440e-4f), r);
+        Vf p = fmadd(set1(1.9875691500e-4f), r, set1(1.3981999507e-3f));
+        p = fmadd(p, r, set1(8.3334519073e-3f));
+        p = fmadd(p, r, set1(4.1665795894e-2f));
+        p = fmadd(p, r, set1(1.6666665459e-1f));
+        p = fmadd(p, r, set1(5.0000001201e-1f));
+        p = fmadd(p, mul(r, r), add(r, set1(1.0f)));
+        Vf const scale = as_f32(shift_left<23>(add(n, set1_i32(127))));
+        return mul(p, scale);
+    }
+
+    // reduce_log
+    // Splits a positive normal x into 2^e * (1 + f) with 1 + f in [sqrt(1/2), sqrt(2)).
+    //
+    // log_poly
+    // log(1 + f) - f + f^2 / 2.
+    //
+    static Vf reduce_log(Vf const x, Vf& e) {
+        Vi const bits = as_i32(x);
+        // m in [0.5, 1)
+        Vf const m = as_f32(bit_or(bit_and(bits, set1_i32(0x007FFFFF)), set1_i32(0x3F000000)));
+        Mf const small = greater(set1(0.707106781186547524f), m);
+        e = sub(to_f32(sub(shift_right<23>(bits), set1_i32(126))), select(small, set1(1.0f), set1(0.0f)));
+        return sub(select(small, add(m, m), m), set1(1.0f));
+    }
+
+    [[nodiscard]] static Vf log_poly(Vf const f, Vf const z) {
+        Vf p = fmadd(set1(7.0376836292e-2f), f, set1(-1.1514610310e-1f));
+        p = fmadd(p, f, set1(1.1676998740e-1f));
+        p = fmadd(p, f, set1(-1.2420140846e-1f));
+        p = fmadd(p, f, set1(1.4249322787e-1f));
+        p = fmadd(p, f, set1(-1.6668057665e-1f));
+        p = fmadd(p, f, set1(2.0000714765e-1f));
+        p = fmadd(p, f, set1(-2.4999993993e-1f));
+        p = fmadd(p, f, set1(3.3333331174e-1f));
+        return mul(mul(p, z), f);
+    }
+
+    // log(x) = e * ln(2) + log(1 + f). ln(2) is split into 2 parts.
+    [[nodiscard]] static Vf log_kernel(Vf const x) {
+        Vf e;
+        Vf const f = reduce_log(x, e);
+        Vf const z = mul(f, f);
+        Vf y = fmadd(e, set1(-2.12194440e-4f), log_poly(f, z));
+        y = fmadd(z, set1(-0.5f), y);
+        return fmadd(e, set1(0.693359375f), add(f, y));
+    }
+
+    // log2(x) = e + log(1 + f) * log2(e). The multiplication by log2(e) is split into
+    // the multiplication by log2(e) - 1 and an addition.
+    [[nodiscard]] static Vf log2_kernel(Vf const x) {
+        Vf e;
+        Vf const f = reduce_log(x, e);
+        Vf const z = mul(f, f);
+        Vf const y = fmadd(z, set1(-0.5f), log_poly(f, z));
+        Vf const log2e_minus_1 = set1(0.44269504088896340736f);
+        Vf r = fmadd(y, log2e_minus_1, mul(f, log2e_minus_1));
+        r = add(r, y);
+        r = add(r, f);
+        return add(r, e);
+    }
+
+    // pow(x, y) = 2^(y * log2(x)) for a positive normal x. The exponent is evaluated
+    // in f64, hence the only significant error is the final rounding to f32.
+    //
+    // log2(x) = e + 2 * atanh(s) / ln(2) where x = 2^e * m, m in [1, 2) and
+    // s = (m - 1) / (m + 1) in [0, 1/3). 2^w = 2^n * exp((w - n) * ln(2)) where n is
+    // the nearest integer to w.
+    [[nodiscard]] static Vf pow_kernel(Vf const x, Vf const y) {
+        Vi const bits = as_i32(x);
+        Vf const e = to_f32(sub(shift_right<23>(bits), set1_i32(127)));
+        Vf const m = as_f32(bit_or(bit_and(bits, set1_i32(0x007FFFFF)), set1_i32(0x3F800000)));
+        Vd md[f64_parts];
+        Vd ed[f64_parts];
+        Vd yd[f64_parts];
+        Vd nd[f64_parts];
+        Vd pd[f64_parts];
+        to_f64(m, md);
+        to_f64(e, ed);
+        to_f64(y, yd);
+        // Adding and subtracting 1.5 * 2^52 rounds to the nearest integer.
+        Vd const round = set1_f64(6755399441055744.0);
+        for(i64 h = 0; h < f64_parts; ++h) {
+            Vd const one = set1_f64(1.0);
+            Vd const s = div(sub(md[h], one), add(md[h], one));
+            Vd const z = mul(s, s);
+            // atanh(s) / s = sum of z^k / (2k + 1)
+            Vd a = set1_f64(1.0 / 29.0);
+            for(i32 k = 13; k >= 0; --k) {
+                a = fmadd(a, z, set1_f64(1.0 / (2 * k + 1)));
+            }
+            Vd const log2x = fmadd(mul(s, a), set1_f64(2.88539008177792681472), ed[h]);
+            Vd const w = mul(yd[h], log2x);
+            nd[h] = sub(add(w, round), round);
+            Vd const g = mul(sub(w, nd[h]), set1_f64(0.693147180559945309417));
+            // exp(g) for |g| <= ln(2) / 2
+            Vd p = set1_f64(1.0 / 362880.0);
+            p = fmadd(p, g, set1_f64(1.0 / 40320.0));
+            p = fmadd(p, g, set1_f64(1.0 / 5040.0));
+            p = fmadd(p, g, set1_f64(1.0 / 720.0));
+            p = fmadd(p, g, set1_f64(1.0 / 120.0));
+            p = fmadd(p, g, set1_f64(1.0 / 24.0));
+            p = fmadd(p, g, set1_f64(1.0 / 6.0));
+            p = fmadd(p, g, set1_f64(0.5));
+            p = fmadd(p, g, one);
+            pd[h] = fmadd(p, g, one);
+        }
+        // n is exact in f32 and 2^n is normal within the domain of pow.
+        Vi const n = to_i32(to_f32(nd));
+        Vf const scale = as_f32(shift_left<23>(add(n, set1_i32(127))));
+        return mul(to_f32(pd), scale);
+    }
+
+    // sin(x) and cos(x) sharing the reduction and the polynomials.
+    static void sincos_kernel(Vf const x, Vf& sin, Vf& cos) {
+        Vi q;
+        Vf const r = reduce_half_pi(x, q);
+        Vf const z = mul(r, r);
+        Vf const s = sin_poly(r, z);
+        Vf const c = cos_poly(z);
+        Mf const odd = test_bits(q, 1);
+        // sin(r + q * pi / 2) is negated in the quadrants 2 and 3, cos(r + q * pi / 2)
+        // in the quadrants 1 and 2.
+        Vi const sin_sign = shift_left<30>(bit_and(q, set1_i32(2)));
+        Vi const cos_sign = shift_left<30>(bit_and(add(q, set1_i32(1)), set1_i32(2)));
+        // The polynomial turns -0 into 0.
+        sin = select(greater(abs(x), set1(0.0f)), as_f32(bit_xor(as_i32(select(odd, c, s)), sin_sign)), x);
+        cos = as_f32(bit_xor(as_i32(select(odd, s, c)), cos_sign));
+    }
+
+    template<Unary_Function function>
+    [[nodiscard]] static Vf evaluate(Vf const x) {
+        if constexpr(function == Unary_Function::sin) {
+            Vi q;
+            Vf const r = reduce_half_pi(x, q);
+            // The polynomial turns -0 into 0.
+            return select(greater(abs(x), set1(0.0f)), sin_quadrant(r, q), x);
+        } else if constexpr(function == Unary_Function::cos) {
+            // cos(x) = sin(x + pi / 2)
+            Vi q;
+            Vf const r = reduce_half_pi(x, q);
+            return sin_quadrant(r, add(q, set1_i32(1)));
+        } else if constexpr(function == Unary_Function::tan) {
+            return select(greater(abs(x), set1(0.0f)), tan_kernel(x), x);
+        } else if constexpr(function == Unary_Function::asin) {
+            return asin_kernel(x);
+        } else if constexpr(function == Unary_Function::acos) {
+            return acos_kernel(x);
+        } else if constexpr(function == Unary_Function::atan) {
+            return atan_kernel(x);
+        } else if constexpr(function == Unary_Function::exp) {
+            return exp_kernel(x);
+        } else if constexpr(function == Unary_Function::log) {
+            return log_kernel(x);
+        } else {
+            return log2_kernel(x);
+        }
+    }
+
+    // in_domain
+    // Lanes of x for which evaluate is accurate. The comparisons are false for nan.
+    //
+    template<Unary_Function function>
+    [[nodiscard]] static Mf in_domain(Vf const x) {
+        if constexpr(function == Unary_Function::sin || function == Unary_Function::cos || function == Unary_Function::tan) {
+            return greater(set1(65536.0f), abs(x));
+        } else if constexpr(function == Unary_Function::asin || function == Unary_Function::acos) {
+            // |x| <= 1
+            return greater(set1(1.00000012f), abs(x));
+        } else if constexpr(function == Unary_Function::atan) {
+            return greater(set1(infinity), abs(x));
+        } else if constexpr(function == Unary_Function::exp) {
+            // The result and 2^n are normal.
+            return mask_and(greater(x, set1(-87.3f)), greater(set1(88.37f), x));
+        } else {
+            // Positive normal numbers.
+            return mask_and(greater(x, set1(1.17549421e-38f)), greater(set1(infinity), x));
+        }
+    }
+
+    template<Unary_Function function>
+    [[nodiscard]] static f32 evaluate_libm(f32 const x) {
+        if constexpr(function == Unary_Function::sin) {
+            return ::sinf(x);
+        } else if constexpr(function == Unary_Function::cos) {
+            return ::cosf(x);
+        } else if constexpr(function == Unary_Function::tan) {
+            return ::tanf(x);
+        } else if constexpr(function == Unary_Function::asin) {
+            return ::asinf(x);
+        } else if constexpr(function == Unary_Function::acos) {
+            return ::acosf(x);
+        } else if constexpr(function == Unary_Function::atan) {
+            return ::atanf(x);
+        } else if constexpr(function == Unary_Function::exp) {
+            return ::expf(x);
+        } else if constexpr(function == Unary_Function::log) {
+            return ::logf(x);
+        } else {
+            return ::log2f(x);
+        }
+    }
+
+    constexpr u32 all_lanes = (u32)((1ULL << lanes) - 1);
+
+    template<Unary_Function function>
+    static void unary_function_impl(f32 const* const in, f32* const out, i64 const count) {
+        for_each_soa_block<1, 1>({in}, {out}, count, [](auto const& i, auto const& o) {
+            Vf const x = loadu(i[0]);
+            storeu(o[0], evaluate<function>(x));
+            u32 const domain = mask_bits(in_domain<function>(x));
+            if(domain != all_lanes) {
+                for(i64 l = 0; l < lanes; ++l) {
+                    if(!((domain >> l) & 1)) {
+                        o[0][l] = evaluate_libm<function>(i[0][l]);
+                    }
+                }
+            }
+        });
+    }
+
+    static void unary_function(Unary_Function const function, f32 const* const in, f32* const out, i64 const count) {
+        switch(function) {
+            case Unary_Function::sin:
+                unary_function_impl<Unary_Function::sin>(in, out, count);
+                break;
+            case Unary_Function::cos:
+                unary_function_impl<Unary_Function::cos>(in, out, count);
+                break;
+            case Unary_Function::tan:
+                unary_function_impl<Unary_Function::tan>(in, out, count);
+                break;
+            case Unary_Function::asin:
+                unary_function_impl<Unary_Function::asin>(in, out, count);
+                break;
+            case Unary_Function::acos:
+                unary_function_impl<Unary_Function::acos>(in, out, count);
+                break;
+            case Unary_Function::atan:
+                unary_function_impl<Unary_Function::atan>(in, out, count);
+                break;
+            case Unary_Function::exp:
+                unary_function_impl<Unary_Function::exp>(in, out, count);
+                break;
+            case Unary_Function::log:
+                unary_function_impl<Unary_Function::log>(in, out, count);
+                break;
+            case Unary_Function::log2:
+                unary_function_impl<Unary_Function::log2>(in, out, count);
+                break;
+        }
+    }
+
+    static void atan2_impl(f32 const* const y, f32 const* const x, f32* const out, i64 const count) {
+        for_each_soa_block<2, 1>({y, x}, {out}, count, [](auto const& i, auto const& o) {
+            Vf const vy = loadu(i[0]);
+            Vf const vx = loadu(i[1]);
+            storeu(o[0], atan2_kernel(vy, vx));
+            // Finite and non-zero arguments. Signed zeros are left to the C library.
+            Vf const ay = abs(vy);
+            Vf const ax = abs(vx);
+            Vf const zero = set1(0.0f);
+            Vf const inf = set1(infinity);
+            Mf const finite = mask_and(greater(inf, ay), greater(inf, ax));
+            u32 const domain = mask_bits(mask_and(finite, mask_and(greater(ay, zero), greater(ax, zero))));
+            if(domain != all_lanes) {
+                for(i64 l = 0; l < lanes; ++l) {
+                    if(!((domain >> l) & 1)) {
+                        o[0][l] = ::atan2f(i[0][l], i[1][l]);
+                    }
+                }
+            }
+        });
+    }
+
+    static void pow_impl(f32 const* const x, f32 const* const y, f32* const out, i64 const count) {
+        for_each_soa_block<2, 1>({x, y}, {out}, count, [](auto const& i, auto const& o) {
+            Vf const vx = loadu(i[0]);
+            Vf const vy = loadu(i[1]);
+            storeu(o[0], pow_kernel(vx, vy));
+            // Positive normal x, finite y and y * log2(x) in (-125.5, 127.5) so that
+            // the result is normal. The bound on y * log2(x) is checked with the
+            // f32 approximation of log2.
+            Vf const inf = set1(infinity);
+            Mf const normal_x = mask_and(greater(vx, set1(1.17549421e-38f)), greater(inf, vx));
+            Vf const w = mul(vy, log2_kernel(vx));
+            Mf const in_range = mask_and(greater(w, set1(-125.0f)), greater(set1(127.0f), w));
+            u32 const domain = mask_bits(mask_and(mask_and(normal_x, greater(inf, abs(vy))), in_range));
+            if(domain != all_lanes) {
+                for(i64 l = 0; l < lanes; ++l) {
+                    if(!((domain >> l) & 1)) {
+                        o[0][l] = ::powf(i[0][l], i[1][l]);
+                    }
+                }
+            }
+        });
+    }
+
+    static void sincos(f32 const* const in, f32* const sin, f32* const cos, i64 const count) {
+        for_each_soa_block<1, 2>({in}, {sin, cos}, count, [](auto const& i, auto const& o) {
+            Vf const x = loadu(i[0]);
+            Vf s;
+            Vf c;
+            sincos_kernel(x, s, c);
+            storeu(o[0], s);
+            storeu(o[1], c);
+            u32 const domain = mask_bits(in_domain<Unary_Function::sin>(x));
+            if(domain != all_lanes) {
+                for(i64 l = 0; l < lanes; ++l) {
+                    if(!((domain >> l) & 1)) {
+                        o[0][l] = ::sinf(i[0][l]);
+                        o[1][l] = ::cosf(i[0][l]);
+                    }
+                }
+            }
+        });
+    }
+
+    static void binary_function(Binary_Function const function, f32 const* const a, f32 const* const b, f32* const out, i64 const count) {
+        switch(function) {
+            case Binary_Function::atan2:
+                atan2_impl(a, b, out, count);
+                break;
+            case Binary_Function::pow:
+                pow_impl(a, b, out, count);
+                break;
+        }
+    }
+
+    // Interpolation of unit vectors and quaternions
+    //
+
+    // corrected_nlerp_t
+    // The parameter for which nlerp approximates slerp with the parameter t. The exact
+    // parameter is sin(t * angle) / (sin(t * angle) + sin((1 - t) * angle)). It is
+    // approximated with t + t * (t - 0.5) * (t - 1) * k(d, (t - 0.5)^2), where k is a
+    // polynomial fitted to minimize the maximum angle between the results for the cosine
+    // of the angle d in [0, 1]. The angle stays below 3e-5 radians.
+    //
+    [[nodiscard]] static Vf corrected_nlerp_t(Vf const t, Vf const d) {
+        Vf const dc = max(d, set1(0.0f));
+        Vf const h = sub(t, set1(0.5f));
+        Vf const s = mul(h, h);
+        Vf const k0 = fmadd(fmadd(fmadd(set1(-0.120826973f), dc, set1(0.402415702f)), dc, set1(-1.14445885f)), dc, set1(0.859373379f));
+        Vf const k1 = fmadd(fmadd(fmadd(set1(-0.212036507f), dc, set1(1.33916146f)), dc, set1(-1.92123193f)), dc, set1(0.810150381f));
+        Vf const k2 = fmadd(fmadd(fmadd(set1(-3.90068604f), dc, set1(7.61623697f)), dc, set1(-5.07407631f)), dc, set1(1.21091464f));
+        Vf const k = fmadd(fmadd(k2, s, k1), s, k0);
+        return fmadd(mul(mul(t, h), sub(t, set1(1.0f))), k, t);
+    }
+
+    // soa_slerp_impl
+    // With varying, t is an array of count parameters of the elements, otherwise t[0]
+    // is the parameter of all elements.
+    //
+    template<i64 components, bool varying>
+    static void soa_slerp_impl(Slerp_Method const method, f32 const* const* const a, f32 const* const* const b, f32 const* const t,
+                               f32* const* const out, i64 const count) {
+        constexpr i64 n_in = varying ? 2 * components + 1 : 2 * components;
+        f32 const* in[n_in];
+        f32* o[components];
+        for(i64 c = 0; c < components; ++c) {
+            in[c] = a[c];
+            in[components + c] = b[c];
+            o[c] = out[c];
+        }
+        if constexpr(varying) {
+            in[2 * components] = t;
+        }
+        Vf const t_all = set1(t[0]);
+        for_each_soa_block<n_in, components>(in, o, count, [method, t_all](auto const& in, auto const& o) {
+            Vf va[components];
+            Vf vb[components];
+            for(i64 c = 0; c < components; ++c) {
+                va[c] = loadu(in[c]);
+                vb[c] = loadu(in[components + c]);
+            }
+            Vf vt = t_all;
+            if constexpr(varying) {
+                vt = loadu(in[2 * components]);
+            }
+            Vf d = mul(va[0], vb[0]);
+            for(i64 c = 1; c < components; ++c) {
+                d = fmadd(va[c], vb[c], d);
+            }
+            if constexpr(components == 4) {
+                // Take the shorter path by negating b when the quaternions are in the
+                // opposite hemispheres.
+                Vf const sign = as_f32(bit_and(as_i32(d), set1_i32((i32)0x80000000)));
+                for(i64 c = 0; c < components; ++c) {
+                    vb[c] = as_f32(bit_xor(as_i32(vb[c]), as_i32(sign)));
+                }
+                d = abs(d);
+            }
+
+            if(method == Slerp_Method::exact) {
+                // The factors fall back to those of lerp when the angle rounds to 0.
+                Vf const angle = acos_kernel(min(d, set1(1.0f)));
+                Mf const non_zero = greater(angle, set1(0.0f));
+                Vf const inv_sin_angle = div(set1(1.0f), evaluate<Unary_Function::sin>(angle));
+                Vf const f0 = select(non_zero, mul(evaluate<Unary_Function::sin>(mul(sub(set1(1.0f), vt), angle)), inv_sin_angle), sub(set1(1.0f), vt));
+                Vf const f1 = select(non_zero, mul(evaluate<Unary_Function::sin>(mul(vt, angle)), inv_sin_angle), vt);
+                for(i64 c = 0; c < components; ++c) {
+                    storeu(o[c], fmadd(f0, va[c], mul(f1, vb[c])));
+                }
+            } else {
+                Vf const u = method == Slerp_Method::nlerp_corrected ? corrected_nlerp_t(vt, d) : vt;
+                Vf const s = sub(set1(1.0f), u);
+                Vf r[components];
+                Vf length_squared = set1(0.0f);
+                for(i64 c = 0; c < components; ++c) {
+                    r[c] = fmadd(s, va[c], mul(u, vb[c]));
+                    length_squared = fmadd(r[c], r[c], length_squared);
+                }
+                // Opposite vectors interpolated halfway remain 0.
+                Vf const scale = select(greater(length_squared, set1(0.0f)), div(set1(1.0f), sqrt(length_squared)), set1(0.0f));
+                for(i64 c = 0; c < components; ++c) {
+                    storeu(o[c], mul(r[c], scale));
+                }
+            }
+        });
+    }
+
+    static void soa_slerp(Slerp_Method const method, f32 const* const* const a, f32 const* const* const b, i64 const components, f32 const t,
+                          f32* const* const out, i64 const count) {
+        if(components == 3) {
+            soa_slerp_impl<3, false>(method, a, b, &t, out, count);
+        } else {
+            soa_slerp_impl<4, false>(method, a, b, &t, out, count);
+        }
+    }
+
+    static void soa_slerp_varying(Slerp_Method const method, f32 const* const* const a, f32 const* const* const b, i64 const components,
+                                  f32 const* const t, f32* const* const out, i64 const count) {
+        if(count == 0) {
+            return;
+        }
+
+        if(components == 3) {
+            soa_slerp_impl<3, true>(method, a, b, t, out, count);
+        } else {
+            soa_slerp_impl<4, true>(method, a, b, t, out, count);
+        }
+    }
+
+    template<i64 components>
+    static void soa_blend_impl(f32 const* const* const in, f32 const* const weights, i64 const input_count, f32* const* const out, i64 const count) {
+        // block(load, store) blends lanes elements. load(p) loads the elements of the
+        // block from the array p of an input, store(p, v) stores them to the array p of
+        // the output. The remainder is processed through temporary blocks, hence every
+        // element is processed by the same code.
+        auto block = [in, weights, input_count, out](auto const& load, auto const& store) {
+            Vf r[components];
+            Vf first[components];
+            Vf const w0 = set1(weights[0]);
+            for(i64 c = 0; c < components; ++c) {
+                first[c] = load(in[c]);
+                r[c] = mul(w0, first[c]);
+            }
+            for(i64 k = 1; k < input_count; ++k) {
+                Vf v[components];
+                for(i64 c = 0; c < components; ++c) {
+                    v[c] = load(in[k * components + c]);
+                }
+                Vf w = set1(weights[k]);
+                if constexpr(components == 4) {
+                    // Negate the quaternions in the opposite hemisphere of the first one.
+                    Vf d = mul(first[0], v[0]);
+                    for(i64 c = 1; c < components; ++c) {
+                        d = fmadd(first[c], v[c], d);
+                    }
+                    w = as_f32(bit_xor(as_i32(w), bit_and(as_i32(d), set1_i32((i32)0x80000000))));
+                }
+                for(i64 c = 0; c < components; ++c) {
+                    r[c] = fmadd(w, v[c], r[c]);
+                }
+            }
+            if constexpr(components == 4) {
+                Vf length_squared = mul(r[0], r[0]);
+                for(i64 c = 1; c < components; ++c) {
+                    length_squared = fmadd(r[c], r[c], length_squared);
+                }
+                Vf const scale = select(greater(length_squared, set1(0.0f)), div(set1(1.0f), sqrt(length_squared)), set1(0.0f));
+                for(i64 c = 0; c < components; ++c) {
+                    r[c] = mul(r[c], scale);
+                }
+            }
+            for(i64 c = 0; c < components; ++c) {
+                store(out[c], r[c]);
+            }
+        };
+
+        i64 i = 0;
+        for(; i + lanes <= count; i += lanes) {
+            block([i](f32 const* const p) { return loadu(p + i); }, [i](f32* const p, Vf const v) { storeu(p + i, v); });
+        }
+
+        i64 const remainder = count - i;
+        if(remainder > 0) {
+            auto const load = [i, remainder](f32 const* const p) {
+                f32 tmp[lanes] = {};
+                for(i64 e = 0; e < remainder; ++e) {
+                    tmp[e] = p[i + e];
+                }
+                return loadu(tmp);
+            };
+            auto const store = [i, remainder](f32* const p, Vf const v) {
+                f32 tmp[lanes];
+                storeu(tmp, v);
+                for(i64 e = 0; e < remainder; ++e) {
+                    p[i + e] = tmp[e];
+                }
+            };
+            block(load, store);
+        }
+    }
+
+    static void soa_blend(f32 const* const* const in, f32 const* const weights, i64 const input_count, i64 const components, f32* const* const out,
+                          i64 const count) {
+        if(components == 3) {
+            soa_blend_impl<3>(in, weights, input_count, out, count);
+        } else {
+            soa_blend_impl<4>(in, weights, input_count, out, count);
+        }
+    }
+
+    enum struct Vec3_Mode {
+        // w = 1.
+        point,
+        // w = 0.
+        direction,
+        // w = 1 followed by the division by the resulting w.
+        projective,
+    };
+
+    template<Vec3_Mode mode>
+    static void transform_vec3(Mat4 const& m, Vec3 const* const in, Vec3* const out, i64 const count) {
+        // a[4 * column + row]
+        f32 const* const a = elements(&m);
+        Vf const m00 = set1(a[0]), m10 = set1(a[1]), m20 = set1(a[2]), m30 = set1(a[3]);
+        Vf const m01 = set1(a[4]), m11 = set1(a[5]), m21 = set1(a[6]), m31 = set1(a[7]);
+        Vf const m02 = set1(a[8]), m12 = set1(a[9]), m22 = set1(a[10]), m32 = set1(a[11]);
+        Vf const m03 = set1(a[12]), m13 = set1(a[13]), m23 = set1(a[14]), m33 = set1(a[15]);
+        for_each_block<3, 3>(elements(in), elements(out), count, [&](f32 const* const src, f32* const dst) {
+            Vf x;
+            Vf y;
+            Vf z;
+            load_vec3(src, x, y, z);
+            if constexpr(mode == Vec3_Mode::direction) {
+                Vf const rx = fmadd(m00, x, fmadd(m01, y, mul(m02, z)));
+                Vf const ry = fmadd(m10, x, fmadd(m11, y, mul(m12, z)));
+                Vf const rz = fmadd(m20, x, fmadd(m21, y, mul(m22, z)));
+                store_vec3(dst, rx, ry, rz);
+            } else {
+                Vf const rx = fmadd(m00, x, fmadd(m01, y, fmadd(m02, z, m03)));
+                Vf const ry = fmadd(m10, x, fmadd(m11, y, fmadd(m12, z, m13)));
+                Vf const rz = fmadd(m20, x, fmadd(m21, y, fmadd(m22, z, m23)));
+                if constexpr(mode == Vec3_Mode::projective) {
+                    Vf const rw = fmadd(m30, x, fmadd(m31, y, fmadd(m32, z, m33)));
+                    store_vec3(dst, div(rx, rw), div(ry, rw), div(rz, rw));
+                } else {
+                    store_vec3(dst, rx, ry, rz);
+                }
+            }
+        });
+    }
+
+    static void transform_points(Mat4 const& m, Vec3 const* const in, Vec3* const out, i64 const count) {
+        transform_vec3<Vec3_Mode::point>(m, in, out, count);
+    }
+
+    static void transform_directions(Mat4 const& m, Vec3 const* const in, Vec3* const out, i64 const count) {
+        transform_vec3<Vec3_Mode::direction>(m, in, out, count);
+    }
+
+    static void transform_points_projective(Mat4 const& m, Vec3 const* const in, Vec3* const out, i64 const count) {
+        transform_vec3<Vec3_Mode::projective>(m, in, out, count);
+    }
+
+    static void transform_vec4(Mat4 const& m, Vec4 const* const in, Vec4* const out, i64 const count) {
+        f32 const* const l = elements(&m);
+        f32 const* const r = elements(in);
+        f32* const o = elements(out);
+        // Each Vec4 is computed as a linear combination of the columns of m. With
+        // AVX2 and AVX-512 the columns are broadcast across the 128-bit lanes
+        // to transform 2 or 4 vectors at a time.
+#if ANTON_MATH_KERNEL_LEVEL >= 1
+        __m128 const c0 = _mm_loadu_ps(l);
+        __m128 const c1 = _mm_loadu_ps(l + 4);
+        __m128 const c2 = _mm_loadu_ps(l + 8);
+        __m128 const c3 = _mm_loadu_ps(l + 12);
+        i64 i = 0;
+#    if ANTON_MATH_KERNEL_LEVEL >= 3
+        __m512 const w0 = _mm512_broadcast_f32x4(c0);
+        __m512 const w1 = _mm512_broadcast_f32x4(c1);
+        __m512 const w2 = _mm512_broadcast_f32x4(c2);
+        __m512 const w3 = _mm512_broadcast_f32x4(c3);
+        for(; i + 4 <= count; i += 4) {
+            __m512 const v = _mm512_loadu_ps(r + 4 * i);
+            __m512 result = _mm512_mul_ps(w0, _mm512_permute_ps(v, 0x00));
+            result = _mm512_fmadd_ps(w1, _mm512_permute_ps(v, 0x55), result);
+            result = _mm512_fmadd_ps(w2, _mm512_permute_ps(v, 0xAA), result);
+            result = _mm512_fmadd_ps(w3, _mm512_permute_ps(v, 0xFF), result);
+            _mm512_storeu_ps(o + 4 * i, result);
+        }
+#    elif ANTON_MATH_KERNEL_LEVEL >= 2
+        __m256 const w0 = _mm256_insertf128_ps(_mm256_castps128_ps256(c0), c0, 1);
+        __m256 const w1 = _mm256_insertf128_ps(_mm256_castps128_ps256(c1), c1, 1);
+        __m256 const w2 = _mm256_insertf128_ps(_mm256_castps128_ps256(c2), c2, 1);
+        __m256 const w3 = _mm256_insertf128_ps(_mm256_castps128_ps256(c3), c3, 1);
+        for(; i + 2 <= count; i += 2) {
+            __m256 const v = _mm256_loadu_ps(r + 4 * i);
+            __m256 result = _mm256_mul_ps(w0, _mm256_permute_ps(v, 0x00));
+            result = _mm256_fmadd_ps(w1, _mm256_permute_ps(v, 0x55), result);
+            result = _mm256_fmadd_ps(w2, _mm256_permute_ps(v, 0xAA), result);
+            result = _mm256_fmadd_ps(w3, _mm256_permute_ps(v, 0xFF), result);
+            _mm256_storeu_ps(o + 4 * i, result);
+        }
+#    endif
+        for(; i < count; ++i) {
+            __m128 const v = _mm_loadu_ps(r + 4 * i);
+            __m128 const r0 = _mm_add_ps(_mm_mul_ps(c0, _mm_shuffle_ps(v, v, 0x00)), _mm_mul_ps(c1, _mm_shuffle_ps(v, v, 0x55)));
+            __m128 const r1 = _mm_add_ps(_mm_mul_ps(c2, _mm_shuffle_ps(v, v, 0xAA)), _mm_mul_ps(c3, _mm_shuffle_ps(v, v, 0xFF)));
+            _mm_storeu_ps(o + 4 * i, _mm_add_ps(r0, r1));
+        }
+#else
+        for(i64 i = 0; i < count; ++i) {
+            f32 const v0 = r[4 * i];
+            f32 const v1 = r[4 * i + 1];
+            f32 const v2 = r[4 * i + 2];
+            f32 const v3 = r[4 * i + 3];
+            for(i64 e = 0; e < 4; ++e) {
+                o[4 * i + e] = v0 * l[e] + v1 * l[4 + e] + v2 * l[8 + e] + v3 * l[12 + e];
+            }
+        }
+#endif
+    }
+
+    // Dual quaternion skinning
+
+    // blend_dual_quats
+    // Writes the weighted sums of the dual quaternions of the 4 influences of count
+    // vertices to out, 8 floats per vertex. An influence whose real part lies in the
+    // opposite hemisphere of the real part of the first influence is negated, so that
+    // the sum blends the rotations along the shorter path. A dual quaternion fits in a
+    // 256-bit vector or in two 128-bit vectors, hence the palette is read without
+    // transposition.
+    //
+    static void blend_dual_quats(f32 const* const palette, u16 const* const bones, f32 const* const weights, f32* const out, i64 const count) {
+        for(i64 i = 0; i < count; ++i) {
+            f32 const* q[4];
+            for(i64 k = 0; k < 4; ++k) {
+                q[k] = palette + 8 * bones[4 * i + k];
+            }
+#if ANTON_MATH_KERNEL_LEVEL >= 2
+            // The sign of the dot product of the real parts is transferred to the
+            // weight with a xor.
+            __m256 const q0 = _mm256_loadu_ps(q[0]);
+            __m128 const real0 = _mm256_castps256_ps128(q0);
+            __m128 const sign_mask = _mm_set_ss(-0.0f);
+            __m256 sum = _mm256_mul_ps(_mm256_set1_ps(weights[4 * i]), q0);
+            for(i64 k = 1; k < 4; ++k) {
+                __m256 const qk = _mm256_loadu_ps(q[k]);
+                __m128 const sign = _mm_and_ps(_mm_dp_ps(real0, _mm256_castps256_ps128(qk), 0xF1), sign_mask);
+                __m256 const w = _mm256_broadcastss_ps(_mm_xor_ps(_mm_set_ss(weights[4 * i + k]), sign));
+                sum = _mm256_fmadd_ps(w, qk, sum);
+            }
+            _mm256_storeu_ps(out + 8 * i, sum);
+#else
+            f32 w[4];
+            for(i64 k = 0; k < 4; ++k) {
+                f32 const d = q[0][0] * q[k][0] + q[0][1] * q[k][1] + q[0][2] * q[k][2] + q[0][3] * q[k][3];
+                w[k] = d < 0.0f ? -weights[4 * i + k] : weights[4 * i + k];
+            }
+#    if ANTON_MATH_KERNEL_LEVEL >= 1
+            __m128 real = _mm_mul_ps(_mm_set1_ps(w[0]), _mm_loadu_ps(q[0]));
+            __m128 dual = _mm_mul_ps(_mm_set1_ps(w[0]), _mm_loadu_ps(q[0] + 4));
+            for(i64 k = 1; k < 4; ++k) {
+                __m128 const wk = _mm_set1_ps(w[k]);
+                real = _mm_add_ps(real, _mm_mul_ps(wk, _mm_loadu_ps(q[k])));
+                dual = _mm_add_ps(dual, _mm_mul_ps(wk, _mm_loadu_ps(q[k] + 4)));
+            }
+            _mm_storeu_ps(out + 8 * i, real);
+            _mm_storeu_ps(out + 8 * i + 4, dual);
+#    else
+            for(i64 c = 0; c < 8; ++c) {
+                out[8 * i + c] = w[0] * q[0][c] + w[1] * q[1][c] + w[2] * q[2][c] + w[3] * q[3][c];
+            }
+#    endif
+#endif
+        }
+    }
+
+    // rotate_vec3
+    // Rotates the vectors (x, y, z) by the unit quaternions q.
+    // v' = v + w * t + cross(q.xyz, t) where t = 2 * cross(q.xyz, v).
+    //
+    static void rotate_vec3(Vf const (&q)[4], Vf& x, Vf& y, Vf& z) {
+        Vf const two = set1(2.0f);
+        Vf const tx = mul(two, sub(mul(q[1], z), mul(q[2], y)));
+        Vf const ty = mul(two, sub(mul(q[2], x), mul(q[0], z)));
+        Vf const tz = mul(two, sub(mul(q[0], y), mul(q[1], x)));
+        x = fmadd(q[3], tx, add(x, sub(mul(q[1], tz), mul(q[2], ty))));
+        y = fmadd(q[3], ty, add(y, sub(mul(q[2], tx), mul(q[0], tz))));
+        z = fmadd(q[3], tz, add(z, sub(mul(q[0], ty), mul(q[1], tx))));
+    }
+
+    // skin_block
+    // Transforms lanes positions and, unless normals is nullptr, lanes normals by the
+    // blended dual quaternions, which are normalized first.
+    //
+    static void skin_block(f32 const* const blended, f32 const* const positions, f32 const* const normals, f32* const out_positions,
+                           f32* const out_normals) {
+        Vf real[4];
+        Vf dual[4];
+#if ANTON_MATH_KERNEL_LEVEL >= 1
+        load_columns<8>(blended, real);
+        transpose4(real);
+        load_columns<8>(blended + 4, dual);
+        transpose4(dual);
+#else
+        for(i64 c = 0; c < 4; ++c) {
+            real[c] = blended[c];
+            dual[c] = blended[4 + c];
+        }
+#endif
+        Vf const inv_length = div(set1(1.0f), sqrt(fmadd(real[0], real[0], fmadd(real[1], real[1], fmadd(real[2], real[2], mul(real[3], real[3]))))));
+        for(i64 c = 0; c < 4; ++c) {
+            real[c] = mul(real[c], inv_length);
+            dual[c] = mul(dual[c], inv_length);
+        }
+
+        // The translation is the vector part of 2 * dual * conjugate(real), that is
+        // 2 * (real.w * dual.xyz - dual.w * real.xyz + cross(real.xyz, dual.xyz)). The
+        // component of dual parallel to real does not contribute to it.
+        Vf const two = set1(2.0f);
+        Vf const tx = mul(two, fmadd(real[3], dual[0], sub(sub(mul(real[1], dual[2]), mul(real[2], dual[1])), mul(dual[3], real[0]))));
+        Vf const ty = mul(two, fmadd(real[3], dual[1], sub(sub(mul(real[2], dual[0]), mul(real[0], dual[2])), mul(dual[3], real[1]))));
+        Vf const tz = mul(two, fmadd(real[3], dual[2], sub(sub(mul(real[0], dual[1]), mul(real[1], dual[0])), mul(dual[3], real[2]))));
+
+        Vf x;
+        Vf y;
+        Vf z;
+        load_vec3(positions, x, y, z);
+        rotate_vec3(real, x, y, z);
+        store_vec3(out_positions, add(x, tx), add(y, ty), add(z, tz));
+        if(normals != nullptr) {
+            load_vec3(normals, x, y, z);
+            rotate_vec3(real, x, y, z);
+            store_vec3(out_normals, x, y, z);
+        }
+    }
+
+    static void dual_quat_skin(Dual_Quat const* const palette, u16 const* const bones, f32 const* const weights, Vec3 const* const positions,
+                               Vec3 const* const normals, Vec3* const out_positions, Vec3* const out_normals, i64 const count) {
+        f32 const* const p = elements(palette);
+        f32 blended[8 * lanes];
+        i64 i = 0;
+        for(; i + lanes <= count; i += lanes) {
+            blend_dual_quats(p, bones + 4 * i, weights + 4 * i, blended, lanes);
+            skin_block(blended, elements(positions + i), normals != nullptr ? elements(normals + i) : nullptr, elements(out_positions + i),
+                       normals != nullptr ? elements(out_normals + i) : nullptr);
+        }
+
+        // The remainder is copied into temporary blocks like in for_each_block.
+        i64 const remainder = count - i;
+        if(remainder > 0) {
+            f32 tmp_blended[8 * lanes] = {};
+            f32 tmp_positions[3 * lanes] = {};
+            f32 tmp_normals[3 * lanes] = {};
+            f32 tmp_out_positions[3 * lanes];
+            f32 tmp_out_normals[3 * lanes];
+            blend_dual_quats(p, bones + 4 * i, weights + 4 * i, tmp_blended, remainder);
+            for(i64 e = 0; e < 3 * remainder; ++e) {
+                tmp_positions[e] = elements(positions + i)[e];
+                if(normals != nullptr) {
+                    tmp_normals[e] = elements(normals + i)[e];
+                }
+            }
+            skin_block(tmp_blended, tmp_positions, normals != nullptr ? tmp_normals : nullptr, tmp_out_positions, tmp_out_normals);
+            for(i64 e = 0; e < 3 * remainder; ++e) {
+                elements(out_positions + i)[e] = tmp_out_positions[e];
+                if(normals != nullptr) {
+                    elements(out_normals + i)[e] = tmp_out_normals[e];
+                }
+            }
+        }
+    }
+} // namespace anton::math::detail::ANTON_MATH_KERNEL_ISA
+
+namespace anton::math::detail {
+    Kernels const ANTON_MATH_KERNEL_CONCAT(kernels_, ANTON_MATH_KERNEL_ISA) = {
+        ANTON_MATH_KERNEL_ISA::mat4_multiply,
+        ANTON_MATH_KERNEL_ISA::mat4_multiply_lhs,
+        ANTON_MATH_KERNEL_ISA::mat4_multiply_rhs,
+        ANTON_MATH_KERNEL_ISA::mat4_inverse,
+        ANTON_MATH_KERNEL_ISA::mat4_inverse_affine,
+        ANTON_MATH_KERNEL_ISA::mat4_inverse_rigid,
+        ANTON_MATH_KERNEL_ISA::trs_compose_mat4,
+        ANTON_MATH_KERNEL_ISA::trs_compose_affine3,
+        ANTON_MATH_KERNEL_ISA::trs_decompose,
+        ANTON_MATH_KERNEL_ISA::transform_points,
+        ANTON_MATH_KERNEL_ISA::transform_directions,
+        ANTON_MATH_KERNEL_ISA::transform_points_projective,
+        ANTON_MATH_KERNEL_ISA::transform_vec4,
+        ANTON_MATH_KERNEL_ISA::dual_quat_skin,
+        ANTON_MATH_KERNEL_ISA::soa_elementwise,
+        ANTON_MATH_KERNEL_ISA::soa_elementwise_scalar,
+        ANTON_MATH_KERNEL_ISA::soa_lerp,
+        ANTON_MATH_KERNEL_ISA::soa_lerp_varying,
+        ANTON_MATH_KERNEL_ISA::soa_dot,
+        ANTON_MATH_KERNEL_ISA::soa_length,
+        ANTON_MATH_KERNEL_ISA::soa_normalize,
+        ANTON_MATH_KERNEL_ISA::soa_cross,
+        ANTON_MATH_KERNEL_ISA::soa_quat_multiply,
+        ANTON_MATH_KERNEL_ISA::soa_quat_rotate,
+        ANTON_MATH_KERNEL_ISA::soa_transform_directions,
+        ANTON_MATH_KERNEL_ISA::soa_slerp,
+        ANTON_MATH_KERNEL_ISA::soa_slerp_varying,
+        ANTON_MATH_KERNEL_ISA::soa_blend,
+        ANTON_MATH_KERNEL_ISA::aos_to_soa,
+        ANTON_MATH_KERNEL_ISA::soa_to_aos,
+        ANTON_MATH_KERNEL_ISA::unary_function,
+        ANTON_MATH_KERNEL_ISA::binary_function,
+        ANTON_MATH_KERNEL_ISA::sincos,
+    };
+} // namespace anton::math::detail
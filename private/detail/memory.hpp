@@ -0,0 +1,44 @@
+#pragma once
+
+#include <anton/types.hpp>
+
+namespace anton::math::detail {
+    // soa_capacity
+    // Rounds size up to a multiple of 16 floats (64 bytes) so that every component
+    // of a structure of arrays stays aligned to 64 bytes.
+    //
+    [[nodiscard]] i64 soa_capacity(i64 size);
+
+    // allocate_soa
+    // Allocates zero-initialized storage for count floats aligned to 64 bytes.
+    //
+    // Returns:
+    // nullptr if count is 0.
+    //
+    [[nodiscard]] f32* allocate_soa(i64 count);
+
+    // deallocate_soa
+    // Frees storage allocated with allocate_soa. data may be nullptr.
+    //
+    void deallocate_soa(f32* data);
+
+    void copy_floats(f32 const* src, f32* dst, i64 count);
+    void fill_floats(f32* dst, i64 count, f32 value);
+
+    // The storage of Vec3_Array, Vec4_Array and Quat_Array. data holds components
+    // arrays of capacity floats each, one after another, of which the first size
+    // elements are in use.
+
+    // resize_soa
+    // Changes size to new_size. When new_size exceeds capacity, the storage is
+    // reallocated with the greater of soa_capacity(new_size) and twice capacity floats
+    // per component and the elements are moved. Component c of the new elements is set to fill[c]. The floats past size are
+    // left as they are.
+    //
+    void resize_soa(f32*& data, i64& size, i64& capacity, i64 components, i64 new_size, f32 const* fill);
+
+    // copy_soa
+    // Copies the first size elements of every component of src to dst.
+    //
+    void copy_soa(f32 const* src, i64 src_capacity, f32* dst, i64 dst_capacity, i64 components, i64 size);
+} // namespace anton::math::detail
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <anton/types.hpp>
+#include <anton/math/executor.hpp>
+
+namespace anton::math::detail {
+    // parallel_alignment
+    // The chunks start at multiples of parallel_alignment elements. Equal to the lanes
+    // of the widest vectors of the kernels so that splitting an array does not change
+    // which elements the kernels process in their vector loops and which in their tails.
+    //
+    constexpr i64 parallel_alignment = 16;
+
+    // Minimum numbers of elements of a chunk, chosen so that a chunk takes at least
+    // about 10 microseconds, which amortizes the cost of waking up the threads.
+    //
+    // Matrix products, inverses, composition and decomposition.
+    constexpr i64 grain_matrix = 4096;
+    // Transformations, arithmetic and geometric functions of vectors and conversions
+    // between arrays of structures and structures of arrays.
+    constexpr i64 grain_vector = 16384;
+    // Elementary functions of floats.
+    constexpr i64 grain_function = 8192;
+
+    // gather_batch_size
+    // The number of elements that the functions gathering scattered inputs for the
+    // kernels, e.g. the nodes of a level of a hierarchy or the keys of tracks, collect
+    // into a batch at a time. The batches live on the stack and are small enough to
+    // stay in the L1 cache.
+    //
+    constexpr i64 gather_batch_size = 64;
+
+    struct Chunking {
+        i64 chunk_size;
+        i64 chunk_count;
+    };
+
+    // compute_chunking
+    // Splits count elements into chunks of at least grain elements, aiming for 4 times
+    // as many chunks as the executor is able to run simultaneously.
+    //
+    // Returns:
+    // A single chunk if the array is too small to be split.
+    //
+    [[nodiscard]] Chunking compute_chunking(Executor const& executor, i64 count, i64 grain);
+
+    // parallel_for
+    // Invokes function(begin, end) for consecutive chunks of [0, count) on the installed
+    // executor or a single time with the whole range if there is none.
+    //
+    template<typename Function>
+    void parallel_for(i64 const count, i64 const grain, Function const& function) {
+        Executor* const executor = get_executor();
+        if(executor == nullptr || count < 2 * grain) {
+            function(0, count);
+            return;
+        }
+
+        Chunking const chunking = compute_chunking(*executor, count, grain);
+        if(chunking.chunk_count == 1) {
+            function(0, count);
+            return;
+        }
+
+        struct Context {
+            Function const& function;
+            i64 chunk_size;
+            i64 count;
+        };
+
+        Context context{function, chunking.chunk_size, count};
+        executor->parallel_for(
+            chunking.chunk_count,
+            [](void* const data, i64 const index) {
+                Context const& context = *static_cast<Context const*>(data);
+                i64 const begin = index * context.chunk_size;
+                i64 const end = begin + context.chunk_size < context.count ? begin + context.chunk_size : context.count;
+                context.function(begin, end);
+            },
+            &context);
+    }
+} // namespace anton::math::detail
@@ -0,0 +1,146 @@
+#include <anton/math/dispatch.hpp>
+#include <detail/kernels.hpp>
+
+#if ANTON_MATH_KERNELS_X86
+#    if ANTON_COMPILER_MSVC
+#        include <intrin.h>
+#    else
+#        include <cpuid.h>
+#    endif
+#endif
+
+namespace anton::math {
+#if ANTON_MATH_KERNELS_X86
+    static void cpuid(u32 const leaf, u32 const subleaf, u32 (&registers)[4]) {
+#    if ANTON_COMPILER_MSVC
+        int r[4];
+        __cpuidex(r, (int)leaf, (int)subleaf);
+        for(i32 i = 0; i < 4; ++i) {
+            registers[i] = (u32)r[i];
+        }
+#    else
+        registers[0] = registers[1] = registers[2] = registers[3] = 0;
+        __get_cpuid_count(leaf, subleaf, &registers[0], &registers[1], &registers[2], &registers[3]);
+#    endif
+    }
+
+    // xgetbv
+    // Reads the XCR0 register which describes the register state enabled by the
+    // operating system. Must only be called when OSXSAVE is set.
+    //
+    static u64 xgetbv() {
+#    if ANTON_COMPILER_MSVC
+        return _xgetbv(0);
+#    else
+        u32 eax;
+        u32 edx;
+        __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+        return ((u64)edx << 32) | eax;
+#    endif
+    }
+
+    static Instruction_Set detect_instruction_set() {
+        u32 r[4];
+        cpuid(0, 0, r);
+        u32 const max_leaf = r[0];
+        cpuid(1, 0, r);
+        bool const sse2 = r[3] & (1u << 26);
+        bool const fma = r[2] & (1u << 12);
+        bool const osxsave = r[2] & (1u << 27);
+        bool const avx = r[2] & (1u << 28);
+        if(!sse2) {
+            return Instruction_Set::scalar;
+        }
+
+        if(!osxsave || !avx || max_leaf < 7) {
+            return Instruction_Set::sse2;
+        }
+
+        u64 const xcr0 = xgetbv();
+        // XMM and YMM state.
+        bool const os_avx = (xcr0 & 0x6) == 0x6;
+        // Opmask, upper halves of ZMM0-15 and ZMM16-31 state.
+        bool const os_avx512 = os_avx && (xcr0 & 0xE0) == 0xE0;
+        cpuid(7, 0, r);
+        bool const avx2 = r[1] & (1u << 5);
+        bool const avx512f = r[1] & (1u << 16);
+        if(os_avx512 && avx512f && avx2 && fma) {
+            return Instruction_Set::avx512;
+        } else if(os_avx && avx2 && fma) {
+            return Instruction_Set::avx2;
+        } else {
+            return Instruction_Set::sse2;
+        }
+    }
+#else
+    static Instruction_Set detect_instruction_set() {
+        return Instruction_Set::scalar;
+    }
+#endif
+
+    // Zero-initialized, i.e. scalar, until the dynamic initialization runs, hence
+    // kernels invoked during static initialization of other translation units
+    // work too.
+    static Instruction_Set selected_instruction_set = get_best_instruction_set();
+
+    char const* get_instruction_set_name(Instruction_Set const instruction_set) {
+        switch(instruction_set) {
+            case Instruction_Set::scalar:
+                return "scalar";
+            case Instruction_Set::sse2:
+                return "sse2";
+            case Instruction_Set::avx2:
+                return "avx2";
+            case Instruction_Set::avx512:
+                return "avx512";
+        }
+        return "unknown";
+    }
+
+    bool is_instruction_set_supported(Instruction_Set const instruction_set) {
+        return (u8)instruction_set <= (u8)get_best_instruction_set();
+    }
+
+    Instruction_Set get_best_instruction_set() {
+        static Instruction_Set const best = detect_instruction_set();
+        return best;
+    }
+
+    Instruction_Set get_instruction_set() {
+        return selected_instruction_set;
+    }
+
+    bool set_instruction_set(Instruction_Set const instruction_set) {
+        if(!is_instruction_set_supported(instruction_set)) {
+            return false;
+        }
+
+        selected_instruction_set = instruction_set;
+        return true;
+    }
+
+    namespace detail {
+        Kernels const& get_kernels(Instruction_Set const instruction_set) {
+            switch(instruction_set) {
+#if ANTON_MATH_KERNELS_X86
+                case Instruction_Set::avx512:
+                    return kernels_avx512;
+                case Instruction_Set::avx2:
+                    return kernels_avx2;
+                case Instruction_Set::sse2:
+                    return kernels_sse2;
+#endif
+                default:
+                    return kernels_scalar;
+            }
+        }
+
+        Kernels const& get_kernels() {
+#if ANTON_MATH_PROFILE
+            return kernels_profiled;
+#else
+            return get_kernels(selected_instruction_set);
+#endif
+        }
+    } // namespace detail
+} // namespace anton::math
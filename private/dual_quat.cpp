@@ -0,0 +1 @@
+#include <anton/math/detail/dual_quat_impl.hpp>
@@ -0,0 +1,220 @@
+#include <anton/math/executor.hpp>
+#include <detail/parallel.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace anton::math {
+    // Range
+    // The tasks that remain to be run by a thread. The owner takes tasks from the front,
+    // other threads steal from the back.
+    //
+    struct alignas(64) Range {
+        std::mutex mutex;
+        i64 begin = 0;
+        i64 end = 0;
+    };
+
+    struct Thread_Pool::Impl {
+        std::vector<std::thread> threads;
+        // One range per worker followed by the range of the thread calling parallel_for.
+        std::vector<Range> ranges;
+
+        // Serializes the calls to parallel_for.
+        std::mutex submit_mutex;
+
+        // Protects the fields below.
+        std::mutex mutex;
+        std::condition_variable wake;
+        std::condition_variable done;
+        // Incremented with every parallel_for. The workers join the job whenever they
+        // observe a new generation.
+        u64 generation = 0;
+        // The number of workers that have joined the current job and not left it yet.
+        i64 active = 0;
+        bool stop = false;
+
+        void (*task)(void*, i64) = nullptr;
+        void* context = nullptr;
+        // The number of tasks of the current job that have not completed.
+        std::atomic<i64> remaining{0};
+
+        // take
+        // Takes a task from the range of thread or steals the back half of the range
+        // of another thread.
+        //
+        // Returns:
+        // true and the index of the task in index if a task has been found.
+        //
+        bool take(i64 const thread, i64& index) {
+            Range& own = ranges[thread];
+            {
+                std::lock_guard<std::mutex> lock(own.mutex);
+                if(own.begin < own.end) {
+                    index = own.begin;
+                    own.begin += 1;
+                    return true;
+                }
+            }
+
+            i64 const range_count = ranges.size();
+            for(i64 i = 1; i < range_count; ++i) {
+                Range& victim = ranges[(thread + i) % range_count];
+                i64 begin;
+                i64 end;
+                {
+                    std::lock_guard<std::mutex> lock(victim.mutex);
+                    i64 const size = victim.end - victim.begin;
+                    if(size <= 0) {
+                        continue;
+                    }
+
+                    end = victim.end;
+                    begin = victim.end - (size + 1) / 2;
+                    victim.end = begin;
+                }
+
+                index = begin;
+                if(begin + 1 < end) {
+                    std::lock_guard<std::mutex> lock(own.mutex);
+                    own.begin = begin + 1;
+                    own.end = end;
+                }
+                return true;
+            }
+            return false;
+        }
+
+        // run
+        // Runs the tasks of the current job until there are none left to take.
+        //
+        void run(i64 const thread) {
+            i64 index;
+            while(take(thread, index)) {
+                task(context, index);
+                if(remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    done.notify_all();
+                }
+            }
+        }
+
+        void work(i64 const thread) {
+            u64 seen_generation = 0;
+            while(true) {
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    wake.wait(lock, [&] { return stop || generation != seen_generation; });
+                    if(stop) {
+                        return;
+                    }
+
+                    seen_generation = generation;
+                    active += 1;
+                }
+
+                run(thread);
+
+                std::lock_guard<std::mutex> lock(mutex);
+                active -= 1;
+                if(active == 0) {
+                    done.notify_all();
+                }
+            }
+        }
+    };
+
+    Thread_Pool::Thread_Pool(i64 thread_count): _impl(new Impl) {
+        if(thread_count <= 0) {
+            i64 const hardware_threads = std::thread::hardware_concurrency();
+            thread_count = hardware_threads > 1 ? hardware_threads - 1 : 0;
+        }
+
+        _impl->ranges = std::vector<Range>(thread_count + 1);
+        _impl->threads.reserve(thread_count);
+        for(i64 i = 0; i < thread_count; ++i) {
+            _impl->threads.emplace_back([impl = _impl, i] { impl->work(i); });
+        }
+    }
+
+    Thread_Pool::~Thread_Pool() {
+        {
+            std::lock_guard<std::mutex> lock(_impl->mutex);
+            _impl->stop = true;
+        }
+        _impl->wake.notify_all();
+        for(std::thread& thread: _impl->threads) {
+            thread.join();
+        }
+        delete _impl;
+    }
+
+    i64 Thread_Pool::get_thread_count() const {
+        return _impl->threads.size();
+    }
+
+    i64 Thread_Pool::get_concurrency() const {
+        return _impl->threads.size() + 1;
+    }
+
+    void Thread_Pool::parallel_for(i64 const task_count, void (*const task)(void* context, i64 index), void* const context) {
+        std::unique_lock<std::mutex> submit_lock(_impl->submit_mutex, std::try_to_lock);
+        if(!submit_lock.owns_lock() || _impl->threads.empty() || task_count <= 1) {
+            for(i64 i = 0; i < task_count; ++i) {
+                task(context, i);
+            }
+            return;
+        }
+
+        i64 const range_count = _impl->ranges.size();
+        i64 const caller = range_count - 1;
+        {
+            std::unique_lock<std::mutex> lock(_impl->mutex);
+            // Workers that observed the previous job late might still be looking for
+            // tasks. They must leave before the ranges are reused.
+            _impl->done.wait(lock, [&] { return _impl->active == 0; });
+            for(i64 i = 0; i < range_count; ++i) {
+                Range& range = _impl->ranges[i];
+                std::lock_guard<std::mutex> range_lock(range.mutex);
+                range.begin = task_count * i / range_count;
+                range.end = task_count * (i + 1) / range_count;
+            }
+            _impl->task = task;
+            _impl->context = context;
+            _impl->remaining.store(task_count, std::memory_order_relaxed);
+            _impl->generation += 1;
+        }
+        _impl->wake.notify_all();
+
+        _impl->run(caller);
+
+        std::unique_lock<std::mutex> lock(_impl->mutex);
+        _impl->done.wait(lock, [&] { return _impl->remaining.load(std::memory_order_acquire) == 0; });
+    }
+
+    static Executor* installed_executor = nullptr;
+
+    Executor* get_executor() {
+        return installed_executor;
+    }
+
+    void set_executor(Executor* const executor) {
+        installed_executor = executor;
+    }
+
+    namespace detail {
+        Chunking compute_chunking(Executor const& executor, i64 const count, i64 const grain) {
+            i64 const target_count = 4 * executor.get_concurrency();
+            i64 chunk_size = (count + target_count - 1) / target_count;
+            if(chunk_size < grain) {
+                chunk_size = grain;
+            }
+            chunk_size = (chunk_size + parallel_alignment - 1) / parallel_alignment * parallel_alignment;
+            i64 const chunk_count = (count + chunk_size - 1) / chunk_size;
+            return {chunk_size, chunk_count};
+        }
+    } // namespace detail
+} // namespace anton::math
@@ -0,0 +1 @@
+#include <anton/math/detail/fast_impl.hpp>
@@ -0,0 +1,236 @@
+#include <anton/math/hierarchy.hpp>
+#include <anton/math/detail/utility.hpp>
+#include <detail/kernels.hpp>
+#include <detail/parallel.hpp>
+
+namespace anton::math {
+    static i64* copy_indices(i64 const* const src, i64 const count) {
+        if(count == 0) {
+            return nullptr;
+        }
+
+        i64* const dst = new i64[count];
+        for(i64 i = 0; i < count; ++i) {
+            dst[i] = src[i];
+        }
+        return dst;
+    }
+
+    Hierarchy::Hierarchy(): _parents(nullptr), _nodes(nullptr), _level_offsets(new i64[1]{0}), _size(0), _level_count(0) {}
+
+    Hierarchy::Hierarchy(i64 const* const parents, i64 const count): Hierarchy() {
+        if(count == 0) {
+            return;
+        }
+
+        // Sort the children by their parents. The children of node i are
+        // children[child_offsets[i], child_offsets[i + 1]).
+        i64* const child_offsets = new i64[count + 1]{};
+        for(i64 i = 0; i < count; ++i) {
+            if(parents[i] >= 0) {
+                child_offsets[parents[i] + 1] += 1;
+            }
+        }
+        for(i64 i = 0; i < count; ++i) {
+            child_offsets[i + 1] += child_offsets[i];
+        }
+        i64* const children = new i64[child_offsets[count]];
+        i64* const child_ends = copy_indices(child_offsets, count);
+        for(i64 i = 0; i < count; ++i) {
+            if(parents[i] >= 0) {
+                children[child_ends[parents[i]]] = i;
+                child_ends[parents[i]] += 1;
+            }
+        }
+        delete[] child_ends;
+
+        // Breadth-first traversal from the roots lays the levels out one after another
+        // with the children of each node adjacent.
+        _parents = copy_indices(parents, count);
+        _nodes = new i64[count];
+        _size = count;
+        i64 end = 0;
+        for(i64 i = 0; i < count; ++i) {
+            if(parents[i] < 0) {
+                _nodes[end] = i;
+                end += 1;
+            }
+        }
+
+        // There are at most count levels. The offsets are copied to an array of the
+        // exact size once the number of levels is known.
+        i64* const level_offsets = new i64[count + 1];
+        level_offsets[0] = 0;
+        i64 begin = 0;
+        while(begin < end) {
+            _level_count += 1;
+            level_offsets[_level_count] = end;
+            i64 const level_end = end;
+            for(i64 i = begin; i < level_end; ++i) {
+                i64 const node = _nodes[i];
+                for(i64 c = child_offsets[node]; c < child_offsets[node + 1]; ++c) {
+                    _nodes[end] = children[c];
+                    end += 1;
+                }
+            }
+            begin = level_end;
+        }
+        delete[] children;
+        delete[] child_offsets;
+
+        delete[] _level_offsets;
+        _level_offsets = copy_indices(level_offsets, _level_count + 1);
+        delete[] level_offsets;
+    }
+
+    Hierarchy::Hierarchy(Hierarchy const& other)
+        : _parents(copy_indices(other._parents, other._size)), _nodes(copy_indices(other._nodes, other._size)),
+          _level_offsets(copy_indices(other._level_offsets, other._level_count + 1)), _size(other._size), _level_count(other._level_count) {}
+
+    Hierarchy::Hierarchy(Hierarchy&& other): Hierarchy() {
+        *this = static_cast<Hierarchy&&>(other);
+    }
+
+    Hierarchy::~Hierarchy() {
+        delete[] _parents;
+        delete[] _nodes;
+        delete[] _level_offsets;
+    }
+
+    Hierarchy& Hierarchy::operator=(Hierarchy const& other) {
+        if(this != &other) {
+            Hierarchy copy(other);
+            *this = static_cast<Hierarchy&&>(copy);
+        }
+        return *this;
+    }
+
+    Hierarchy& Hierarchy::operator=(Hierarchy&& other) {
+        detail::swap(_parents, other._parents);
+        detail::swap(_nodes, other._nodes);
+        detail::swap(_level_offsets, other._level_offsets);
+        detail::swap(_size, other._size);
+        detail::swap(_level_count, other._level_count);
+        return *this;
+    }
+
+    i64 Hierarchy::size() const {
+        return _size;
+    }
+
+    i64 const* Hierarchy::get_parents() const {
+        return _parents;
+    }
+
+    i64 Hierarchy::get_level_count() const {
+        return _level_count;
+    }
+
+    i64 const* Hierarchy::get_nodes() const {
+        return _nodes;
+    }
+
+    i64 Hierarchy::get_level_offset(i64 const level) const {
+        return _level_offsets[level];
+    }
+
+    // The nodes are gathered into batches of detail::gather_batch_size contiguous
+    // matrices for the kernels.
+
+    static void load_locals(detail::Kernels const& kernels, TRS const* const locals, i64 const* const nodes, i64 const count, Mat4* const out) {
+        TRS batch[detail::gather_batch_size];
+        for(i64 i = 0; i < count; ++i) {
+            batch[i] = locals[nodes[i]];
+        }
+        kernels.trs_compose_mat4(batch, out, count);
+    }
+
+    static void load_locals(detail::Kernels const&, Affine3 const* const locals, i64 const* const nodes, i64 const count, Mat4* const out) {
+        for(i64 i = 0; i < count; ++i) {
+            out[i] = to_mat4(locals[nodes[i]]);
+        }
+    }
+
+    static void load_locals(detail::Kernels const&, Mat4 const* const locals, i64 const* const nodes, i64 const count, Mat4* const out) {
+        for(i64 i = 0; i < count; ++i) {
+            out[i] = locals[nodes[i]];
+        }
+    }
+
+    // propagate
+    // Computes the world transformations level by level. When dirty is not nullptr,
+    // only the nodes that are dirty or have a dirty parent are recomputed and marked
+    // dirty. The parents belong to the previous level, hence their flags are final by
+    // the time the level is processed.
+    //
+    template<typename Local>
+    static void propagate(Hierarchy const& hierarchy, Local const* const locals, u8* const dirty, Mat4* const worlds) {
+        i64 const* const parents = hierarchy.get_parents();
+        for(i64 level = 0; level < hierarchy.get_level_count(); ++level) {
+            i64 const* const level_nodes = hierarchy.get_nodes() + hierarchy.get_level_offset(level);
+            i64 const level_size = hierarchy.get_level_offset(level + 1) - hierarchy.get_level_offset(level);
+            detail::parallel_for(level_size, detail::grain_matrix, [&](i64 const begin, i64 const end) {
+                detail::Kernels const& kernels = detail::get_kernels();
+                i64 nodes[detail::gather_batch_size];
+                Mat4 parent_worlds[detail::gather_batch_size];
+                Mat4 results[detail::gather_batch_size];
+                i64 i = begin;
+                while(i < end) {
+                    i64 count = 0;
+                    for(; i < end && count < detail::gather_batch_size; ++i) {
+                        i64 const node = level_nodes[i];
+                        if(dirty != nullptr) {
+                            i64 const parent = parents[node];
+                            if(!dirty[node] && (parent < 0 || !dirty[parent])) {
+                                continue;
+                            }
+                            dirty[node] = 1;
+                        }
+                        nodes[count] = node;
+                        count += 1;
+                    }
+
+                    if(count == 0) {
+                        continue;
+                    }
+
+                    load_locals(kernels, locals, nodes, count, results);
+                    if(level > 0) {
+                        for(i64 j = 0; j < count; ++j) {
+                            parent_worlds[j] = worlds[parents[nodes[j]]];
+                        }
+                        kernels.mat4_multiply(parent_worlds, results, results, count);
+                    }
+
+                    for(i64 j = 0; j < count; ++j) {
+                        worlds[nodes[j]] = results[j];
+                    }
+                }
+            });
+        }
+    }
+
+    void compute_world_transforms(Hierarchy const& hierarchy, TRS const* const locals, Mat4* const worlds) {
+        propagate(hierarchy, locals, nullptr, worlds);
+    }
+
+    void compute_world_transforms(Hierarchy const& hierarchy, Affine3 const* const locals, Mat4* const worlds) {
+        propagate(hierarchy, locals, nullptr, worlds);
+    }
+
+    void compute_world_transforms(Hierarchy const& hierarchy, Mat4 const* const locals, Mat4* const worlds) {
+        propagate(hierarchy, locals, nullptr, worlds);
+    }
+
+    void update_world_transforms(Hierarchy const& hierarchy, TRS const* const locals, u8* const dirty, Mat4* const worlds) {
+        propagate(hierarchy, locals, dirty, worlds);
+    }
+
+    void update_world_transforms(Hierarchy const& hierarchy, Affine3 const* const locals, u8* const dirty, Mat4* const worlds) {
+        propagate(hierarchy, locals, dirty, worlds);
+    }
+
+    void update_world_transforms(Hierarchy const& hierarchy, Mat4 const* const locals, u8* const dirty, Mat4* const worlds) {
+        propagate(hierarchy, locals, dirty, worlds);
+    }
+} // namespace anton::math
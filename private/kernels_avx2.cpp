@@ -0,0 +1,3 @@
+#define ANTON_MATH_KERNEL_ISA avx2
+#define ANTON_MATH_KERNEL_LEVEL 2
+#include <detail/kernels_impl.hpp>
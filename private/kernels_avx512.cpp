@@ -0,0 +1,14 @@
+#define ANTON_MATH_KERNEL_ISA avx512
+#define ANTON_MATH_KERNEL_LEVEL 3
+// GCC 12 reports the self-initialized temporaries of the _mm512_undefined_* idiom in
+// avx512fintrin.h as uninitialized wherever an intrinsic using them is inlined. The
+// warnings are silenced for the intrinsic headers only, which are included here ahead
+// of the kernels, so that they stay on for the kernels themselves.
+#if defined(__GNUC__) && !defined(__clang__)
+#    pragma GCC diagnostic push
+#    pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#    pragma GCC diagnostic ignored "-Wuninitialized"
+#    include <immintrin.h>
+#    pragma GCC diagnostic pop
+#endif
+#include <detail/kernels_impl.hpp>
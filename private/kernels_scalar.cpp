@@ -0,0 +1,3 @@
+#define ANTON_MATH_KERNEL_ISA scalar
+#define ANTON_MATH_KERNEL_LEVEL 0
+#include <detail/kernels_impl.hpp>
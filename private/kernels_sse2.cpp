@@ -0,0 +1,3 @@
+#define ANTON_MATH_KERNEL_ISA sse2
+#define ANTON_MATH_KERNEL_LEVEL 1
+#include <detail/kernels_impl.hpp>
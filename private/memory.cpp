@@ -0,0 +1,67 @@
+#include <detail/memory.hpp>
+
+#include <new>
+
+namespace anton::math::detail {
+    constexpr i64 soa_alignment = 64;
+
+    i64 soa_capacity(i64 const size) {
+        constexpr i64 floats = soa_alignment / sizeof(f32);
+        return (size + floats - 1) / floats * floats;
+    }
+
+    f32* allocate_soa(i64 const count) {
+        if(count == 0) {
+            return nullptr;
+        }
+
+        f32* const data = static_cast<f32*>(::operator new(count * sizeof(f32), std::align_val_t{soa_alignment}));
+        fill_floats(data, count, 0.0f);
+        return data;
+    }
+
+    void deallocate_soa(f32* const data) {
+        if(data != nullptr) {
+            ::operator delete(data, std::align_val_t{soa_alignment});
+        }
+    }
+
+    void copy_floats(f32 const* const src, f32* const dst, i64 const count) {
+        for(i64 i = 0; i < count; ++i) {
+            dst[i] = src[i];
+        }
+    }
+
+    void fill_floats(f32* const dst, i64 const count, f32 const value) {
+        for(i64 i = 0; i < count; ++i) {
+            dst[i] = value;
+        }
+    }
+
+    void resize_soa(f32*& data, i64& size, i64& capacity, i64 const components, i64 const new_size, f32 const* const fill) {
+        if(new_size > capacity) {
+            // Growing by at least twice the capacity keeps repeated growth by few elements
+            // amortized linear.
+            i64 const required_capacity = soa_capacity(new_size);
+            i64 const new_capacity = required_capacity > 2 * capacity ? required_capacity : 2 * capacity;
+            f32* const new_data = allocate_soa(components * new_capacity);
+            copy_soa(data, capacity, new_data, new_capacity, components, size);
+            deallocate_soa(data);
+            data = new_data;
+            capacity = new_capacity;
+        }
+
+        if(new_size > size) {
+            for(i64 c = 0; c < components; ++c) {
+                fill_floats(data + c * capacity + size, new_size - size, fill[c]);
+            }
+        }
+        size = new_size;
+    }
+
+    void copy_soa(f32 const* const src, i64 const src_capacity, f32* const dst, i64 const dst_capacity, i64 const components, i64 const size) {
+        for(i64 c = 0; c < components; ++c) {
+            copy_floats(src + c * src_capacity, dst + c * dst_capacity, size);
+        }
+    }
+} // namespace anton::math::detail
@@ -0,0 +1,316 @@
+#include <anton/math/profile.hpp>
+
+#include <anton/math/dispatch.hpp>
+#include <detail/kernels.hpp>
+
+#if ANTON_MATH_PROFILE
+#    include <atomic>
+#    if defined(__linux__)
+#        include <linux/perf_event.h>
+#        include <sys/ioctl.h>
+#        include <sys/syscall.h>
+#        include <unistd.h>
+#    endif
+#endif
+
+namespace anton::math {
+    Perf_Counters operator+(Perf_Counters const& lhs, Perf_Counters const& rhs) {
+        return {lhs.cycles + rhs.cycles, lhs.instructions + rhs.instructions, lhs.cache_misses + rhs.cache_misses,
+                lhs.branch_misses + rhs.branch_misses};
+    }
+
+    Perf_Counters operator-(Perf_Counters const& lhs, Perf_Counters const& rhs) {
+        return {lhs.cycles - rhs.cycles, lhs.instructions - rhs.instructions, lhs.cache_misses - rhs.cache_misses,
+                lhs.branch_misses - rhs.branch_misses};
+    }
+
+    char const* get_kernel_name(Kernel const kernel) {
+        switch(kernel) {
+            case Kernel::mat4_multiply:
+                return "mat4_multiply";
+            case Kernel::mat4_multiply_lhs:
+                return "mat4_multiply_lhs";
+            case Kernel::mat4_multiply_rhs:
+                return "mat4_multiply_rhs";
+            case Kernel::mat4_inverse:
+                return "mat4_inverse";
+            case Kernel::mat4_inverse_affine:
+                return "mat4_inverse_affine";
+            case Kernel::mat4_inverse_rigid:
+                return "mat4_inverse_rigid";
+            case Kernel::trs_compose_mat4:
+                return "trs_compose_mat4";
+            case Kernel::trs_compose_affine3:
+                return "trs_compose_affine3";
+            case Kernel::trs_decompose:
+                return "trs_decompose";
+            case Kernel::transform_points:
+                return "transform_points";
+            case Kernel::transform_directions:
+                return "transform_directions";
+            case Kernel::transform_points_projective:
+                return "transform_points_projective";
+            case Kernel::transform_vec4:
+                return "transform_vec4";
+            case Kernel::dual_quat_skin:
+                return "dual_quat_skin";
+            case Kernel::soa_elementwise:
+                return "soa_elementwise";
+            case Kernel::soa_elementwise_scalar:
+                return "soa_elementwise_scalar";
+            case Kernel::soa_lerp:
+                return "soa_lerp";
+            case Kernel::soa_lerp_varying:
+                return "soa_lerp_varying";
+            case Kernel::soa_dot:
+                return "soa_dot";
+            case Kernel::soa_length:
+                return "soa_length";
+            case Kernel::soa_normalize:
+                return "soa_normalize";
+            case Kernel::soa_cross:
+                return "soa_cross";
+            case Kernel::soa_quat_multiply:
+                return "soa_quat_multiply";
+            case Kernel::soa_quat_rotate:
+                return "soa_quat_rotate";
+            case Kernel::soa_transform_directions:
+                return "soa_transform_directions";
+            case Kernel::soa_slerp:
+                return "soa_slerp";
+            case Kernel::soa_slerp_varying:
+                return "soa_slerp_varying";
+            case Kernel::soa_blend:
+                return "soa_blend";
+            case Kernel::aos_to_soa:
+                return "aos_to_soa";
+            case Kernel::soa_to_aos:
+                return "soa_to_aos";
+            case Kernel::unary_function:
+                return "unary_function";
+            case Kernel::binary_function:
+                return "binary_function";
+            case Kernel::sincos:
+                return "sincos";
+        }
+        return "unknown";
+    }
+
+#if ANTON_MATH_PROFILE
+#    if defined(__linux__)
+    // Perf_Group
+    // The counters of the calling thread opened as a single group so that the
+    // processor schedules them together and a single read returns all of them.
+    //
+    struct Perf_Group {
+        static constexpr i32 event_count = 4;
+
+        i32 fds[event_count] = {-1, -1, -1, -1};
+        bool available = false;
+
+        Perf_Group() {
+            u64 const configs[event_count] = {PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_CACHE_MISSES,
+                                              PERF_COUNT_HW_BRANCH_MISSES};
+            for(i32 i = 0; i < event_count; ++i) {
+                perf_event_attr attr = {};
+                attr.type = PERF_TYPE_HARDWARE;
+                attr.size = sizeof(perf_event_attr);
+                attr.config = configs[i];
+                attr.read_format = PERF_FORMAT_GROUP;
+                attr.exclude_kernel = 1;
+                attr.exclude_hv = 1;
+                // The leader starts disabled so that the whole group is enabled at once.
+                attr.disabled = i == 0;
+                i32 const group_fd = i == 0 ? -1 : fds[0];
+                fds[i] = (i32)syscall(SYS_perf_event_open, &attr, 0, -1, group_fd, 0);
+                if(fds[i] == -1) {
+                    return;
+                }
+            }
+
+            available = ioctl(fds[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP) == 0;
+        }
+
+        ~Perf_Group() {
+            for(i32 const fd: fds) {
+                if(fd != -1) {
+                    close(fd);
+                }
+            }
+        }
+
+        Perf_Counters read_counters() const {
+            if(!available) {
+                return {};
+            }
+
+            // PERF_FORMAT_GROUP: the number of events followed by their values in
+            // the order the events have been added to the group.
+            u64 values[1 + event_count];
+            if(::read(fds[0], values, sizeof(values)) != (ssize_t)sizeof(values)) {
+                return {};
+            }
+
+            return {values[1], values[2], values[3], values[4]};
+        }
+    };
+
+    static Perf_Group const& get_perf_group() {
+        static thread_local Perf_Group const group;
+        return group;
+    }
+
+    bool is_profiling_available() {
+        return get_perf_group().available;
+    }
+
+    Perf_Counters read_perf_counters() {
+        return get_perf_group().read_counters();
+    }
+#    else
+    bool is_profiling_available() {
+        return false;
+    }
+
+    Perf_Counters read_perf_counters() {
+        return {};
+    }
+#    endif
+
+    struct Atomic_Profile {
+        std::atomic<i64> calls;
+        std::atomic<i64> elements;
+        std::atomic<u64> cycles;
+        std::atomic<u64> instructions;
+        std::atomic<u64> cache_misses;
+        std::atomic<u64> branch_misses;
+    };
+
+    // Zero-initialized, hence kernels invoked during static initialization of other
+    // translation units are accounted too.
+    static Atomic_Profile profiles[kernel_count];
+
+    Kernel_Profile get_kernel_profile(Kernel const kernel) {
+        Atomic_Profile const& p = profiles[static_cast<i64>(kernel)];
+        Kernel_Profile profile;
+        profile.calls = p.calls.load(std::memory_order_relaxed);
+        profile.elements = p.elements.load(std::memory_order_relaxed);
+        profile.counters.cycles = p.cycles.load(std::memory_order_relaxed);
+        profile.counters.instructions = p.instructions.load(std::memory_order_relaxed);
+        profile.counters.cache_misses = p.cache_misses.load(std::memory_order_relaxed);
+        profile.counters.branch_misses = p.branch_misses.load(std::memory_order_relaxed);
+        return profile;
+    }
+
+    void reset_kernel_profiles() {
+        for(Atomic_Profile& p: profiles) {
+            p.calls.store(0, std::memory_order_relaxed);
+            p.elements.store(0, std::memory_order_relaxed);
+            p.cycles.store(0, std::memory_order_relaxed);
+            p.instructions.store(0, std::memory_order_relaxed);
+            p.cache_misses.store(0, std::memory_order_relaxed);
+            p.branch_misses.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    static void record(Kernel const kernel, i64 const count, Perf_Counters const& counters) {
+        Atomic_Profile& p = profiles[static_cast<i64>(kernel)];
+        p.calls.fetch_add(1, std::memory_order_relaxed);
+        p.elements.fetch_add(count, std::memory_order_relaxed);
+        p.cycles.fetch_add(counters.cycles, std::memory_order_relaxed);
+        p.instructions.fetch_add(counters.instructions, std::memory_order_relaxed);
+        p.cache_misses.fetch_add(counters.cache_misses, std::memory_order_relaxed);
+        p.branch_misses.fetch_add(counters.branch_misses, std::memory_order_relaxed);
+    }
+
+    // get_count
+    // The count of elements, which is the last parameter of every kernel.
+    //
+    template<typename Last>
+    static i64 get_count(Last const& last) {
+        return last;
+    }
+
+    template<typename First, typename... Rest>
+    static i64 get_count(First const&, Rest const&... rest) {
+        return get_count(rest...);
+    }
+
+    template<typename Function>
+    struct Profiled;
+
+    template<typename... Arguments>
+    struct Profiled<void (*)(Arguments...)> {
+        using Function = void (*)(Arguments...);
+
+        // invoke
+        // Measures the kernel of the selected instruction set. The counters are read
+        // after the kernel has been looked up so that only the kernel is measured.
+        //
+        template<Function detail::Kernels::*kernel, Kernel id>
+        static void invoke(Arguments... arguments) {
+            Function const function = detail::get_kernels(get_instruction_set()).*kernel;
+            Perf_Counters const begin = read_perf_counters();
+            function(arguments...);
+            Perf_Counters const end = read_perf_counters();
+            record(id, get_count(arguments...), end - begin);
+        }
+    };
+
+#    define ANTON_MATH_PROFILED(kernel) Profiled<decltype(detail::Kernels::kernel)>::invoke<&detail::Kernels::kernel, Kernel::kernel>
+
+    namespace detail {
+        Kernels const kernels_profiled = {
+            ANTON_MATH_PROFILED(mat4_multiply),
+            ANTON_MATH_PROFILED(mat4_multiply_lhs),
+            ANTON_MATH_PROFILED(mat4_multiply_rhs),
+            ANTON_MATH_PROFILED(mat4_inverse),
+            ANTON_MATH_PROFILED(mat4_inverse_affine),
+            ANTON_MATH_PROFILED(mat4_inverse_rigid),
+            ANTON_MATH_PROFILED(trs_compose_mat4),
+            ANTON_MATH_PROFILED(trs_compose_affine3),
+            ANTON_MATH_PROFILED(trs_decompose),
+            ANTON_MATH_PROFILED(transform_points),
+            ANTON_MATH_PROFILED(transform_directions),
+            ANTON_MATH_PROFILED(transform_points_projective),
+            ANTON_MATH_PROFILED(transform_vec4),
+            ANTON_MATH_PROFILED(dual_quat_skin),
+            ANTON_MATH_PROFILED(soa_elementwise),
+            ANTON_MATH_PROFILED(soa_elementwise_scalar),
+            ANTON_MATH_PROFILED(soa_lerp),
+            ANTON_MATH_PROFILED(soa_lerp_varying),
+            ANTON_MATH_PROFILED(soa_dot),
+            ANTON_MATH_PROFILED(soa_length),
+            ANTON_MATH_PROFILED(soa_normalize),
+            ANTON_MATH_PROFILED(soa_cross),
+            ANTON_MATH_PROFILED(soa_quat_multiply),
+            ANTON_MATH_PROFILED(soa_quat_rotate),
+            ANTON_MATH_PROFILED(soa_transform_directions),
+            ANTON_MATH_PROFILED(soa_slerp),
+            ANTON_MATH_PROFILED(soa_slerp_varying),
+            ANTON_MATH_PROFILED(soa_blend),
+            ANTON_MATH_PROFILED(aos_to_soa),
+            ANTON_MATH_PROFILED(soa_to_aos),
+            ANTON_MATH_PROFILED(unary_function),
+            ANTON_MATH_PROFILED(binary_function),
+            ANTON_MATH_PROFILED(sincos),
+        };
+    } // namespace detail
+
+#    undef ANTON_MATH_PROFILED
+#else
+    bool is_profiling_available() {
+        return false;
+    }
+
+    Perf_Counters read_perf_counters() {
+        return {};
+    }
+
+    Kernel_Profile get_kernel_profile(Kernel) {
+        return {};
+    }
+
+    void reset_kernel_profiles() {}
+#endif
+} // namespace anton::math
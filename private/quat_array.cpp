@@ -0,0 +1,142 @@
+#include <anton/math/quat_array.hpp>
+#include <anton/math/transform.hpp>
+#include <anton/math/detail/utility.hpp>
+#include <detail/kernels.hpp>
+#include <detail/memory.hpp>
+#include <detail/parallel.hpp>
+
+namespace anton::math {
+    Quat_Array::Quat_Array(): _data(nullptr), _size(0), _capacity(0) {}
+
+    Quat_Array::Quat_Array(i64 const size): Quat_Array() {
+        resize(size);
+    }
+
+    Quat_Array::Quat_Array(Quat_Array const& other): Quat_Array() {
+        *this = other;
+    }
+
+    Quat_Array::Quat_Array(Quat_Array&& other): _data(other._data), _size(other._size), _capacity(other._capacity) {
+        other._data = nullptr;
+        other._size = 0;
+        other._capacity = 0;
+    }
+
+    Quat_Array::~Quat_Array() {
+        detail::deallocate_soa(_data);
+    }
+
+    Quat_Array& Quat_Array::operator=(Quat_Array const& other) {
+        if(this != &other) {
+            resize(other._size);
+            detail::copy_soa(other._data, other._capacity, _data, _capacity, 4, _size);
+        }
+        return *this;
+    }
+
+    Quat_Array& Quat_Array::operator=(Quat_Array&& other) {
+        detail::swap(_data, other._data);
+        detail::swap(_size, other._size);
+        detail::swap(_capacity, other._capacity);
+        return *this;
+    }
+
+    i64 Quat_Array::size() const {
+        return _size;
+    }
+
+    void Quat_Array::resize(i64 const size) {
+        f32 const fill[4] = {0.0f, 0.0f, 0.0f, 1.0f};
+        detail::resize_soa(_data, _size, _capacity, 4, size, fill);
+    }
+
+    f32* Quat_Array::x() {
+        return _data + 0 * _capacity;
+    }
+
+    f32 const* Quat_Array::x() const {
+        return _data + 0 * _capacity;
+    }
+
+    f32* Quat_Array::y() {
+        return _data + 1 * _capacity;
+    }
+
+    f32 const* Quat_Array::y() const {
+        return _data + 1 * _capacity;
+    }
+
+    f32* Quat_Array::z() {
+        return _data + 2 * _capacity;
+    }
+
+    f32 const* Quat_Array::z() const {
+        return _data + 2 * _capacity;
+    }
+
+    f32* Quat_Array::w() {
+        return _data + 3 * _capacity;
+    }
+
+    f32 const* Quat_Array::w() const {
+        return _data + 3 * _capacity;
+    }
+
+    Quat Quat_Array::get(i64 const index) const {
+        return {x()[index], y()[index], z()[index], w()[index]};
+    }
+
+    void Quat_Array::set(i64 const index, Quat const& q) {
+        x()[index] = q.x;
+        y()[index] = q.y;
+        z()[index] = q.z;
+        w()[index] = q.w;
+    }
+
+    void multiply(Quat_Array const& a, Quat_Array const& b, Quat_Array& out) {
+        detail::parallel_for(a.size(), detail::grain_vector, [&](i64 const begin, i64 const end) {
+            f32 const* const ca[4] = {a.x() + begin, a.y() + begin, a.z() + begin, a.w() + begin};
+            f32 const* const cb[4] = {b.x() + begin, b.y() + begin, b.z() + begin, b.w() + begin};
+            f32* const co[4] = {out.x() + begin, out.y() + begin, out.z() + begin, out.w() + begin};
+            detail::get_kernels().soa_quat_multiply(ca, cb, co, end - begin);
+        });
+    }
+
+    void conjugate(Quat_Array const& q, Quat_Array& out) {
+        detail::parallel_for(q.size(), detail::grain_vector, [&](i64 const begin, i64 const end) {
+            detail::Kernels const& kernels = detail::get_kernels();
+            kernels.soa_elementwise_scalar(detail::Elementwise_Op::multiply, q.x() + begin, -1.0f, out.x() + begin, end - begin);
+            kernels.soa_elementwise_scalar(detail::Elementwise_Op::multiply, q.y() + begin, -1.0f, out.y() + begin, end - begin);
+            kernels.soa_elementwise_scalar(detail::Elementwise_Op::multiply, q.z() + begin, -1.0f, out.z() + begin, end - begin);
+            if(&q != &out) {
+                detail::copy_floats(q.w() + begin, out.w() + begin, end - begin);
+            }
+        });
+    }
+
+    void normalize(Quat_Array const& q, Quat_Array& out) {
+        detail::parallel_for(q.size(), detail::grain_vector, [&](i64 const begin, i64 const end) {
+            f32 const* const cq[4] = {q.x() + begin, q.y() + begin, q.z() + begin, q.w() + begin};
+            f32* const co[4] = {out.x() + begin, out.y() + begin, out.z() + begin, out.w() + begin};
+            detail::get_kernels().soa_normalize(cq, 4, 0.0f, co, end - begin);
+        });
+    }
+
+    void rotate(Quat_Array const& q, Vec3_Array const& v, Vec3_Array& out) {
+        detail::parallel_for(q.size(), detail::grain_vector, [&](i64 const begin, i64 const end) {
+            f32 const* const cq[4] = {q.x() + begin, q.y() + begin, q.z() + begin, q.w() + begin};
+            f32 const* const cv[3] = {v.x() + begin, v.y() + begin, v.z() + begin};
+            f32* const co[3] = {out.x() + begin, out.y() + begin, out.z() + begin};
+            detail::get_kernels().soa_quat_rotate(cq, cv, co, end - begin);
+        });
+    }
+
+    void rotate(Quat const& q, Vec3_Array const& v, Vec3_Array& out) {
+        Mat4 const m = math::rotate(q);
+        detail::parallel_for(v.size(), detail::grain_vector, [&](i64 const begin, i64 const end) {
+            f32 const* const cv[3] = {v.x() + begin, v.y() + begin, v.z() + begin};
+            f32* const co[3] = {out.x() + begin, out.y() + begin, out.z() + begin};
+            detail::get_kernels().soa_transform_directions(m, cv, co, end - begin);
+        });
+    }
+} // namespace anton::math
@@ -0,0 +1,99 @@
+#include <anton/math/soa.hpp>
+#include <detail/kernels.hpp>
+#include <detail/parallel.hpp>
+
+namespace anton::math {
+    void to_soa(Vec3 const* const in, f32* const x, f32* const y, f32* const z, i64 const count) {
+        detail::parallel_for(count, detail::grain_vector, [&](i64 const begin, i64 const end) {
+            f32* const out[3] = {x + begin, y + begin, z + begin};
+            detail::get_kernels().aos_to_soa(reinterpret_cast<f32 const*>(in + begin), 3, out, end - begin);
+        });
+    }
+
+    void to_soa(Vec4 const* const in, f32* const x, f32* const y, f32* const z, f32* const w, i64 const count) {
+        detail::parallel_for(count, detail::grain_vector, [&](i64 const begin, i64 const end) {
+            f32* const out[4] = {x + begin, y + begin, z + begin, w + begin};
+            detail::get_kernels().aos_to_soa(reinterpret_cast<f32 const*>(in + begin), 4, out, end - begin);
+        });
+    }
+
+    void to_soa(Quat const* const in, f32* const x, f32* const y, f32* const z, f32* const w, i64 const count) {
+        detail::parallel_for(count, detail::grain_vector, [&](i64 const begin, i64 const end) {
+            f32* const out[4] = {x + begin, y + begin, z + begin, w + begin};
+            detail::get_kernels().aos_to_soa(reinterpret_cast<f32 const*>(in + begin), 4, out, end - begin);
+        });
+    }
+
+    void to_soa(Mat4 const* const in, f32* const* const out, i64 const count) {
+        detail::parallel_for(count, detail::grain_vector, [&](i64 const begin, i64 const end) {
+            f32* chunk_out[16];
+            for(i64 i = 0; i < 16; ++i) {
+                chunk_out[i] = out[i] + begin;
+            }
+            detail::get_kernels().aos_to_soa(reinterpret_cast<f32 const*>(in + begin), 16, chunk_out, end - begin);
+        });
+    }
+
+    void to_soa(Vec3 const* const in, Vec3_Array& out) {
+        to_soa(in, out.x(), out.y(), out.z(), out.size());
+    }
+
+    void to_soa(Vec4 const* const in, Vec4_Array& out) {
+        to_soa(in, out.x(), out.y(), out.z(), out.w(), out.size());
+    }
+
+    void to_soa(Quat const* const in, Vec4_Array& out) {
+        to_soa(in, out.x(), out.y(), out.z(), out.w(), out.size());
+    }
+
+    void to_soa(Quat const* const in, Quat_Array& out) {
+        to_soa(in, out.x(), out.y(), out.z(), out.w(), out.size());
+    }
+
+    void to_aos(f32 const* const x, f32 const* const y, f32 const* const z, Vec3* const out, i64 const count) {
+        detail::parallel_for(count, detail::grain_vector, [&](i64 const begin, i64 const end) {
+            f32 const* const in[3] = {x + begin, y + begin, z + begin};
+            detail::get_kernels().soa_to_aos(in, 3, reinterpret_cast<f32*>(out + begin), end - begin);
+        });
+    }
+
+    void to_aos(f32 const* const x, f32 const* const y, f32 const* const z, f32 const* const w, Vec4* const out, i64 const count) {
+        detail::parallel_for(count, detail::grain_vector, [&](i64 const begin, i64 const end) {
+            f32 const* const in[4] = {x + begin, y + begin, z + begin, w + begin};
+            detail::get_kernels().soa_to_aos(in, 4, reinterpret_cast<f32*>(out + begin), end - begin);
+        });
+    }
+
+    void to_aos(f32 const* const x, f32 const* const y, f32 const* const z, f32 const* const w, Quat* const out, i64 const count) {
+        detail::parallel_for(count, detail::grain_vector, [&](i64 const begin, i64 const end) {
+            f32 const* const in[4] = {x + begin, y + begin, z + begin, w + begin};
+            detail::get_kernels().soa_to_aos(in, 4, reinterpret_cast<f32*>(out + begin), end - begin);
+        });
+    }
+
+    void to_aos(f32 const* const* const in, Mat4* const out, i64 const count) {
+        detail::parallel_for(count, detail::grain_vector, [&](i64 const begin, i64 const end) {
+            f32 const* chunk_in[16];
+            for(i64 i = 0; i < 16; ++i) {
+                chunk_in[i] = in[i] + begin;
+            }
+            detail::get_kernels().soa_to_aos(chunk_in, 16, reinterpret_cast<f32*>(out + begin), end - begin);
+        });
+    }
+
+    void to_aos(Vec3_Array const& in, Vec3* const out) {
+        to_aos(in.x(), in.y(), in.z(), out, in.size());
+    }
+
+    void to_aos(Vec4_Array const& in, Vec4* const out) {
+        to_aos(in.x(), in.y(), in.z(), in.w(), out, in.size());
+    }
+
+    void to_aos(Vec4_Array const& in, Quat* const out) {
+        to_aos(in.x(), in.y(), in.z(), in.w(), out, in.size());
+    }
+
+    void to_aos(Quat_Array const& in, Quat* const out) {
+        to_aos(in.x(), in.y(), in.z(), in.w(), out, in.size());
+    }
+} // namespace anton::math
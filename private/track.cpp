@@ -0,0 +1,252 @@
+#include <anton/math/track.hpp>
+#include <anton/math/quat_array.hpp>
+#include <anton/math/vec3_array.hpp>
+#include <anton/math/detail/utility.hpp>
+#include <detail/kernels.hpp>
+#include <detail/parallel.hpp>
+
+namespace anton::math {
+    template<typename T>
+    static T* copy_elements(T const* const src, i64 const count) {
+        if(count == 0) {
+            return nullptr;
+        }
+
+        T* const dst = new T[count];
+        for(i64 i = 0; i < count; ++i) {
+            dst[i] = src[i];
+        }
+        return dst;
+    }
+
+    Quat_Track::Quat_Track(): _times(nullptr), _keys(nullptr), _size(0) {}
+
+    Quat_Track::Quat_Track(f32 const* const times, Quat const* const keys, i64 const count)
+        : _times(copy_elements(times, count)), _keys(copy_elements(keys, count)), _size(count) {}
+
+    Quat_Track::Quat_Track(Quat_Track const& other): Quat_Track(other._times, other._keys, other._size) {}
+
+    Quat_Track::Quat_Track(Quat_Track&& other): Quat_Track() {
+        *this = static_cast<Quat_Track&&>(other);
+    }
+
+    Quat_Track::~Quat_Track() {
+        delete[] _times;
+        delete[] _keys;
+    }
+
+    Quat_Track& Quat_Track::operator=(Quat_Track const& other) {
+        if(this != &other) {
+            Quat_Track copy(other);
+            *this = static_cast<Quat_Track&&>(copy);
+        }
+        return *this;
+    }
+
+    Quat_Track& Quat_Track::operator=(Quat_Track&& other) {
+        detail::swap(_times, other._times);
+        detail::swap(_keys, other._keys);
+        detail::swap(_size, other._size);
+        return *this;
+    }
+
+    i64 Quat_Track::size() const {
+        return _size;
+    }
+
+    f32 const* Quat_Track::get_times() const {
+        return _times;
+    }
+
+    Quat const* Quat_Track::get_keys() const {
+        return _keys;
+    }
+
+    Vec3_Track::Vec3_Track(): _times(nullptr), _keys(nullptr), _size(0) {}
+
+    Vec3_Track::Vec3_Track(f32 const* const times, Vec3 const* const keys, i64 const count)
+        : _times(copy_elements(times, count)), _keys(copy_elements(keys, count)), _size(count) {}
+
+    Vec3_Track::Vec3_Track(Vec3_Track const& other): Vec3_Track(other._times, other._keys, other._size) {}
+
+    Vec3_Track::Vec3_Track(Vec3_Track&& other): Vec3_Track() {
+        *this = static_cast<Vec3_Track&&>(other);
+    }
+
+    Vec3_Track::~Vec3_Track() {
+        delete[] _times;
+        delete[] _keys;
+    }
+
+    Vec3_Track& Vec3_Track::operator=(Vec3_Track const& other) {
+        if(this != &other) {
+            Vec3_Track copy(other);
+            *this = static_cast<Vec3_Track&&>(copy);
+        }
+        return *this;
+    }
+
+    Vec3_Track& Vec3_Track::operator=(Vec3_Track&& other) {
+        detail::swap(_times, other._times);
+        detail::swap(_keys, other._keys);
+        detail::swap(_size, other._size);
+        return *this;
+    }
+
+    i64 Vec3_Track::size() const {
+        return _size;
+    }
+
+    f32 const* Vec3_Track::get_times() const {
+        return _times;
+    }
+
+    Vec3 const* Vec3_Track::get_keys() const {
+        return _keys;
+    }
+
+    // The number of keys the cursor is advanced by before the search falls back to
+    // the binary search. Covers the playback at several times the rate of the keys.
+    constexpr i64 max_cursor_steps = 4;
+
+    // Keys surrounding a time. The sample is interpolated between keys[key0] and
+    // keys[key1] with t. Outside of the times of the keys key0 is equal to key1.
+    struct Segment {
+        i64 key0;
+        i64 key1;
+        f32 t;
+    };
+
+    // The first index in [begin, end) whose time is greater than time or end if there
+    // is none.
+    static i64 upper_bound(f32 const* const times, i64 begin, i64 end, f32 const time) {
+        while(begin < end) {
+            i64 const middle = begin + (end - begin) / 2;
+            if(time < times[middle]) {
+                end = middle;
+            } else {
+                begin = middle + 1;
+            }
+        }
+        return begin;
+    }
+
+    static Segment locate(f32 const* const times, i64 const size, f32 const time, i64& cursor) {
+        if(size == 0) {
+            cursor = 0;
+            return {0, 0, 0.0f};
+        }
+
+        i64 k = cursor < 0 ? 0 : (cursor < size ? cursor : size - 1);
+        if(times[k] <= time) {
+            for(i64 step = 0; step < max_cursor_steps && k + 1 < size && times[k + 1] <= time; ++step) {
+                k += 1;
+            }
+            if(k + 1 < size && times[k + 1] <= time) {
+                k = upper_bound(times, k + 1, size, time) - 1;
+            }
+        } else {
+            k = upper_bound(times, 0, k, time) - 1;
+        }
+
+        if(k < 0) {
+            cursor = 0;
+            return {0, 0, 0.0f};
+        }
+
+        cursor = k;
+        if(k + 1 == size) {
+            return {k, k, 0.0f};
+        }
+
+        return {k, k + 1, (time - times[k]) / (times[k + 1] - times[k])};
+    }
+
+    // An empty track has no keys to interpolate. Its samples are the identity rotation
+    // or the zero vector, which locate points at with segment {0, 0, 0}.
+    constexpr Vec3 zero_key = Vec3{0.0f};
+
+    static Quat const* get_sample_keys(Quat_Track const& track) {
+        return track.size() > 0 ? track.get_keys() : &Quat::identity;
+    }
+
+    static Vec3 const* get_sample_keys(Vec3_Track const& track) {
+        return track.size() > 0 ? track.get_keys() : &zero_key;
+    }
+
+    Quat sample(Quat_Track const& track, f32 const time, i64& cursor) {
+        Segment const s = locate(track.get_times(), track.size(), time, cursor);
+        Quat const* const keys = get_sample_keys(track);
+        return slerp(keys[s.key0], keys[s.key1], s.t);
+    }
+
+    Vec3 sample(Vec3_Track const& track, f32 const time, i64& cursor) {
+        Segment const s = locate(track.get_times(), track.size(), time, cursor);
+        Vec3 const* const keys = get_sample_keys(track);
+        return lerp(keys[s.key0], keys[s.key1], s.t);
+    }
+
+    // The keys are gathered into batches of detail::gather_batch_size structures of
+    // arrays for the kernels.
+
+    void sample(Quat_Track const* const tracks, i64 const count, f32 const time, Slerp_Method const method, i64* const cursors, Quat_Array& out) {
+        detail::parallel_for(count, detail::grain_matrix, [&](i64 const begin, i64 const end) {
+            detail::Kernels const& kernels = detail::get_kernels();
+            f32 a[4][detail::gather_batch_size];
+            f32 b[4][detail::gather_batch_size];
+            f32 t[detail::gather_batch_size];
+            for(i64 i = begin; i < end; i += detail::gather_batch_size) {
+                i64 const n = end - i < detail::gather_batch_size ? end - i : detail::gather_batch_size;
+                for(i64 j = 0; j < n; ++j) {
+                    Quat_Track const& track = tracks[i + j];
+                    Segment const s = locate(track.get_times(), track.size(), time, cursors[i + j]);
+                    Quat const& key0 = get_sample_keys(track)[s.key0];
+                    Quat const& key1 = get_sample_keys(track)[s.key1];
+                    a[0][j] = key0.x;
+                    a[1][j] = key0.y;
+                    a[2][j] = key0.z;
+                    a[3][j] = key0.w;
+                    b[0][j] = key1.x;
+                    b[1][j] = key1.y;
+                    b[2][j] = key1.z;
+                    b[3][j] = key1.w;
+                    t[j] = s.t;
+                }
+
+                f32 const* const ca[4] = {a[0], a[1], a[2], a[3]};
+                f32 const* const cb[4] = {b[0], b[1], b[2], b[3]};
+                f32* const co[4] = {out.x() + i, out.y() + i, out.z() + i, out.w() + i};
+                kernels.soa_slerp_varying(method, ca, cb, 4, t, co, n);
+            }
+        });
+    }
+
+    void sample(Vec3_Track const* const tracks, i64 const count, f32 const time, i64* const cursors, Vec3_Array& out) {
+        detail::parallel_for(count, detail::grain_matrix, [&](i64 const begin, i64 const end) {
+            detail::Kernels const& kernels = detail::get_kernels();
+            f32 a[3][detail::gather_batch_size];
+            f32 b[3][detail::gather_batch_size];
+            f32 t[detail::gather_batch_size];
+            for(i64 i = begin; i < end; i += detail::gather_batch_size) {
+                i64 const n = end - i < detail::gather_batch_size ? end - i : detail::gather_batch_size;
+                for(i64 j = 0; j < n; ++j) {
+                    Vec3_Track const& track = tracks[i + j];
+                    Segment const s = locate(track.get_times(), track.size(), time, cursors[i + j]);
+                    Vec3 const& key0 = get_sample_keys(track)[s.key0];
+                    Vec3 const& key1 = get_sample_keys(track)[s.key1];
+                    a[0][j] = key0.x;
+                    a[1][j] = key0.y;
+                    a[2][j] = key0.z;
+                    b[0][j] = key1.x;
+                    b[1][j] = key1.y;
+                    b[2][j] = key1.z;
+                    t[j] = s.t;
+                }
+
+                kernels.soa_lerp_varying(a[0], b[0], t, out.x() + i, n);
+                kernels.soa_lerp_varying(a[1], b[1], t, out.y() + i, n);
+                kernels.soa_lerp_varying(a[2], b[2], t, out.z() + i, n);
+            }
+        });
+    }
+} // namespace anton::math
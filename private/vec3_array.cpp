@@ -0,0 +1,191 @@
+#include <anton/math/vec3_array.hpp>
+#include <anton/math/detail/utility.hpp>
+#include <detail/kernels.hpp>
+#include <detail/memory.hpp>
+#include <detail/parallel.hpp>
+
+namespace anton::math {
+    Vec3_Array::Vec3_Array(): _data(nullptr), _size(0), _capacity(0) {}
+
+    Vec3_Array::Vec3_Array(i64 const size): Vec3_Array() {
+        resize(size);
+    }
+
+    Vec3_Array::Vec3_Array(Vec3_Array const& other): Vec3_Array() {
+        *this = other;
+    }
+
+    Vec3_Array::Vec3_Array(Vec3_Array&& other): _data(other._data), _size(other._size), _capacity(other._capacity) {
+        other._data = nullptr;
+        other._size = 0;
+        other._capacity = 0;
+    }
+
+    Vec3_Array::~Vec3_Array() {
+        detail::deallocate_soa(_data);
+    }
+
+    Vec3_Array& Vec3_Array::operator=(Vec3_Array const& other) {
+        if(this != &other) {
+            resize(other._size);
+            detail::copy_soa(other._data, other._capacity, _data, _capacity, 3, _size);
+        }
+        return *this;
+    }
+
+    Vec3_Array& Vec3_Array::operator=(Vec3_Array&& other) {
+        detail::swap(_data, other._data);
+        detail::swap(_size, other._size);
+        detail::swap(_capacity, other._capacity);
+        return *this;
+    }
+
+    i64 Vec3_Array::size() const {
+        return _size;
+    }
+
+    void Vec3_Array::resize(i64 const size) {
+        f32 const fill[3] = {0.0f, 0.0f, 0.0f};
+        detail::resize_soa(_data, _size, _capacity, 3, size, fill);
+    }
+
+    f32* Vec3_Array::x() {
+        return _data + 0 * _capacity;
+    }
+
+    f32 const* Vec3_Array::x() const {
+        return _data + 0 * _capacity;
+    }
+
+    f32* Vec3_Array::y() {
+        return _data + 1 * _capacity;
+    }
+
+    f32 const* Vec3_Array::y() const {
+        return _data + 1 * _capacity;
+    }
+
+    f32* Vec3_Array::z() {
+        return _data + 2 * _capacity;
+    }
+
+    f32 const* Vec3_Array::z() const {
+        return _data + 2 * _capacity;
+    }
+
+    Vec3 Vec3_Array::get(i64 const index) const {
+        return {x()[index], y()[index], z()[index]};
+    }
+
+    void Vec3_Array::set(i64 const index, Vec3 const& v) {
+        x()[index] = v.x;
+        y()[index] = v.y;
+        z()[index] = v.z;
+    }
+
+    static void elementwise(detail::Elementwise_Op const op, Vec3_Array const& a, Vec3_Array const& b, Vec3_Array& out) {
+        detail::parallel_for(a.size(), detail::grain_vector, [&](i64 const begin, i64 const end) {
+            detail::Kernels const& kernels = detail::get_kernels();
+            kernels.soa_elementwise(op, a.x() + begin, b.x() + begin, out.x() + begin, end - begin);
+            kernels.soa_elementwise(op, a.y() + begin, b.y() + begin, out.y() + begin, end - begin);
+            kernels.soa_elementwise(op, a.z() + begin, b.z() + begin, out.z() + begin, end - begin);
+        });
+    }
+
+    static void elementwise(detail::Elementwise_Op const op, Vec3_Array const& a, f32 const b, Vec3_Array& out) {
+        detail::parallel_for(a.size(), detail::grain_vector, [&](i64 const begin, i64 const end) {
+            detail::Kernels const& kernels = detail::get_kernels();
+            kernels.soa_elementwise_scalar(op, a.x() + begin, b, out.x() + begin, end - begin);
+            kernels.soa_elementwise_scalar(op, a.y() + begin, b, out.y() + begin, end - begin);
+            kernels.soa_elementwise_scalar(op, a.z() + begin, b, out.z() + begin, end - begin);
+        });
+    }
+
+    void add(Vec3_Array const& a, Vec3_Array const& b, Vec3_Array& out) {
+        elementwise(detail::Elementwise_Op::add, a, b, out);
+    }
+
+    void subtract(Vec3_Array const& a, Vec3_Array const& b, Vec3_Array& out) {
+        elementwise(detail::Elementwise_Op::subtract, a, b, out);
+    }
+
+    void multiply(Vec3_Array const& a, Vec3_Array const& b, Vec3_Array& out) {
+        elementwise(detail::Elementwise_Op::multiply, a, b, out);
+    }
+
+    void divide(Vec3_Array const& a, Vec3_Array const& b, Vec3_Array& out) {
+        elementwise(detail::Elementwise_Op::divide, a, b, out);
+    }
+
+    void add(Vec3_Array const& a, f32 const b, Vec3_Array& out) {
+        elementwise(detail::Elementwise_Op::add, a, b, out);
+    }
+
+    void subtract(Vec3_Array const& a, f32 const b, Vec3_Array& out) {
+        elementwise(detail::Elementwise_Op::subtract, a, b, out);
+    }
+
+    void multiply(Vec3_Array const& a, f32 const b, Vec3_Array& out) {
+        elementwise(detail::Elementwise_Op::multiply, a, b, out);
+    }
+
+    void divide(Vec3_Array const& a, f32 const b, Vec3_Array& out) {
+        elementwise(detail::Elementwise_Op::divide, a, b, out);
+    }
+
+    void max(Vec3_Array const& a, Vec3_Array const& b, Vec3_Array& out) {
+        elementwise(detail::Elementwise_Op::max, a, b, out);
+    }
+
+    void min(Vec3_Array const& a, Vec3_Array const& b, Vec3_Array& out) {
+        elementwise(detail::Elementwise_Op::min, a, b, out);
+    }
+
+    void dot(Vec3_Array const& a, Vec3_Array const& b, f32* const out) {
+        detail::parallel_for(a.size(), detail::grain_vector, [&](i64 const begin, i64 const end) {
+            f32 const* const ca[3] = {a.x() + begin, a.y() + begin, a.z() + begin};
+            f32 const* const cb[3] = {b.x() + begin, b.y() + begin, b.z() + begin};
+            detail::get_kernels().soa_dot(ca, cb, 3, out + begin, end - begin);
+        });
+    }
+
+    void cross(Vec3_Array const& a, Vec3_Array const& b, Vec3_Array& out) {
+        detail::parallel_for(a.size(), detail::grain_vector, [&](i64 const begin, i64 const end) {
+            f32 const* const ca[3] = {a.x() + begin, a.y() + begin, a.z() + begin};
+            f32 const* const cb[3] = {b.x() + begin, b.y() + begin, b.z() + begin};
+            f32* const co[3] = {out.x() + begin, out.y() + begin, out.z() + begin};
+            detail::get_kernels().soa_cross(ca, cb, co, end - begin);
+        });
+    }
+
+    void length_squared(Vec3_Array const& a, f32* const out) {
+        detail::parallel_for(a.size(), detail::grain_vector, [&](i64 const begin, i64 const end) {
+            f32 const* const ca[3] = {a.x() + begin, a.y() + begin, a.z() + begin};
+            detail::get_kernels().soa_dot(ca, ca, 3, out + begin, end - begin);
+        });
+    }
+
+    void length(Vec3_Array const& a, f32* const out) {
+        detail::parallel_for(a.size(), detail::grain_vector, [&](i64 const begin, i64 const end) {
+            f32 const* const ca[3] = {a.x() + begin, a.y() + begin, a.z() + begin};
+            detail::get_kernels().soa_length(ca, 3, out + begin, end - begin);
+        });
+    }
+
+    void normalize(Vec3_Array const& a, Vec3_Array& out, f32 const tolerance) {
+        detail::parallel_for(a.size(), detail::grain_vector, [&](i64 const begin, i64 const end) {
+            f32 const* const ca[3] = {a.x() + begin, a.y() + begin, a.z() + begin};
+            f32* const co[3] = {out.x() + begin, out.y() + begin, out.z() + begin};
+            detail::get_kernels().soa_normalize(ca, 3, tolerance, co, end - begin);
+        });
+    }
+
+    void lerp(Vec3_Array const& a, Vec3_Array const& b, f32 const t, Vec3_Array& out) {
+        detail::parallel_for(a.size(), detail::grain_vector, [&](i64 const begin, i64 const end) {
+            detail::Kernels const& kernels = detail::get_kernels();
+            kernels.soa_lerp(a.x() + begin, b.x() + begin, t, out.x() + begin, end - begin);
+            kernels.soa_lerp(a.y() + begin, b.y() + begin, t, out.y() + begin, end - begin);
+            kernels.soa_lerp(a.z() + begin, b.z() + begin, t, out.z() + begin, end - begin);
+        });
+    }
+} // namespace anton::math
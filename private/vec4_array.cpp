@@ -0,0 +1,194 @@
+#include <anton/math/vec4_array.hpp>
+#include <anton/math/detail/utility.hpp>
+#include <detail/kernels.hpp>
+#include <detail/memory.hpp>
+#include <detail/parallel.hpp>
+
+namespace anton::math {
+    Vec4_Array::Vec4_Array(): _data(nullptr), _size(0), _capacity(0) {}
+
+    Vec4_Array::Vec4_Array(i64 const size): Vec4_Array() {
+        resize(size);
+    }
+
+    Vec4_Array::Vec4_Array(Vec4_Array const& other): Vec4_Array() {
+        *this = other;
+    }
+
+    Vec4_Array::Vec4_Array(Vec4_Array&& other): _data(other._data), _size(other._size), _capacity(other._capacity) {
+        other._data = nullptr;
+        other._size = 0;
+        other._capacity = 0;
+    }
+
+    Vec4_Array::~Vec4_Array() {
+        detail::deallocate_soa(_data);
+    }
+
+    Vec4_Array& Vec4_Array::operator=(Vec4_Array const& other) {
+        if(this != &other) {
+            resize(other._size);
+            detail::copy_soa(other._data, other._capacity, _data, _capacity, 4, _size);
+        }
+        return *this;
+    }
+
+    Vec4_Array& Vec4_Array::operator=(Vec4_Array&& other) {
+        detail::swap(_data, other._data);
+        detail::swap(_size, other._size);
+        detail::swap(_capacity, other._capacity);
+        return *this;
+    }
+
+    i64 Vec4_Array::size() const {
+        return _size;
+    }
+
+    void Vec4_Array::resize(i64 const size) {
+        f32 const fill[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+        detail::resize_soa(_data, _size, _capacity, 4, size, fill);
+    }
+
+    f32* Vec4_Array::x() {
+        return _data + 0 * _capacity;
+    }
+
+    f32 const* Vec4_Array::x() const {
+        return _data + 0 * _capacity;
+    }
+
+    f32* Vec4_Array::y() {
+        return _data + 1 * _capacity;
+    }
+
+    f32 const* Vec4_Array::y() const {
+        return _data + 1 * _capacity;
+    }
+
+    f32* Vec4_Array::z() {
+        return _data + 2 * _capacity;
+    }
+
+    f32 const* Vec4_Array::z() const {
+        return _data + 2 * _capacity;
+    }
+
+    f32* Vec4_Array::w() {
+        return _data + 3 * _capacity;
+    }
+
+    f32 const* Vec4_Array::w() const {
+        return _data + 3 * _capacity;
+    }
+
+    Vec4 Vec4_Array::get(i64 const index) const {
+        return {x()[index], y()[index], z()[index], w()[index]};
+    }
+
+    void Vec4_Array::set(i64 const index, Vec4 const& v) {
+        x()[index] = v.x;
+        y()[index] = v.y;
+        z()[index] = v.z;
+        w()[index] = v.w;
+    }
+
+    static void elementwise(detail::Elementwise_Op const op, Vec4_Array const& a, Vec4_Array const& b, Vec4_Array& out) {
+        detail::parallel_for(a.size(), detail::grain_vector, [&](i64 const begin, i64 const end) {
+            detail::Kernels const& kernels = detail::get_kernels();
+            kernels.soa_elementwise(op, a.x() + begin, b.x() + begin, out.x() + begin, end - begin);
+            kernels.soa_elementwise(op, a.y() + begin, b.y() + begin, out.y() + begin, end - begin);
+            kernels.soa_elementwise(op, a.z() + begin, b.z() + begin, out.z() + begin, end - begin);
+            kernels.soa_elementwise(op, a.w() + begin, b.w() + begin, out.w() + begin, end - begin);
+        });
+    }
+
+    static void elementwise(detail::Elementwise_Op const op, Vec4_Array const& a, f32 const b, Vec4_Array& out) {
+        detail::parallel_for(a.size(), detail::grain_vector, [&](i64 const begin, i64 const end) {
+            detail::Kernels const& kernels = detail::get_kernels();
+            kernels.soa_elementwise_scalar(op, a.x() + begin, b, out.x() + begin, end - begin);
+            kernels.soa_elementwise_scalar(op, a.y() + begin, b, out.y() + begin, end - begin);
+            kernels.soa_elementwise_scalar(op, a.z() + begin, b, out.z() + begin, end - begin);
+            kernels.soa_elementwise_scalar(op, a.w() + begin, b, out.w() + begin, end - begin);
+        });
+    }
+
+    void add(Vec4_Array const& a, Vec4_Array const& b, Vec4_Array& out) {
+        elementwise(detail::Elementwise_Op::add, a, b, out);
+    }
+
+    void subtract(Vec4_Array const& a, Vec4_Array const& b, Vec4_Array& out) {
+        elementwise(detail::Elementwise_Op::subtract, a, b, out);
+    }
+
+    void multiply(Vec4_Array const& a, Vec4_Array const& b, Vec4_Array& out) {
+        elementwise(detail::Elementwise_Op::multiply, a, b, out);
+    }
+
+    void divide(Vec4_Array const& a, Vec4_Array const& b, Vec4_Array& out) {
+        elementwise(detail::Elementwise_Op::divide, a, b, out);
+    }
+
+    void add(Vec4_Array const& a, f32 const b, Vec4_Array& out) {
+        elementwise(detail::Elementwise_Op::add, a, b, out);
+    }
+
+    void subtract(Vec4_Array const& a, f32 const b, Vec4_Array& out) {
+        elementwise(detail::Elementwise_Op::subtract, a, b, out);
+    }
+
+    void multiply(Vec4_Array const& a, f32 const b, Vec4_Array& out) {
+        elementwise(detail::Elementwise_Op::multiply, a, b, out);
+    }
+
+    void divide(Vec4_Array const& a, f32 const b, Vec4_Array& out) {
+        elementwise(detail::Elementwise_Op::divide, a, b, out);
+    }
+
+    void max(Vec4_Array const& a, Vec4_Array const& b, Vec4_Array& out) {
+        elementwise(detail::Elementwise_Op::max, a, b, out);
+    }
+
+    void min(Vec4_Array const& a, Vec4_Array const& b, Vec4_Array& out) {
+        elementwise(detail::Elementwise_Op::min, a, b, out);
+    }
+
+    void dot(Vec4_Array const& a, Vec4_Array const& b, f32* const out) {
+        detail::parallel_for(a.size(), detail::grain_vector, [&](i64 const begin, i64 const end) {
+            f32 const* const ca[4] = {a.x() + begin, a.y() + begin, a.z() + begin, a.w() + begin};
+            f32 const* const cb[4] = {b.x() + begin, b.y() + begin, b.z() + begin, b.w() + begin};
+            detail::get_kernels().soa_dot(ca, cb, 4, out + begin, end - begin);
+        });
+    }
+
+    void length_squared(Vec4_Array const& a, f32* const out) {
+        detail::parallel_for(a.size(), detail::grain_vector, [&](i64 const begin, i64 const end) {
+            f32 const* const ca[4] = {a.x() + begin, a.y() + begin, a.z() + begin, a.w() + begin};
+            detail::get_kernels().soa_dot(ca, ca, 4, out + begin, end - begin);
+        });
+    }
+
+    void length(Vec4_Array const& a, f32* const out) {
+        detail::parallel_for(a.size(), detail::grain_vector, [&](i64 const begin, i64 const end) {
+            f32 const* const ca[4] = {a.x() + begin, a.y() + begin, a.z() + begin, a.w() + begin};
+            detail::get_kernels().soa_length(ca, 4, out + begin, end - begin);
+        });
+    }
+
+    void normalize(Vec4_Array const& a, Vec4_Array& out, f32 const tolerance) {
+        detail::parallel_for(a.size(), detail::grain_vector, [&](i64 const begin, i64 const end) {
+            f32 const* const ca[4] = {a.x() + begin, a.y() + begin, a.z() + begin, a.w() + begin};
+            f32* const co[4] = {out.x() + begin, out.y() + begin, out.z() + begin, out.w() + begin};
+            detail::get_kernels().soa_normalize(ca, 4, tolerance, co, end - begin);
+        });
+    }
+
+    void lerp(Vec4_Array const& a, Vec4_Array const& b, f32 const t, Vec4_Array& out) {
+        detail::parallel_for(a.size(), detail::grain_vector, [&](i64 const begin, i64 const end) {
+            detail::Kernels const& kernels = detail::get_kernels();
+            kernels.soa_lerp(a.x() + begin, b.x() + begin, t, out.x() + begin, end - begin);
+            kernels.soa_lerp(a.y() + begin, b.y() + begin, t, out.y() + begin, end - begin);
+            kernels.soa_lerp(a.z() + begin, b.z() + begin, t, out.z() + begin, end - begin);
+            kernels.soa_lerp(a.w() + begin, b.w() + begin, t, out.w() + begin, end - begin);
+        });
+    }
+} // namespace anton::math
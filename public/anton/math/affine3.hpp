@@ -0,0 +1,88 @@
+#pragma once
+
+#include <anton/types.hpp>
+#include <anton/math/detail/config.hpp>
+#include <anton/math/mat4.hpp>
+#include <anton/math/transform.hpp>
+#include <anton/math/vec3.hpp>
+
+namespace anton::math {
+    // Affine3
+    // Column major 3x4 matrix representing an affine transformation. Equivalent to a Mat4
+    // whose last row is (0, 0, 0, 1), which is not stored. The first 3 columns hold the
+    // linear part and the last column holds the translation.
+    //
+    struct Affine3 {
+    public:
+        static Affine3 const identity;
+
+        constexpr Affine3(): columns{} {}
+        constexpr Affine3(Vec3 const& x, Vec3 const& y, Vec3 const& z, Vec3 const& translation): columns{x, y, z, translation} {}
+        // Discards the last row of m.
+        explicit ANTON_MATH_CONSTEXPR Affine3(Mat4 const& m);
+        // Reads 12 floats.
+        explicit ANTON_MATH_CONSTEXPR Affine3(f32 const* p);
+
+        [[nodiscard]] ANTON_MATH_CONSTEXPR Vec3& operator[](i32 column);
+        [[nodiscard]] ANTON_MATH_CONSTEXPR Vec3 const& operator[](i32 column) const;
+
+        [[nodiscard]] ANTON_MATH_CONSTEXPR f32& operator()(i32 column, i32 row);
+        [[nodiscard]] ANTON_MATH_CONSTEXPR f32 const& operator()(i32 column, i32 row) const;
+
+        [[nodiscard]] ANTON_MATH_FUNCTION f32* data();
+        [[nodiscard]] ANTON_MATH_FUNCTION f32 const* data() const;
+
+        ANTON_MATH_CONSTEXPR Affine3& operator*=(Affine3 const& rhs);
+
+    private:
+        Vec3 columns[4];
+    };
+
+    inline constexpr Affine3 const Affine3::identity = Affine3{{1, 0, 0}, {0, 1, 0}, {0, 0, 1}, {0, 0, 0}};
+
+    // Composition. Applying the result is equivalent to applying rhs followed by lhs.
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Affine3 operator*(Affine3 lhs, Affine3 const& rhs);
+
+    // to_mat4
+    // Expands m to a Mat4 with (0, 0, 0, 1) as the last row.
+    //
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Mat4 to_mat4(Affine3 const& m);
+
+    // transform_point
+    // Transforms point p by m, i.e. applies the linear part and the translation.
+    //
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Vec3 transform_point(Affine3 const& m, Vec3 const& p);
+
+    // transform_direction
+    // Transforms direction d by the linear part of m. The result is not normalized.
+    //
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Vec3 transform_direction(Affine3 const& m, Vec3 const& d);
+
+    // inverse
+    // Computes the inverse of m. The result is undefined if the linear part of m is singular.
+    //
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Affine3 inverse(Affine3 const& m);
+
+    // inverse_rigid
+    // Computes the inverse of m by transposing the linear part, which must be orthonormal.
+    //
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Affine3 inverse_rigid(Affine3 const& m);
+
+    // compose_affine
+    // Builds the affine transformation of trs in a single pass.
+    // Equivalent to Affine3(compose(trs)).
+    //
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Affine3 compose_affine(TRS const& trs);
+
+    // decompose
+    // Decomposes a simple transformation (translation, rotation, (non-uniform) scale)
+    // into individual elements.
+    //
+    [[nodiscard]] ANTON_MATH_CONSTEXPR TRS decompose(Affine3 const& m);
+
+    ANTON_MATH_CONSTEXPR void swap(Affine3& m1, Affine3& m2);
+} // namespace anton::math
+
+#if ANTON_MATH_INLINE
+#    include <anton/math/detail/affine3_impl.hpp>
+#endif
@@ -0,0 +1,299 @@
+#pragma once
+
+#include <anton/types.hpp>
+#include <anton/math/affine3.hpp>
+#include <anton/math/dual_quat.hpp>
+#include <anton/math/mat4.hpp>
+#include <anton/math/quat.hpp>
+#include <anton/math/transform.hpp>
+#include <anton/math/vec3.hpp>
+#include <anton/math/vec4.hpp>
+
+// Functions operating on arrays of floats, vectors and matrices. The arrays are processed with
+// the kernels of the instruction set selected in dispatch.hpp. Unless stated otherwise
+// the output array may be the same as the input array, but must not partially overlap it.
+// The arrays are not required to be aligned beyond the alignment of their element type.
+// Large arrays are split across the executor installed with set_executor (executor.hpp).
+
+namespace anton::math {
+    // multiply
+    // Multiplies count pairs of matrices. Equivalent to out[i] = lhs[i] * rhs[i].
+    // out may be the same array as lhs or rhs.
+    //
+    // Parameters:
+    // lhs - array of count matrices.
+    // rhs - array of count matrices.
+    // out - array of count matrices to write the products to.
+    // count - the number of products. May be 0.
+    //
+    void multiply(Mat4 const* lhs, Mat4 const* rhs, Mat4* out, i64 count);
+
+    // multiply
+    // Multiplies lhs by each of count matrices. Equivalent to out[i] = lhs * rhs[i].
+    // lhs must not be an element of out.
+    //
+    // Parameters:
+    // lhs - the matrix to premultiply by.
+    // rhs - array of count matrices.
+    // out - array of count matrices to write the products to.
+    // count - the number of products. May be 0.
+    //
+    void multiply(Mat4 const& lhs, Mat4 const* rhs, Mat4* out, i64 count);
+
+    // multiply
+    // Multiplies each of count matrices by rhs. Equivalent to out[i] = lhs[i] * rhs.
+    // rhs must not be an element of out.
+    //
+    // Parameters:
+    // lhs - array of count matrices.
+    // rhs - the matrix to postmultiply by.
+    // out - array of count matrices to write the products to.
+    // count - the number of products. May be 0.
+    //
+    void multiply(Mat4 const* lhs, Mat4 const& rhs, Mat4* out, i64 count);
+
+    // inverse
+    // Inverts count matrices. Equivalent to out[i] = inverse(m[i]) within the tolerance
+    // documented by inverse(Mat4 const&).
+    //
+    // Parameters:
+    // m - array of count invertible matrices.
+    // out - array of count matrices to write the inverses to.
+    // count - the number of matrices. May be 0.
+    //
+    void inverse(Mat4 const* m, Mat4* out, i64 count);
+
+    // inverse_affine
+    // Inverts count affine matrices. Equivalent to out[i] = inverse_affine(m[i]).
+    //
+    // Parameters:
+    // m - array of count invertible affine matrices.
+    // out - array of count matrices to write the inverses to.
+    // count - the number of matrices. May be 0.
+    //
+    void inverse_affine(Mat4 const* m, Mat4* out, i64 count);
+
+    // inverse_rigid
+    // Inverts count rigid transformations. Equivalent to out[i] = inverse_rigid(m[i]).
+    //
+    // Parameters:
+    // m - array of count rigid transformation matrices.
+    // out - array of count matrices to write the inverses to.
+    // count - the number of matrices. May be 0.
+    //
+    void inverse_rigid(Mat4 const* m, Mat4* out, i64 count);
+
+    // compose
+    // Builds the transformation matrices of count TRS. Equivalent to out[i] = compose(in[i]).
+    //
+    // Parameters:
+    // in - array of count TRS with unit rotations.
+    // out - array of count matrices to write the results to.
+    // count - the number of transformations. May be 0.
+    //
+    void compose(TRS const* in, Mat4* out, i64 count);
+
+    // compose
+    // Builds the affine transformations of count TRS. Equivalent to out[i] = compose_affine(in[i]).
+    //
+    // Parameters:
+    // in - array of count TRS with unit rotations.
+    // out - array of count affine transformations to write the results to.
+    // count - the number of transformations. May be 0.
+    //
+    void compose(TRS const* in, Affine3* out, i64 count);
+
+    // decompose
+    // Decomposes count simple transformation matrices. Equivalent to out[i] = decompose(in[i])
+    // within a few ULP. The quaternions are extracted without branches.
+    //
+    // Parameters:
+    // in - array of count matrices composed of translation, rotation and positive scale.
+    // out - array of count TRS to write the results to.
+    // count - the number of matrices. May be 0.
+    //
+    void decompose(Mat4 const* in, TRS* out, i64 count);
+
+    // transform_points
+    // Transforms count points by m. The points are extended with w = 1 and w of the
+    // result is discarded, therefore m should be an affine transformation.
+    //
+    // Parameters:
+    // m - the transformation matrix.
+    // in - array of count points to transform.
+    // out - array of count points to write the results to.
+    // count - the number of points. May be 0.
+    //
+    void transform_points(Mat4 const& m, Vec3 const* in, Vec3* out, i64 count);
+
+    // transform_directions
+    // Transforms count directions by m. The directions are extended with w = 0, hence they
+    // are not affected by the translation. The results are not normalized.
+    //
+    // Parameters:
+    // m - the transformation matrix.
+    // in - array of count directions to transform.
+    // out - array of count directions to write the results to.
+    // count - the number of directions. May be 0.
+    //
+    void transform_directions(Mat4 const& m, Vec3 const* in, Vec3* out, i64 count);
+
+    // rotate
+    // Rotates count vectors by q. Equivalent to out[i] = q * in[i]. The rotation matrix
+    // of q is computed once and the vectors are transformed with transform_directions.
+    //
+    // Parameters:
+    // q - unit quaternion to rotate by.
+    // in - array of count vectors to rotate.
+    // out - array of count vectors to write the results to.
+    // count - the number of vectors. May be 0.
+    //
+    void rotate(Quat const& q, Vec3 const* in, Vec3* out, i64 count);
+
+    // transform_points_projective
+    // Transforms count points by m and performs the perspective divide. The points are
+    // extended with w = 1 and the results are divided by w of the transformed points.
+    // Points for which w of the result is 0 yield infinities or NaNs.
+    //
+    // Parameters:
+    // m - the transformation matrix, e.g. a projection matrix.
+    // in - array of count points to transform.
+    // out - array of count points to write the results to.
+    // count - the number of points. May be 0.
+    //
+    void transform_points_projective(Mat4 const& m, Vec3 const* in, Vec3* out, i64 count);
+
+    // transform
+    // Multiplies count vectors by m. Equivalent to out[i] = m * in[i].
+    //
+    // Parameters:
+    // m - the transformation matrix.
+    // in - array of count vectors to transform.
+    // out - array of count vectors to write the results to.
+    // count - the number of vectors. May be 0.
+    //
+    void transform(Mat4 const& m, Vec4 const* in, Vec4* out, i64 count);
+
+    // skin
+    // Deforms count vertices with dual quaternion skinning. Every vertex has 4
+    // influences, each a bone and a weight. The dual quaternions of the bones are
+    // blended with the weights, the influences whose rotation lies in the opposite
+    // hemisphere of the first influence being negated, and the blend is normalized.
+    // The vertex is then transformed by the blend, which, unlike the blend of
+    // matrices, remains a rigid transformation and preserves the volume around the
+    // joints. A vertex with fewer influences has the weights of the remaining ones set
+    // to 0.
+    //
+    // Parameters:
+    // palette - the transformations of the bones from the bind pose to the pose, e.g.
+    //           to_dual_quat(world * inverse_bind).
+    // bones - array of 4 * count indices into palette, 4 per vertex.
+    // weights - array of 4 * count weights, 4 per vertex. The weights of a vertex
+    //           should sum to 1.
+    // positions - array of count positions in the bind pose.
+    // out - array of count positions to write the deformed positions to.
+    // count - the number of vertices. May be 0.
+    //
+    void skin(Dual_Quat const* palette, u16 const* bones, f32 const* weights, Vec3 const* positions, Vec3* out, i64 count);
+
+    // skin
+    // Deforms count vertices with dual quaternion skinning like skin above and
+    // additionally rotates their normals by the blends. The blend of a vertex is
+    // computed once for both. out_positions may be positions and out_normals may be
+    // normals.
+    //
+    // Parameters:
+    // palette - the transformations of the bones from the bind pose to the pose.
+    // bones - array of 4 * count indices into palette, 4 per vertex.
+    // weights - array of 4 * count weights, 4 per vertex.
+    // positions - array of count positions in the bind pose.
+    // normals - array of count normals in the bind pose.
+    // out_positions - array of count positions to write the deformed positions to.
+    // out_normals - array of count normals to write the deformed normals to.
+    // count - the number of vertices. May be 0.
+    //
+    void skin(Dual_Quat const* palette, u16 const* bones, f32 const* weights, Vec3 const* positions, Vec3 const* normals, Vec3* out_positions,
+              Vec3* out_normals, i64 count);
+
+    // sin, cos, tan
+    // Evaluates the function for count angles in radians. Equivalent to out[i] = sin(in[i]).
+    // The maximum error is 2 ULP for sin and cos and 3 ULP for tan. Angles with
+    // |in[i]| >= 65536 and non-finite angles are evaluated by the scalar functions.
+    //
+    // Parameters:
+    // in - array of count angles.
+    // out - array of count floats to write the results to.
+    // count - the number of elements. May be 0.
+    //
+    void sin(f32 const* in, f32* out, i64 count);
+    void cos(f32 const* in, f32* out, i64 count);
+    void tan(f32 const* in, f32* out, i64 count);
+
+    // sincos
+    // Evaluates the sine and the cosine of count angles in radians sharing the range
+    // reduction. Equivalent to sin(in, sin, count) followed by cos(in, cos, count).
+    // sin and cos may not be the same array.
+    //
+    // Parameters:
+    // in - array of count angles.
+    // sin - array of count floats to write the sines to.
+    // cos - array of count floats to write the cosines to.
+    // count - the number of elements. May be 0.
+    //
+    void sincos(f32 const* in, f32* sin, f32* cos, i64 count);
+
+    // asin, acos, atan
+    // Evaluates the function for count values. Equivalent to out[i] = asin(in[i]).
+    // The maximum error is 2.5 ULP for asin and atan and 1.5 ULP for acos.
+    //
+    // Parameters:
+    // in - array of count values.
+    // out - array of count angles in radians to write the results to.
+    // count - the number of elements. May be 0.
+    //
+    void asin(f32 const* in, f32* out, i64 count);
+    void acos(f32 const* in, f32* out, i64 count);
+    void atan(f32 const* in, f32* out, i64 count);
+
+    // atan2
+    // Evaluates atan2 for count pairs. Equivalent to out[i] = atan2(y[i], x[i]).
+    // The maximum error is 3 ULP. Pairs with a zero or non-finite argument are
+    // evaluated by the scalar function.
+    //
+    // Parameters:
+    // y - array of count y coordinates.
+    // x - array of count x coordinates.
+    // out - array of count angles in radians to write the results to.
+    // count - the number of elements. May be 0.
+    //
+    void atan2(f32 const* y, f32 const* x, f32* out, i64 count);
+
+    // exp, log, log2
+    // Evaluates the function for count values. Equivalent to out[i] = exp(in[i]).
+    // The maximum error is 1.5 ULP for exp, 1 ULP for log and 1.5 ULP for log2.
+    // Values for which the result or the argument is not a normal number are evaluated
+    // by the scalar functions.
+    //
+    // Parameters:
+    // in - array of count values.
+    // out - array of count floats to write the results to.
+    // count - the number of elements. May be 0.
+    //
+    void exp(f32 const* in, f32* out, i64 count);
+    void log(f32 const* in, f32* out, i64 count);
+    void log2(f32 const* in, f32* out, i64 count);
+
+    // pow
+    // Raises count bases to the exponents. Equivalent to out[i] = pow(base[i], exp[i]).
+    // The maximum error is 1 ULP. Bases that are not positive normal numbers, non-finite
+    // exponents and results that are not normal numbers are evaluated by the scalar
+    // function.
+    //
+    // Parameters:
+    // base - array of count bases.
+    // exp - array of count exponents.
+    // out - array of count floats to write the results to.
+    // count - the number of elements. May be 0.
+    //
+    void pow(f32 const* base, f32 const* exp, f32* out, i64 count);
+} // namespace anton::math
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <anton/types.hpp>
+
+namespace anton::math {
+    struct Quat_Array;
+    struct Vec3_Array;
+
+    // Slerp_Method
+    // The evaluation of the spherical interpolation by the array functions. The errors
+    // below are the angles between the results and slerp on the unit sphere. The
+    // rotations represented by the quaternions deviate by twice the angle.
+    //
+    enum struct Slerp_Method : u8 {
+        // slerp evaluated with acos and sin. Exact up to the rounding errors.
+        exact,
+        // normalize(lerp(a, b, t)). The result lies on the arc between a and b, but
+        // moves along it with a nonuniform speed. The error grows with the angle
+        // between a and b and reaches 0.07 radians at 90 degrees.
+        nlerp,
+        // nlerp with t corrected by a polynomial in t and the cosine of the angle
+        // between a and b. The error stays below 3e-5 radians for quaternions and for
+        // vectors at most 90 degrees apart. Costs about as much as nlerp.
+        nlerp_corrected,
+    };
+
+    // The functions below operate on arrays of equal size. out must have the same size
+    // as the inputs and may be one of them. The arrays are split across the executor
+    // (executor.hpp) when they are large enough.
+
+    // slerp
+    // out[i] = slerp(a[i], b[i], t) evaluated with method. The quaternions must be unit
+    // quaternions and are interpolated along the shorter path like math::slerp.
+    //
+    void slerp(Quat_Array const& a, Quat_Array const& b, f32 t, Slerp_Method method, Quat_Array& out);
+
+    // slerp
+    // out[i] = slerp(a[i], b[i], t) evaluated with method. The vectors must be unit
+    // vectors. The interpolation of opposite vectors is undefined.
+    //
+    void slerp(Vec3_Array const& a, Vec3_Array const& b, f32 t, Slerp_Method method, Vec3_Array& out);
+
+    // blend
+    // Weighted blend of input_count quaternion arrays in a single pass, e.g. the
+    // animation layers of a pose. out[i] is the normalized sum of weights[k] * q[k][i]
+    // where q[k][i] is inputs[k][i] negated if it lies in the opposite hemisphere of
+    // inputs[0][i]. With 2 inputs and weights 1 - t and t equivalent to
+    // Slerp_Method::nlerp. Elements whose sum is 0 become 0.
+    //
+    // Parameters:
+    // inputs - array of input_count pointers to the arrays to blend.
+    // weights - array of input_count weights. The weights need not sum to 1.
+    // input_count - the number of inputs. Must be at least 1.
+    //
+    void blend(Quat_Array const* const* inputs, f32 const* weights, i64 input_count, Quat_Array& out);
+
+    // blend
+    // Weighted blend of input_count vector arrays in a single pass, e.g. the
+    // translations or the scales of the animation layers of a pose.
+    // out[i] = weights[0] * inputs[0][i] + ... + weights[input_count - 1] * inputs[input_count - 1][i].
+    //
+    // Parameters:
+    // inputs - array of input_count pointers to the arrays to blend.
+    // weights - array of input_count weights.
+    // input_count - the number of inputs. Must be at least 1.
+    //
+    void blend(Vec3_Array const* const* inputs, f32 const* weights, i64 input_count, Vec3_Array& out);
+} // namespace anton::math
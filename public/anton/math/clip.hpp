@@ -0,0 +1,113 @@
+#pragma once
+
+#include <anton/types.hpp>
+
+namespace anton::math {
+    struct Mat4;
+    struct TRS;
+
+    // Bone_Error
+    // The error budget of a bone of a compressed clip. The error is the distance
+    // between the points transformed by the original and by the decompressed local
+    // transformation of the bone, measured at shell_distance from the origin of the
+    // bone. The errors of the bones accumulate along the hierarchy, hence the budgets
+    // of the bones close to the root should be tighter.
+    //
+    struct Bone_Error {
+        // The maximum error, in the units of the translations.
+        f32 max_error;
+        // The distance from the origin of the bone at which the error of the rotation
+        // and of the scale is measured, e.g. the extent of the geometry skinned to the
+        // bone. Must be positive.
+        f32 shell_distance;
+    };
+
+    // Compressed_Clip
+    // An animation clip compressed by compress_clip. The clip is a single block of
+    // bytes that can be stored and loaded as is. The frames are split into segments
+    // of up to 16 frames. Every segment stores the keys of all bones contiguously, so
+    // that a sample reads a single segment.
+    //
+    struct Compressed_Clip {
+    public:
+        Compressed_Clip();
+        // Loads a clip from the data of a clip returned by compress_clip. The data is
+        // copied.
+        //
+        // Parameters:
+        // data - the bytes of the clip.
+        // size - the number of bytes.
+        //
+        Compressed_Clip(u8 const* data, i64 size);
+        Compressed_Clip(Compressed_Clip const& other);
+        Compressed_Clip(Compressed_Clip&& other);
+        ~Compressed_Clip();
+        Compressed_Clip& operator=(Compressed_Clip const& other);
+        Compressed_Clip& operator=(Compressed_Clip&& other);
+
+        [[nodiscard]] i64 get_bone_count() const;
+        [[nodiscard]] i64 get_frame_count() const;
+        // get_sample_rate
+        // The number of frames per second.
+        //
+        [[nodiscard]] f32 get_sample_rate() const;
+        // get_duration
+        // The time of the last frame in seconds.
+        //
+        [[nodiscard]] f32 get_duration() const;
+
+        // size
+        // The number of bytes of the clip.
+        //
+        [[nodiscard]] i64 size() const;
+
+        [[nodiscard]] u8 const* get_data() const;
+
+    private:
+        u8* _data;
+        i64 _size;
+    };
+
+    // compress_clip
+    // Compresses a clip sampled at a constant rate. Every track of a bone, i.e. its
+    // rotations, translations and scales, is stored as a constant, as keys quantized
+    // against the range of the track (rotations with the smallest three components)
+    // or as raw keys, whichever is the smallest within the error budget of the bone.
+    // The keys that can be reconstructed from their neighbours within the budget are
+    // removed.
+    //
+    // Returns an empty clip when sample_rate is not positive.
+    //
+    // Parameters:
+    // frames - array of frame_count * bone_count local transformations. The
+    //          transformations of a frame are contiguous.
+    // bone_count - the number of bones.
+    // frame_count - the number of frames. Must be at least 1.
+    // sample_rate - the number of frames per second. Must be positive.
+    // errors - array of bone_count error budgets of the bones.
+    //
+    [[nodiscard]] Compressed_Clip compress_clip(TRS const* frames, i64 bone_count, i64 frame_count, f32 sample_rate, Bone_Error const* errors);
+
+    // sample
+    // Decompresses the local transformations of the bones at time. The keys are
+    // interpolated linearly, the rotations with nlerp. time is clamped to the duration
+    // of the clip.
+    //
+    // Parameters:
+    // clip - the clip to sample.
+    // time - the time in seconds.
+    // out - array of clip.get_bone_count() transformations to write the samples to.
+    //
+    void sample(Compressed_Clip const& clip, f32 time, TRS* out);
+
+    // sample
+    // Decompresses the local transformations of the bones at time and composes them
+    // into matrices like compose(TRS).
+    //
+    // Parameters:
+    // clip - the clip to sample.
+    // time - the time in seconds.
+    // out - array of clip.get_bone_count() matrices to write the samples to.
+    //
+    void sample(Compressed_Clip const& clip, f32 time, Mat4* out);
+} // namespace anton::math
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <anton/math/affine3.hpp>
+
+namespace anton::math {
+    ANTON_MATH_CONSTEXPR Affine3::Affine3(Mat4 const& m): columns{Vec3{m[0]}, Vec3{m[1]}, Vec3{m[2]}, Vec3{m[3]}} {}
+    ANTON_MATH_CONSTEXPR Affine3::Affine3(f32 const* const p): columns{Vec3{p}, Vec3{p + 3}, Vec3{p + 6}, Vec3{p + 9}} {}
+
+    ANTON_MATH_CONSTEXPR Vec3& Affine3::operator[](i32 const column) {
+        return columns[column];
+    }
+
+    ANTON_MATH_CONSTEXPR Vec3 const& Affine3::operator[](i32 const column) const {
+        return columns[column];
+    }
+
+    ANTON_MATH_CONSTEXPR f32& Affine3::operator()(i32 const column, i32 const row) {
+        return columns[column][row];
+    }
+
+    ANTON_MATH_CONSTEXPR f32 const& Affine3::operator()(i32 const column, i32 const row) const {
+        return columns[column][row];
+    }
+
+    ANTON_MATH_FUNCTION f32* Affine3::data() {
+        return (f32*)columns;
+    }
+
+    ANTON_MATH_FUNCTION f32 const* Affine3::data() const {
+        return (f32 const*)columns;
+    }
+
+    ANTON_MATH_CONSTEXPR Affine3& Affine3::operator*=(Affine3 const& rhs) {
+        // Each column of rhs is read before the corresponding column of this is
+        // written, therefore rhs may alias this.
+        Affine3 const lhs = *this;
+        for(i32 i = 0; i < 4; ++i) {
+            Vec3 const r = rhs[i];
+            columns[i] = lhs[0] * r.x + lhs[1] * r.y + lhs[2] * r.z;
+        }
+        columns[3] += lhs[3];
+        return *this;
+    }
+
+    ANTON_MATH_CONSTEXPR Affine3 operator*(Affine3 lhs, Affine3 const& rhs) {
+        lhs *= rhs;
+        return lhs;
+    }
+
+    ANTON_MATH_CONSTEXPR Mat4 to_mat4(Affine3 const& m) {
+        return {Vec4{m[0], 0.0f}, Vec4{m[1], 0.0f}, Vec4{m[2], 0.0f}, Vec4{m[3], 1.0f}};
+    }
+
+    ANTON_MATH_CONSTEXPR Vec3 transform_point(Affine3 const& m, Vec3 const& p) {
+        return m[0] * p.x + m[1] * p.y + m[2] * p.z + m[3];
+    }
+
+    ANTON_MATH_CONSTEXPR Vec3 transform_direction(Affine3 const& m, Vec3 const& d) {
+        return m[0] * d.x + m[1] * d.y + m[2] * d.z;
+    }
+
+    ANTON_MATH_CONSTEXPR Affine3 inverse(Affine3 const& m) {
+        // The rows of the inverse of the linear part are the cross products of its
+        // columns divided by the determinant.
+        Vec3 const r0 = cross(m[1], m[2]);
+        Vec3 const r1 = cross(m[2], m[0]);
+        Vec3 const r2 = cross(m[0], m[1]);
+        f32 const inv_det = 1.0f / dot(m[0], r0);
+        Vec3 const i0 = r0 * inv_det;
+        Vec3 const i1 = r1 * inv_det;
+        Vec3 const i2 = r2 * inv_det;
+        return {{i0.x, i1.x, i2.x}, {i0.y, i1.y, i2.y}, {i0.z, i1.z, i2.z}, {-dot(i0, m[3]), -dot(i1, m[3]), -dot(i2, m[3])}};
+    }
+
+    ANTON_MATH_CONSTEXPR Affine3 inverse_rigid(Affine3 const& m) {
+        Vec3 const& x = m[0];
+        Vec3 const& y = m[1];
+        Vec3 const& z = m[2];
+        return {{x.x, y.x, z.x}, {x.y, y.y, z.y}, {x.z, y.z, z.z}, {-dot(x, m[3]), -dot(y, m[3]), -dot(z, m[3])}};
+    }
+
+    ANTON_MATH_CONSTEXPR Affine3 compose_affine(TRS const& trs) {
+        Quat const& q = trs.rotation;
+        Vec3 const& s = trs.scale;
+        return {{(1 - 2 * q.y * q.y - 2 * q.z * q.z) * s.x, (2 * q.x * q.y + 2 * q.z * q.w) * s.x, (2 * q.x * q.z - 2 * q.y * q.w) * s.x},
+                {(2 * q.x * q.y - 2 * q.z * q.w) * s.y, (1 - 2 * q.x * q.x - 2 * q.z * q.z) * s.y, (2 * q.y * q.z + 2 * q.x * q.w) * s.y},
+                {(2 * q.x * q.z + 2 * q.y * q.w) * s.z, (2 * q.y * q.z - 2 * q.x * q.w) * s.z, (1 - 2 * q.x * q.x - 2 * q.y * q.y) * s.z},
+                trs.translation};
+    }
+
+    ANTON_MATH_CONSTEXPR TRS decompose(Affine3 const& m) {
+        return decompose(to_mat4(m));
+    }
+
+    ANTON_MATH_CONSTEXPR void swap(Affine3& m1, Affine3& m2) {
+        swap(m1[0], m2[0]);
+        swap(m1[1], m2[1]);
+        swap(m1[2], m2[2]);
+        swap(m1[3], m2[3]);
+    }
+} // namespace anton::math
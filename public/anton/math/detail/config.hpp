@@ -0,0 +1,75 @@
+#pragma once
+
+// ANTON_MATH_INLINE
+// When enabled, the definitions of the vector, matrix, quaternion and
+// transform functions are provided by the public headers instead of the
+// library, which allows the compiler to inline and constant-fold them.
+//
+#ifndef ANTON_MATH_INLINE
+#    define ANTON_MATH_INLINE 0
+#endif
+
+// ANTON_MATH_FUNCTION
+// Specifier of functions that have their definitions in detail/*_impl.hpp.
+//
+// ANTON_MATH_CONSTEXPR
+// Specifier of functions that additionally may be evaluated at compile time.
+// The transcendental functions switch to portable implementations in
+// detail/constexpr_math.hpp when constant evaluated. The constructors of the
+// vector, matrix and quaternion types and their zero and identity constants
+// are constexpr regardless of ANTON_MATH_INLINE.
+//
+#if ANTON_MATH_INLINE
+#    define ANTON_MATH_FUNCTION inline
+#    define ANTON_MATH_CONSTEXPR inline constexpr
+#else
+#    define ANTON_MATH_FUNCTION
+#    define ANTON_MATH_CONSTEXPR
+#endif
+
+// ANTON_MATH_CONSTANT_EVALUATED
+// Whether the enclosing ANTON_MATH_CONSTEXPR function is being evaluated at
+// compile time. __builtin_is_constant_evaluated is supported by all major
+// compilers.
+//
+#if ANTON_MATH_INLINE
+#    define ANTON_MATH_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#else
+#    define ANTON_MATH_CONSTANT_EVALUATED() false
+#endif
+
+// ANTON_MATH_SIMD
+// When enabled, Vec4 (and therefore Mat4) is aligned to 16 bytes and its
+// arithmetic is implemented with SSE intrinsics where the target supports
+// them. ANTON_MATH_SSE2 is set when the SSE implementation is in use and
+// ANTON_MATH_AVX when the compiler additionally targets AVX.
+//
+#ifndef ANTON_MATH_SIMD
+#    define ANTON_MATH_SIMD 0
+#endif
+
+#if ANTON_MATH_SIMD && (defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#    define ANTON_MATH_SSE2 1
+#else
+#    define ANTON_MATH_SSE2 0
+#endif
+
+#if ANTON_MATH_SSE2 && defined(__AVX__)
+#    define ANTON_MATH_AVX 1
+#else
+#    define ANTON_MATH_AVX 0
+#endif
+
+#if ANTON_MATH_SIMD
+#    define ANTON_MATH_SIMD_ALIGN alignas(16)
+#else
+#    define ANTON_MATH_SIMD_ALIGN
+#endif
+
+// ANTON_MATH_PROFILE
+// When enabled, the array kernels count their invocations and measure them with
+// the hardware performance counters. See profile.hpp.
+//
+#ifndef ANTON_MATH_PROFILE
+#    define ANTON_MATH_PROFILE 0
+#endif
@@ -0,0 +1,445 @@
+#pragma once
+
+#include <anton/types.hpp>
+
+// Implementations of the functions of math.hpp that are used when the functions are
+// evaluated at compile time. They compute in f64 which makes the results rounded to
+// f32 correctly rounded in all but rare cases. They are too slow for runtime use.
+//
+// The functions return nan and infinities explicitly instead of computing them
+// because some compilers reject constant expressions whose arithmetic produces nan.
+// __builtin_bit_cast and __builtin_nan are supported by all major compilers.
+//
+namespace anton::math::detail {
+    constexpr f64 constexpr_pi = 3.141592653589793;
+    constexpr f64 constexpr_half_pi = 1.5707963267948966;
+    constexpr f64 constexpr_quarter_pi = 0.7853981633974483;
+    constexpr f64 constexpr_ln2 = 0.6931471805599453;
+    constexpr f64 constexpr_ln10 = 2.302585092994046;
+    constexpr f64 constexpr_largest = 1.7976931348623157e+308;
+    constexpr f64 constexpr_smallest_normal = 2.2250738585072014e-308;
+    constexpr f64 constexpr_infinity = __builtin_huge_val();
+    // Adding and subtracting 1.5 * 2^52 rounds an f64 with magnitude below 2^51 to
+    // the nearest integer.
+    constexpr f64 constexpr_round_magic = 6755399441055744.0;
+
+    [[nodiscard]] constexpr f64 constexpr_nan() {
+        return __builtin_nan("");
+    }
+
+    [[nodiscard]] constexpr bool constexpr_is_nan(f64 const v) {
+        return v != v;
+    }
+
+    [[nodiscard]] constexpr bool constexpr_is_infinite(f64 const v) {
+        return v > constexpr_largest || v < -constexpr_largest;
+    }
+
+    [[nodiscard]] constexpr bool constexpr_sign_bit(f64 const v) {
+        return (__builtin_bit_cast(u64, v) >> 63) != 0;
+    }
+
+    // constexpr_scale
+    // Computes v * 2^e.
+    //
+    [[nodiscard]] constexpr f64 constexpr_scale(f64 v, i32 e) {
+        while(e > 1000) {
+            v *= __builtin_bit_cast(f64, u64(2023) << 52);
+            e -= 1000;
+        }
+
+        while(e < -1000) {
+            v *= __builtin_bit_cast(f64, u64(23) << 52);
+            e += 1000;
+        }
+
+        return v * __builtin_bit_cast(f64, u64(e + 1023) << 52);
+    }
+
+    // constexpr_split
+    // Splits a positive finite v into m * 2^e with m in [1, 2).
+    //
+    [[nodiscard]] constexpr f64 constexpr_split(f64 v, i32& e) {
+        e = 0;
+        if(v < constexpr_smallest_normal) {
+            v *= 18014398509481984.0;
+            e = -54;
+        }
+
+        u64 const bits = __builtin_bit_cast(u64, v);
+        e += static_cast<i32>((bits >> 52) & 0x7FF) - 1023;
+        return __builtin_bit_cast(f64, (bits & 0x000FFFFFFFFFFFFF) | 0x3FF0000000000000);
+    }
+
+    [[nodiscard]] constexpr f64 constexpr_sqrt(f64 const v) {
+        if(constexpr_is_nan(v)) {
+            return v;
+        } else if(v < 0.0) {
+            return constexpr_nan();
+        } else if(v == 0.0 || constexpr_is_infinite(v)) {
+            return v;
+        }
+
+        // v = m * 2^e with an even e and m in [1, 4).
+        i32 e = 0;
+        f64 m = constexpr_split(v, e);
+        if(e & 1) {
+            m *= 2.0;
+            e -= 1;
+        }
+
+        f64 r = 0.5 * (m + 1.0);
+        for(i32 i = 0; i < 6; ++i) {
+            r = 0.5 * (r + m / r);
+        }
+
+        return constexpr_scale(r, e / 2);
+    }
+
+    // constexpr_sqrtf
+    // The correctly rounded square root of v.
+    //
+    [[nodiscard]] constexpr f32 constexpr_sqrtf(f32 const v) {
+        f32 r = static_cast<f32>(constexpr_sqrt(v));
+        if(!(r > 0.0f) || constexpr_is_infinite(r)) {
+            return r;
+        }
+
+        // The squares of the midpoints between r and its neighbours have at most 50
+        // significant bits and are exact in f64.
+        u32 const bits = __builtin_bit_cast(u32, r);
+        f32 const up = __builtin_bit_cast(f32, bits + 1);
+        f32 const down = __builtin_bit_cast(f32, bits - 1);
+        f64 const mid_up = 0.5 * (static_cast<f64>(r) + static_cast<f64>(up));
+        f64 const mid_down = 0.5 * (static_cast<f64>(r) + static_cast<f64>(down));
+        if(mid_up * mid_up < static_cast<f64>(v)) {
+            r = up;
+        } else if(mid_down * mid_down > static_cast<f64>(v)) {
+            r = down;
+        }
+
+        return r;
+    }
+
+    [[nodiscard]] constexpr f64 constexpr_inv_sqrt(f64 const v) {
+        f64 const r = constexpr_sqrt(v);
+        if(constexpr_is_nan(r)) {
+            return r;
+        } else if(r == 0.0) {
+            return constexpr_sign_bit(r) ? -constexpr_infinity : constexpr_infinity;
+        } else {
+            return 1.0 / r;
+        }
+    }
+
+    [[nodiscard]] constexpr f64 constexpr_exp(f64 const v) {
+        if(constexpr_is_nan(v)) {
+            return v;
+        } else if(v > 709.782712893384) {
+            return constexpr_infinity;
+        } else if(v < -745.2) {
+            return 0.0;
+        }
+
+        // v = r + k * ln(2) where |r| <= ln(2) / 2. ln(2) is split into 2 parts, the
+        // first one having enough trailing zeros for k * ln2_hi to be exact.
+        f64 const ln2_hi = 6.93147180369123816490e-01;
+        f64 const ln2_lo = 1.90821492927058770002e-10;
+        f64 const k = (v * 1.4426950408889634 + constexpr_round_magic) - constexpr_round_magic;
+        f64 const r = (v - k * ln2_hi) - k * ln2_lo;
+        f64 term = 1.0;
+        f64 sum = 1.0;
+        for(i32 n = 1; n < 28; ++n) {
+            term *= r / n;
+            sum += term;
+        }
+
+        return constexpr_scale(sum, static_cast<i32>(k));
+    }
+
+    [[nodiscard]] constexpr f64 constexpr_log(f64 const v) {
+        if(constexpr_is_nan(v)) {
+            return v;
+        } else if(v < 0.0) {
+            return constexpr_nan();
+        } else if(v == 0.0) {
+            return -constexpr_infinity;
+        } else if(constexpr_is_infinite(v)) {
+            return v;
+        }
+
+        // v = m * 2^e with m in [sqrt(2) / 2, sqrt(2)).
+        // ln(m) = 2 * atanh(s) = 2 * (s + s^3 / 3 + s^5 / 5 + ...) where s = (m - 1) / (m + 1).
+        i32 e = 0;
+        f64 m = constexpr_split(v, e);
+        if(m > 1.4142135623730951) {
+            m *= 0.5;
+            e += 1;
+        }
+
+        f64 const s = (m - 1.0) / (m + 1.0);
+        f64 const z = s * s;
+        f64 term = s;
+        f64 sum = s;
+        for(i32 n = 3; n < 60; n += 2) {
+            term *= z;
+            sum += term / n;
+        }
+
+        f64 const ln2_hi = 6.93147180369123816490e-01;
+        f64 const ln2_lo = 1.90821492927058770002e-10;
+        return e * ln2_hi + (e * ln2_lo + 2.0 * sum);
+    }
+
+    [[nodiscard]] constexpr f64 constexpr_log2(f64 const v) {
+        f64 const r = constexpr_log(v);
+        return constexpr_is_nan(r) ? r : r / constexpr_ln2;
+    }
+
+    [[nodiscard]] constexpr f64 constexpr_log10(f64 const v) {
+        f64 const r = constexpr_log(v);
+        return constexpr_is_nan(r) ? r : r / constexpr_ln10;
+    }
+
+    [[nodiscard]] constexpr f64 constexpr_atan(f64 const v) {
+        if(constexpr_is_nan(v)) {
+            return v;
+        }
+
+        // atan(a) = pi / 2 - atan(1 / a) for a > 1.
+        // atan(a) = pi / 4 + atan((a - 1) / (a + 1)) for a > tan(pi / 8).
+        bool const negative = v < 0.0;
+        f64 a = negative ? -v : v;
+        bool const inverted = a > 1.0;
+        if(inverted) {
+            a = 1.0 / a;
+        }
+
+        f64 offset = 0.0;
+        if(a > 0.41421356237309503) {
+            a = (a - 1.0) / (a + 1.0);
+            offset = constexpr_quarter_pi;
+        }
+
+        f64 const z = a * a;
+        f64 term = a;
+        f64 sum = a;
+        for(i32 n = 3; n < 80; n += 2) {
+            term *= -z;
+            sum += term / n;
+        }
+
+        f64 r = offset + sum;
+        if(inverted) {
+            r = constexpr_half_pi - r;
+        }
+
+        return negative ? -r : r;
+    }
+
+    [[nodiscard]] constexpr f64 constexpr_atan2(f64 const y, f64 const x) {
+        if(constexpr_is_nan(y) || constexpr_is_nan(x)) {
+            return constexpr_nan();
+        }
+
+        if(y == 0.0) {
+            if(constexpr_sign_bit(x)) {
+                return constexpr_sign_bit(y) ? -constexpr_pi : constexpr_pi;
+            } else {
+                return y;
+            }
+        }
+
+        if(x == 0.0) {
+            return y > 0.0 ? constexpr_half_pi : -constexpr_half_pi;
+        }
+
+        if(constexpr_is_infinite(x)) {
+            f64 r = 0.0;
+            if(constexpr_is_infinite(y)) {
+                r = x > 0.0 ? constexpr_quarter_pi : 3.0 * constexpr_quarter_pi;
+            } else {
+                r = x > 0.0 ? 0.0 : constexpr_pi;
+            }
+            return y < 0.0 ? -r : r;
+        }
+
+        f64 const r = constexpr_atan(y / x);
+        if(x > 0.0) {
+            return r;
+        } else {
+            return y > 0.0 ? r + constexpr_pi : r - constexpr_pi;
+        }
+    }
+
+    [[nodiscard]] constexpr f64 constexpr_asin(f64 const v) {
+        if(constexpr_is_nan(v) || v > 1.0 || v < -1.0) {
+            return constexpr_nan();
+        }
+
+        return constexpr_atan2(v, constexpr_sqrt((1.0 - v) * (1.0 + v)));
+    }
+
+    [[nodiscard]] constexpr f64 constexpr_acos(f64 const v) {
+        if(constexpr_is_nan(v) || v > 1.0 || v < -1.0) {
+            return constexpr_nan();
+        }
+
+        return constexpr_atan2(constexpr_sqrt((1.0 - v) * (1.0 + v)), v);
+    }
+
+    // The bits of 2 / pi in 32-bit words starting from the most significant one.
+    constexpr u32 constexpr_two_over_pi[] = {0xA2F9836E, 0x4E441529, 0xFC2757D1, 0xF534DDC0, 0xDB629599, 0x3C439041, 0xFE5163AB, 0xDEBBC561};
+
+    // constexpr_reduce_half_pi
+    // Reduces a non-negative finite v to r in [-pi / 4, pi / 4] such that
+    // v = r + (quadrant + 4k) * pi / 2.
+    //
+    [[nodiscard]] constexpr f64 constexpr_reduce_half_pi(f32 const v, i32& quadrant) {
+        if(v < 1048576.0f) {
+            // pi / 2 split into 3 parts, the first 2 having 33 significant bits so that
+            // multiplying them by k < 2^20 is exact.
+            f64 const x = v;
+            f64 const k = (x * 0.6366197723675814 + constexpr_round_magic) - constexpr_round_magic;
+            quadrant = static_cast<i32>(static_cast<i64>(k) & 3);
+            return ((x - k * 1.5707963267341256) - k * 6.077100506303966e-11) - k * 2.0222662487959506e-21;
+        }
+
+        // Payne-Hanek reduction. v = m * 2^e where m is a 24-bit integer. Only the bits
+        // of 2 / pi starting from the word first whose product with m * 2^e is not a
+        // multiple of 4 contribute to the quadrant and r. The product of m and 4
+        // words of 2 / pi starting from first is p with the binary point 96 - s bits
+        // from the least significant bit.
+        u32 const bits = __builtin_bit_cast(u32, v);
+        u64 const m = (bits & 0x7FFFFF) | 0x800000;
+        i32 const e = static_cast<i32>(bits >> 23) - 127 - 23;
+        i32 const first = e >= 2 ? (e - 2) / 32 : 0;
+        i32 const s = e - 32 * (first + 1);
+        u32 p[5] = {};
+        u64 carry = 0;
+        for(i32 i = 0; i < 4; ++i) {
+            u64 const product = static_cast<u64>(constexpr_two_over_pi[first + 3 - i]) * m + carry;
+            p[i] = static_cast<u32>(product);
+            carry = product >> 32;
+        }
+        p[4] = static_cast<u32>(carry);
+
+        i32 const point = 96 - s;
+        quadrant = static_cast<i32>((p[point / 32] >> (point % 32)) & 1) | (static_cast<i32>((p[(point + 1) / 32] >> ((point + 1) % 32)) & 1) << 1);
+        u64 fraction = 0;
+        for(i32 i = 0; i < 64; ++i) {
+            i32 const position = point - 64 + i;
+            fraction |= static_cast<u64>((p[position / 32] >> (position % 32)) & 1) << i;
+        }
+
+        f64 r = static_cast<f64>(fraction) * 5.421010862427522e-20;
+        if(r >= 0.5) {
+            r -= 1.0;
+            quadrant = (quadrant + 1) & 3;
+        }
+        return r * constexpr_half_pi;
+    }
+
+    // Evaluates sin(r) and cos(r) for r in [-pi / 4, pi / 4].
+    [[nodiscard]] constexpr f64 constexpr_sin_series(f64 const r) {
+        f64 const z = r * r;
+        f64 term = r;
+        f64 sum = r;
+        for(i32 n = 2; n < 30; n += 2) {
+            term *= -z / (n * (n + 1));
+            sum += term;
+        }
+        return sum;
+    }
+
+    [[nodiscard]] constexpr f64 constexpr_cos_series(f64 const r) {
+        f64 const z = r * r;
+        f64 term = 1.0;
+        f64 sum = 1.0;
+        for(i32 n = 1; n < 30; n += 2) {
+            term *= -z / (n * (n + 1));
+            sum += term;
+        }
+        return sum;
+    }
+
+    [[nodiscard]] constexpr f64 constexpr_sin(f32 const v) {
+        if(constexpr_is_nan(v) || constexpr_is_infinite(v)) {
+            return constexpr_nan();
+        } else if(v == 0.0f) {
+            return v;
+        }
+
+        i32 quadrant = 0;
+        f64 const r = constexpr_reduce_half_pi(v < 0.0f ? -v : v, quadrant);
+        f64 const s = (quadrant & 1) ? constexpr_cos_series(r) : constexpr_sin_series(r);
+        bool const negative = (quadrant & 2) != (v < 0.0f ? 2 : 0);
+        return negative ? -s : s;
+    }
+
+    [[nodiscard]] constexpr f64 constexpr_cos(f32 const v) {
+        if(constexpr_is_nan(v) || constexpr_is_infinite(v)) {
+            return constexpr_nan();
+        }
+
+        i32 quadrant = 0;
+        f64 const r = constexpr_reduce_half_pi(v < 0.0f ? -v : v, quadrant);
+        f64 const c = (quadrant & 1) ? constexpr_sin_series(r) : constexpr_cos_series(r);
+        return ((quadrant + 1) & 2) ? -c : c;
+    }
+
+    [[nodiscard]] constexpr f64 constexpr_tan(f32 const v) {
+        if(constexpr_is_nan(v) || constexpr_is_infinite(v)) {
+            return constexpr_nan();
+        } else if(v == 0.0f) {
+            return v;
+        }
+
+        // r is never 0 for a non-zero v because pi / 2 is irrational.
+        i32 quadrant = 0;
+        f64 const r = constexpr_reduce_half_pi(v < 0.0f ? -v : v, quadrant);
+        f64 const s = constexpr_sin_series(r);
+        f64 const c = constexpr_cos_series(r);
+        f64 const t = (quadrant & 1) ? -c / s : s / c;
+        return v < 0.0f ? -t : t;
+    }
+
+    [[nodiscard]] constexpr f64 constexpr_pow(f64 const base, f64 const exp) {
+        if(exp == 0.0 || base == 1.0) {
+            return 1.0;
+        } else if(constexpr_is_nan(base) || constexpr_is_nan(exp)) {
+            return constexpr_nan();
+        }
+
+        f64 const abs_exp = exp < 0.0 ? -exp : exp;
+        bool const integer = abs_exp >= 4503599627370496.0 || static_cast<f64>(static_cast<i64>(exp)) == exp;
+        bool const odd = integer && abs_exp < 9007199254740992.0 && (static_cast<i64>(exp) & 1) != 0;
+        bool const negative = constexpr_sign_bit(base) && odd;
+        f64 const abs_base = base < 0.0 ? -base : base;
+        if(constexpr_is_infinite(exp)) {
+            if(abs_base == 1.0) {
+                return 1.0;
+            }
+            return (abs_base > 1.0) == (exp > 0.0) ? constexpr_infinity : 0.0;
+        } else if(abs_base == 0.0 || constexpr_is_infinite(abs_base)) {
+            f64 const r = (abs_base == 0.0) == (exp < 0.0) ? constexpr_infinity : 0.0;
+            return negative ? -r : r;
+        } else if(base < 0.0 && !integer) {
+            return constexpr_nan();
+        }
+
+        f64 const r = constexpr_exp(exp * constexpr_log(abs_base));
+        return negative ? -r : r;
+    }
+
+    [[nodiscard]] constexpr f64 constexpr_cbrt(f64 const v) {
+        if(constexpr_is_nan(v) || v == 0.0 || constexpr_is_infinite(v)) {
+            return v;
+        }
+
+        f64 const a = v < 0.0 ? -v : v;
+        f64 r = constexpr_exp(constexpr_log(a) / 3.0);
+        r -= (r * r * r - a) / (3.0 * r * r);
+        return v < 0.0 ? -r : r;
+    }
+} // namespace anton::math::detail
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <anton/math/dual_quat.hpp>
+#include <anton/math/math.hpp>
+#include <anton/math/detail/utility.hpp>
+
+namespace anton::math {
+    ANTON_MATH_CONSTEXPR Dual_Quat Dual_Quat::from_rotation_translation(Quat const& rotation, Vec3 const& translation) {
+        return {rotation, Quat(translation.x, translation.y, translation.z, 0.0f) * rotation * 0.5f};
+    }
+
+    ANTON_MATH_CONSTEXPR f32* Dual_Quat::data() {
+        return real.data();
+    }
+
+    ANTON_MATH_CONSTEXPR f32 const* Dual_Quat::data() const {
+        return real.data();
+    }
+
+    ANTON_MATH_CONSTEXPR Dual_Quat operator-(Dual_Quat const& q) {
+        return {-q.real, -q.dual};
+    }
+
+    ANTON_MATH_CONSTEXPR Dual_Quat operator+(Dual_Quat const& q1, Dual_Quat const& q2) {
+        return {q1.real + q2.real, q1.dual + q2.dual};
+    }
+
+    ANTON_MATH_CONSTEXPR Dual_Quat operator-(Dual_Quat const& q1, Dual_Quat const& q2) {
+        return {q1.real - q2.real, q1.dual - q2.dual};
+    }
+
+    ANTON_MATH_CONSTEXPR Dual_Quat operator*(Dual_Quat const& q, f32 const a) {
+        return {q.real * a, q.dual * a};
+    }
+
+    ANTON_MATH_CONSTEXPR Dual_Quat operator*(Dual_Quat const& p, Dual_Quat const& q) {
+        // eps * eps = 0, hence (p.real + eps * p.dual) * (q.real + eps * q.dual) is
+        // p.real * q.real + eps * (p.real * q.dual + p.dual * q.real).
+        return {p.real * q.real, p.real * q.dual + p.dual * q.real};
+    }
+
+    ANTON_MATH_CONSTEXPR Dual_Quat normalize(Dual_Quat const& q) {
+        f32 const inv_length = 1.0f / length(q.real);
+        Quat const real = q.real * inv_length;
+        Quat const dual = q.dual * inv_length;
+        f32 const d = real.x * dual.x + real.y * dual.y + real.z * dual.z + real.w * dual.w;
+        return {real, dual - real * d};
+    }
+
+    ANTON_MATH_CONSTEXPR Dual_Quat conjugate(Dual_Quat const& q) {
+        return {conjugate(q.real), conjugate(q.dual)};
+    }
+
+    ANTON_MATH_CONSTEXPR Vec3 get_translation(Dual_Quat const& q) {
+        Quat const t = q.dual * conjugate(q.real);
+        return {2.0f * t.x, 2.0f * t.y, 2.0f * t.z};
+    }
+
+    ANTON_MATH_CONSTEXPR Vec3 transform_point(Dual_Quat const& q, Vec3 const& p) {
+        return q.real * p + get_translation(q);
+    }
+
+    ANTON_MATH_CONSTEXPR Vec3 transform_direction(Dual_Quat const& q, Vec3 const& d) {
+        return q.real * d;
+    }
+
+    ANTON_MATH_CONSTEXPR Dual_Quat to_dual_quat(TRS const& trs) {
+        return Dual_Quat::from_rotation_translation(trs.rotation, trs.translation);
+    }
+
+    ANTON_MATH_CONSTEXPR Dual_Quat to_dual_quat(Mat4 const& m) {
+        return to_dual_quat(decompose(m));
+    }
+
+    ANTON_MATH_CONSTEXPR TRS to_trs(Dual_Quat const& q) {
+        return {q.real, get_translation(q), Vec3{1.0f}};
+    }
+
+    ANTON_MATH_CONSTEXPR Mat4 to_mat4(Dual_Quat const& q) {
+        return compose(to_trs(q));
+    }
+
+    ANTON_MATH_CONSTEXPR void swap(Dual_Quat& q1, Dual_Quat& q2) {
+        swap(q1.real, q2.real);
+        swap(q1.dual, q2.dual);
+    }
+} // namespace anton::math
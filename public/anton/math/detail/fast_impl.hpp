@@ -0,0 +1,208 @@
+#pragma once
+
+#include <anton/math/fast.hpp>
+#include <anton/math/math.hpp>
+#include <anton/math/detail/libm.hpp>
+
+#if defined(__SSE__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#    define ANTON_MATH_FAST_RSQRT 1
+#    include <xmmintrin.h>
+#else
+#    define ANTON_MATH_FAST_RSQRT 0
+#endif
+
+namespace anton::math::fast {
+    namespace detail {
+        // Adding and subtracting 1.5 * 2^23 rounds an f32 with magnitude below 2^22 to
+        // the nearest integer. The least significant bit of the sum is the parity of
+        // the integer.
+        constexpr f32 round_magic = 12582912.0f;
+
+        // pi split into a part with 8 significant bits, which multiplied by small
+        // integers is exact, and the remainder.
+        constexpr f32 pi_hi = 3.140625f;
+        constexpr f32 pi_lo = 9.67653589793e-4f;
+
+        // sin(r) for r in [-pi/2, pi/2] with an absolute error of 6e-7.
+        [[nodiscard]] inline f32 sin_poly(f32 const r) {
+            f32 const z = r * r;
+            return r * (0.9999966159f + z * (-0.1666482838f + z * (8.306325227e-3f + z * -1.836365398e-4f)));
+        }
+
+        // atan(x) for x in [-1, 1] with an absolute error of 1.2e-5.
+        [[nodiscard]] inline f32 atan_poly(f32 const x) {
+            f32 const z = x * x;
+            return x * (0.9998663295f + z * (-0.3303047861f + z * (0.1801592971f + z * (-8.515635455e-2f + z * 2.084511595e-2f))));
+        }
+
+        // acos(x) for x in [0, 1] with an absolute error of 5e-6.
+        [[nodiscard]] inline f32 acos_positive(f32 const x) {
+            f32 const p = 1.570791534f + x * (-0.2142806109f + x * (8.563837726e-2f + x * (-3.761821642e-2f + x * 9.732968974e-3f)));
+            return ::sqrtf(1.0f - x) * p;
+        }
+    } // namespace detail
+
+    ANTON_MATH_FUNCTION f32 inv_sqrt(f32 const a) {
+#if ANTON_MATH_FAST_RSQRT
+        // The estimate has a relative error of at most 1.5 * 2^-12.
+        f32 const y = _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(a)));
+#else
+        // The estimate has a relative error of at most 3.5e-2. The first Newton step
+        // brings it to 1.8e-3.
+        f32 y = __builtin_bit_cast(f32, 0x5F375A86u - (__builtin_bit_cast(u32, a) >> 1));
+        y = y * (1.5f - 0.5f * a * y * y);
+#endif
+        return y * (1.5f - 0.5f * a * y * y);
+    }
+
+    ANTON_MATH_FUNCTION f32 sin(f32 const angle) {
+        // angle = r + q * pi, sin(angle) = (-1)^q * sin(r).
+        f32 const t = angle * 0.3183098862f + detail::round_magic;
+        f32 const q = t - detail::round_magic;
+        f32 const r = (angle - q * detail::pi_hi) - q * detail::pi_lo;
+        u32 const sign = __builtin_bit_cast(u32, t) << 31;
+        return __builtin_bit_cast(f32, __builtin_bit_cast(u32, detail::sin_poly(r)) ^ sign);
+    }
+
+    ANTON_MATH_FUNCTION f32 cos(f32 const angle) {
+        // angle = r + (k + 1/2) * pi, cos(angle) = -(-1)^k * sin(r).
+        f32 const t = (angle * 0.3183098862f - 0.5f) + detail::round_magic;
+        f32 const h = (t - detail::round_magic) + 0.5f;
+        f32 const r = (angle - h * detail::pi_hi) - h * detail::pi_lo;
+        u32 const sign = ~__builtin_bit_cast(u32, t) << 31;
+        return __builtin_bit_cast(f32, __builtin_bit_cast(u32, detail::sin_poly(r)) ^ sign);
+    }
+
+    ANTON_MATH_FUNCTION f32 asin(f32 const x) {
+        f32 const r = half_pi - detail::acos_positive(math::abs(x));
+        return x < 0.0f ? -r : r;
+    }
+
+    ANTON_MATH_FUNCTION f32 acos(f32 const x) {
+        f32 const r = detail::acos_positive(math::abs(x));
+        return x < 0.0f ? pi - r : r;
+    }
+
+    ANTON_MATH_FUNCTION f32 atan(f32 const x) {
+        // atan(x) = sign(x) * pi / 2 - atan(1 / x) for |x| > 1.
+        if(math::abs(x) <= 1.0f) {
+            return detail::atan_poly(x);
+        } else {
+            f32 const r = half_pi - detail::atan_poly(1.0f / math::abs(x));
+            return x < 0.0f ? -r : r;
+        }
+    }
+
+    ANTON_MATH_FUNCTION f32 atan2(f32 const y, f32 const x) {
+        f32 const abs_x = math::abs(x);
+        f32 const abs_y = math::abs(y);
+        f32 const n = math::min(abs_x, abs_y);
+        f32 const d = math::max(abs_x, abs_y);
+        f32 r = d > 0.0f ? detail::atan_poly(n / d) : 0.0f;
+        if(abs_y > abs_x) {
+            r = half_pi - r;
+        }
+
+        if(x < 0.0f) {
+            r = pi - r;
+        }
+
+        return y < 0.0f ? -r : r;
+    }
+
+    ANTON_MATH_FUNCTION f32 exp2(f32 const n) {
+        // 2^n = 2^i * 2^f where i = floor(n) and f in [0, 1]. Clamping n to -126.5 makes
+        // i at least -127 for which the exponent field of 2^i is 0 and the result is 0.
+        f32 const c = math::min(math::max(n, -126.5f), 128.0f);
+        f32 const i = ((c - 0.5f) + detail::round_magic) - detail::round_magic;
+        f32 const f = c - i;
+        f32 const p = 1.000002593f + f * (0.6930038344f + f * (0.2414427571f + f * (5.201146030e-2f + f * 1.353416806e-2f)));
+        f32 const scale = __builtin_bit_cast(f32, static_cast<u32>(static_cast<i32>(i) + 127) << 23);
+        return p * scale;
+    }
+
+    ANTON_MATH_FUNCTION f32 exp(f32 const n) {
+        return fast::exp2(n * 1.442695041f);
+    }
+
+    ANTON_MATH_FUNCTION f32 log2(f32 const v) {
+        // v = 2^e * m where m is in [sqrt(2) / 2, sqrt(2)). Subtracting the bits of
+        // sqrt(2) / 2 before extracting the exponent selects that interval.
+        i32 const bits = __builtin_bit_cast(i32, v);
+        i32 const e = (bits - 0x3F3504F3) >> 23;
+        f32 const t = __builtin_bit_cast(f32, bits - static_cast<i32>(static_cast<u32>(e) << 23)) - 1.0f;
+        f32 const p =
+            1.442713481f + t * (-0.7211318590f + t * (0.4793480175f + t * (-0.3674899648f + t * (0.3221548171f + t * -0.2065918238f))));
+        return static_cast<f32>(e) + t * p;
+    }
+
+    ANTON_MATH_FUNCTION f32 log(f32 const v) {
+        return fast::log2(v) * 0.6931471806f;
+    }
+
+    ANTON_MATH_FUNCTION Vec2 normalize(Vec2 const vec, f32 const tolerance) {
+        if(!is_almost_zero(vec, tolerance)) {
+            return vec * fast::inv_sqrt(length_squared(vec));
+        } else {
+            return Vec2{};
+        }
+    }
+
+    ANTON_MATH_FUNCTION Vec3 normalize(Vec3 const vec, f32 const tolerance) {
+        if(!is_almost_zero(vec, tolerance)) {
+            return vec * fast::inv_sqrt(length_squared(vec));
+        } else {
+            return Vec3{};
+        }
+    }
+
+    ANTON_MATH_FUNCTION Vec4 normalize(Vec4 const vec, f32 const tolerance) {
+        if(!is_almost_zero(vec, tolerance)) {
+            return vec * fast::inv_sqrt(length_squared(vec));
+        } else {
+            return Vec4{};
+        }
+    }
+
+    ANTON_MATH_FUNCTION Quat normalize(Quat const& q) {
+        return q * fast::inv_sqrt(length_squared(q));
+    }
+
+    ANTON_MATH_FUNCTION Quat orient_towards(Vec3 const start, Vec3 const target) {
+        // The rotation by twice the angle between start and the half-way vector h is
+        // {cross(start, h), dot(start, h)}. Scaling h by 2 * cos(angle / 2) yields
+        // {cross(start, target), 1 + dot(start, target)} which only needs normalizing.
+        Vec3 const axis = cross(start, target);
+        f32 const w = 1.0f + dot(start, target);
+        Quat const q{axis.x, axis.y, axis.z, w};
+        f32 const length_sq = length_squared(q);
+        if(length_sq > 0.000001f) {
+            return q * fast::inv_sqrt(length_sq);
+        } else {
+            return Quat::identity;
+        }
+    }
+
+    ANTON_MATH_FUNCTION Quat slerp(Quat const& a, Quat const& b, f32 const t) {
+        Vec4 const v0{a.x, a.y, a.z, a.w};
+        Vec4 v1{b.x, b.y, b.z, b.w};
+        f32 angle_cos = dot(v0, v1);
+
+        if(angle_cos < 0.0f) {
+            v1 = -v1;
+            angle_cos = -angle_cos;
+        }
+
+        if(angle_cos < 0.9999f) {
+            f32 const angle = fast::acos(angle_cos);
+            f32 const inv_sin_angle = 1.0f / fast::sin(angle);
+            f32 const f0 = inv_sin_angle * fast::sin((1.0f - t) * angle);
+            f32 const f1 = inv_sin_angle * fast::sin(t * angle);
+            Vec4 const r = f0 * v0 + f1 * v1;
+            return {r.x, r.y, r.z, r.w};
+        } else {
+            Vec4 const r = (1.0f - t) * v0 + t * v1;
+            return {r.x, r.y, r.z, r.w};
+        }
+    }
+} // namespace anton::math::fast
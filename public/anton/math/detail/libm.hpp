@@ -0,0 +1,36 @@
+#pragma once
+
+// Forward declarations from math.h
+
+extern "C" {
+    #if defined(_WIN32) || defined(_WIN64)
+    #    define ANTON_NOEXCEPT
+    #    define ANTON_CRT_IMPORT __declspec(dllimport)
+    #else
+    #    define ANTON_NOEXCEPT noexcept
+    #    define ANTON_CRT_IMPORT
+    #endif
+
+    ANTON_CRT_IMPORT float powf(float, float) ANTON_NOEXCEPT;
+    ANTON_CRT_IMPORT float sqrtf(float) ANTON_NOEXCEPT;
+    ANTON_CRT_IMPORT float cbrtf(float) ANTON_NOEXCEPT;
+    ANTON_CRT_IMPORT float fmodf(float, float) ANTON_NOEXCEPT;
+    ANTON_CRT_IMPORT float roundf(float) ANTON_NOEXCEPT;
+    ANTON_CRT_IMPORT float floorf(float) ANTON_NOEXCEPT;
+    ANTON_CRT_IMPORT float ceilf(float) ANTON_NOEXCEPT;
+    ANTON_CRT_IMPORT float modff(float, float*) ANTON_NOEXCEPT;
+    ANTON_CRT_IMPORT float sinf(float) ANTON_NOEXCEPT;
+    ANTON_CRT_IMPORT float cosf(float) ANTON_NOEXCEPT;
+    ANTON_CRT_IMPORT float tanf(float) ANTON_NOEXCEPT;
+    ANTON_CRT_IMPORT float asinf(float) ANTON_NOEXCEPT;
+    ANTON_CRT_IMPORT float acosf(float) ANTON_NOEXCEPT;
+    ANTON_CRT_IMPORT float atanf(float) ANTON_NOEXCEPT;
+    ANTON_CRT_IMPORT float atan2f(float, float) ANTON_NOEXCEPT;
+    ANTON_CRT_IMPORT float expf(float) ANTON_NOEXCEPT;
+    ANTON_CRT_IMPORT float logf(float) ANTON_NOEXCEPT;
+    ANTON_CRT_IMPORT float log10f(float) ANTON_NOEXCEPT;
+    ANTON_CRT_IMPORT float log2f(float) ANTON_NOEXCEPT;
+
+    #undef ANTON_CRT_IMPORT
+    #undef ANTON_NOEXCEPT
+}
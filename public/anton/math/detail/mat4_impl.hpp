@@ -0,0 +1,301 @@
+#pragma once
+
+#include <anton/math/mat4.hpp>
+#include <anton/math/math.hpp>
+#include <anton/math/detail/simd.hpp>
+#include <anton/math/detail/utility.hpp>
+
+namespace anton::math {
+    ANTON_MATH_CONSTEXPR Mat4::Mat4(f32 const* const p): columns{Vec4{p}, Vec4{p + 4}, Vec4{p + 8}, Vec4{p + 12}} {}
+
+    ANTON_MATH_CONSTEXPR Vec4& Mat4::operator[](i32 const column) {
+        return columns[column];
+    }
+
+    ANTON_MATH_CONSTEXPR Vec4 const& Mat4::operator[](i32 const column) const {
+        return columns[column];
+    }
+
+    ANTON_MATH_CONSTEXPR f32& Mat4::operator()(i32 const column, i32 const row) {
+        return columns[column][row];
+    }
+
+    ANTON_MATH_CONSTEXPR f32 const& Mat4::operator()(i32 const column, i32 const row) const {
+        return columns[column][row];
+    }
+
+    ANTON_MATH_FUNCTION f32* Mat4::data() {
+        return (f32*)columns;
+    }
+
+    ANTON_MATH_FUNCTION f32 const* Mat4::data() const {
+        return (f32 const*)columns;
+    }
+
+    ANTON_MATH_CONSTEXPR Mat4& Mat4::operator+=(f32 const a) {
+        columns[0] += a;
+        columns[1] += a;
+        columns[2] += a;
+        columns[3] += a;
+        return *this;
+    }
+
+    ANTON_MATH_CONSTEXPR Mat4& Mat4::operator-=(f32 const a) {
+        columns[0] -= a;
+        columns[1] -= a;
+        columns[2] -= a;
+        columns[3] -= a;
+        return *this;
+    }
+
+    ANTON_MATH_CONSTEXPR Mat4& Mat4::operator*=(f32 const a) {
+        columns[0] *= a;
+        columns[1] *= a;
+        columns[2] *= a;
+        columns[3] *= a;
+        return *this;
+    }
+
+    ANTON_MATH_CONSTEXPR Mat4& Mat4::operator/=(f32 const a) {
+        columns[0] /= a;
+        columns[1] /= a;
+        columns[2] /= a;
+        columns[3] /= a;
+        return *this;
+    }
+
+    ANTON_MATH_CONSTEXPR Mat4& Mat4::operator+=(Mat4 const& m) {
+        columns[0] += m.columns[0];
+        columns[1] += m.columns[1];
+        columns[2] += m.columns[2];
+        columns[3] += m.columns[3];
+        return *this;
+    }
+
+    ANTON_MATH_CONSTEXPR Mat4& Mat4::operator-=(Mat4 const& m) {
+        columns[0] -= m.columns[0];
+        columns[1] -= m.columns[1];
+        columns[2] -= m.columns[2];
+        columns[3] -= m.columns[3];
+        return *this;
+    }
+
+    ANTON_MATH_CONSTEXPR Mat4& Mat4::operator*=(Mat4 const& rhs) {
+#if ANTON_MATH_SSE2
+        if(!ANTON_MATH_CONSTANT_EVALUATED()) {
+            // Each column of rhs is read before the corresponding column of
+            // this is written, therefore rhs may alias this.
+#    if ANTON_MATH_AVX
+            // Computes 2 columns at a time with lhs broadcast to both lanes.
+            __m256 const c0 = _mm256_broadcast_ps((__m128 const*)columns[0].data());
+            __m256 const c1 = _mm256_broadcast_ps((__m128 const*)columns[1].data());
+            __m256 const c2 = _mm256_broadcast_ps((__m128 const*)columns[2].data());
+            __m256 const c3 = _mm256_broadcast_ps((__m128 const*)columns[3].data());
+            for(i32 i = 0; i < 4; i += 2) {
+                __m256 const r = _mm256_loadu_ps(rhs.columns[i].data());
+                __m256 const r0 = _mm256_add_ps(_mm256_mul_ps(c0, _mm256_shuffle_ps(r, r, _MM_SHUFFLE(0, 0, 0, 0))),
+                                                _mm256_mul_ps(c1, _mm256_shuffle_ps(r, r, _MM_SHUFFLE(1, 1, 1, 1))));
+                __m256 const r1 = _mm256_add_ps(_mm256_mul_ps(c2, _mm256_shuffle_ps(r, r, _MM_SHUFFLE(2, 2, 2, 2))),
+                                                _mm256_mul_ps(c3, _mm256_shuffle_ps(r, r, _MM_SHUFFLE(3, 3, 3, 3))));
+                _mm256_storeu_ps(columns[i].data(), _mm256_add_ps(r0, r1));
+            }
+#    else
+            __m128 const c0 = detail::load(columns[0]);
+            __m128 const c1 = detail::load(columns[1]);
+            __m128 const c2 = detail::load(columns[2]);
+            __m128 const c3 = detail::load(columns[3]);
+            for(i32 i = 0; i < 4; ++i) {
+                _mm_store_ps(columns[i].data(), detail::transform(c0, c1, c2, c3, detail::load(rhs.columns[i])));
+            }
+#    endif
+            return *this;
+        }
+#endif
+        Mat4 const lhs = *this;
+        for (i32 i = 0; i < 4; ++i) {
+            // Copy the column in case rhs aliases this.
+            Vec4 const r = rhs[i];
+            (*this)[i][0] = r[0] * lhs[0][0] + r[1] * lhs[1][0] + r[2] * lhs[2][0] + r[3] * lhs[3][0];
+            (*this)[i][1] = r[0] * lhs[0][1] + r[1] * lhs[1][1] + r[2] * lhs[2][1] + r[3] * lhs[3][1];
+            (*this)[i][2] = r[0] * lhs[0][2] + r[1] * lhs[1][2] + r[2] * lhs[2][2] + r[3] * lhs[3][2];
+            (*this)[i][3] = r[0] * lhs[0][3] + r[1] * lhs[1][3] + r[2] * lhs[2][3] + r[3] * lhs[3][3];
+        }
+        return *this;
+    }
+
+    ANTON_MATH_CONSTEXPR Mat4 operator+(Mat4 m, f32 const a) {
+        m += a;
+        return m;
+    }
+
+    ANTON_MATH_CONSTEXPR Mat4 operator-(Mat4 m, f32 const a) {
+        m -= a;
+        return m;
+    }
+
+    ANTON_MATH_CONSTEXPR Mat4 operator*(Mat4 m, f32 const a) {
+        m *= a;
+        return m;
+    }
+
+    ANTON_MATH_CONSTEXPR Mat4 operator/(Mat4 m, f32 const a) {
+        m /= a;
+        return m;
+    }
+
+    ANTON_MATH_CONSTEXPR Mat4 operator+(Mat4 lhs, Mat4 const& rhs) {
+        lhs += rhs;
+        return lhs;
+    }
+
+    ANTON_MATH_CONSTEXPR Mat4 operator-(Mat4 lhs, Mat4 const& rhs) {
+        lhs -= rhs;
+        return lhs;
+    }
+
+    ANTON_MATH_CONSTEXPR Mat4 operator*(Mat4 lhs, Mat4 const& rhs) {
+        lhs *= rhs;
+        return lhs;
+    }
+
+    ANTON_MATH_CONSTEXPR Vec4 operator*(Mat4 const& lhs, Vec4 const& rhs) {
+#if ANTON_MATH_SSE2
+        if(!ANTON_MATH_CONSTANT_EVALUATED()) {
+            return detail::store(detail::transform(detail::load(lhs[0]), detail::load(lhs[1]), detail::load(lhs[2]), detail::load(lhs[3]), detail::load(rhs)));
+        }
+#endif
+        Vec4 r;
+        r[0] = rhs[0] * lhs[0][0] + rhs[1] * lhs[1][0] + rhs[2] * lhs[2][0] + rhs[3] * lhs[3][0];
+        r[1] = rhs[0] * lhs[0][1] + rhs[1] * lhs[1][1] + rhs[2] * lhs[2][1] + rhs[3] * lhs[3][1];
+        r[2] = rhs[0] * lhs[0][2] + rhs[1] * lhs[1][2] + rhs[2] * lhs[2][2] + rhs[3] * lhs[3][2];
+        r[3] = rhs[0] * lhs[0][3] + rhs[1] * lhs[1][3] + rhs[2] * lhs[2][3] + rhs[3] * lhs[3][3];
+        return r;
+    }
+
+    ANTON_MATH_CONSTEXPR Mat4 transpose(Mat4 mat) {
+        detail::swap(mat[0][1], mat[1][0]);
+        detail::swap(mat[0][2], mat[2][0]);
+        detail::swap(mat[0][3], mat[3][0]);
+        detail::swap(mat[1][2], mat[2][1]);
+        detail::swap(mat[1][3], mat[3][1]);
+        detail::swap(mat[2][3], mat[3][2]);
+        return mat;
+    }
+
+    namespace detail {
+        ANTON_MATH_CONSTEXPR f32 determinant3x3(f32 m00, f32 m01, f32 m02, f32 m10, f32 m11, f32 m12, f32 m20, f32 m21, f32 m22) {
+            return m00 * m11 * m22 + m01 * m12 * m20 + m02 * m10 * m21 - m02 * m11 * m20 - m01 * m10 * m22 - m00 * m12 * m21;
+        }
+    } // namespace detail
+
+    ANTON_MATH_CONSTEXPR f32 determinant(Mat4 const& m) {
+        f32 det0 = detail::determinant3x3(m[1][1], m[1][2], m[1][3], m[2][1], m[2][2], m[2][3], m[3][1], m[3][2], m[3][3]);
+        f32 det1 = detail::determinant3x3(m[1][0], m[1][2], m[1][3], m[2][0], m[2][2], m[2][3], m[3][0], m[3][2], m[3][3]);
+        f32 det2 = detail::determinant3x3(m[1][0], m[1][1], m[1][3], m[2][0], m[2][1], m[2][3], m[3][0], m[3][1], m[3][3]);
+        f32 det3 = detail::determinant3x3(m[1][0], m[1][1], m[1][2], m[2][0], m[2][1], m[2][2], m[3][0], m[3][1], m[3][2]);
+        return m[0][0] * det0 - m[0][1] * det1 + m[0][2] * det2 - m[0][3] * det3;
+    }
+
+    ANTON_MATH_CONSTEXPR Mat4 adjugate(Mat4 const& m) {
+        f32 m00 = detail::determinant3x3(m[1][1], m[1][2], m[1][3], m[2][1], m[2][2], m[2][3], m[3][1], m[3][2], m[3][3]);
+        f32 m01 = detail::determinant3x3(m[1][0], m[1][2], m[1][3], m[2][0], m[2][2], m[2][3], m[3][0], m[3][2], m[3][3]);
+        f32 m02 = detail::determinant3x3(m[1][0], m[1][1], m[1][3], m[2][0], m[2][1], m[2][3], m[3][0], m[3][1], m[3][3]);
+        f32 m03 = detail::determinant3x3(m[1][0], m[1][1], m[1][2], m[2][0], m[2][1], m[2][2], m[3][0], m[3][1], m[3][2]);
+
+        f32 m10 = detail::determinant3x3(m[0][1], m[0][2], m[0][3], m[2][1], m[2][2], m[2][3], m[3][1], m[3][2], m[3][3]);
+        f32 m11 = detail::determinant3x3(m[0][0], m[0][2], m[0][3], m[2][0], m[2][2], m[2][3], m[3][0], m[3][2], m[3][3]);
+        f32 m12 = detail::determinant3x3(m[0][0], m[0][1], m[0][3], m[2][0], m[2][1], m[2][3], m[3][0], m[3][1], m[3][3]);
+        f32 m13 = detail::determinant3x3(m[0][0], m[0][1], m[0][2], m[2][0], m[2][1], m[2][2], m[3][0], m[3][1], m[3][2]);
+
+        f32 m20 = detail::determinant3x3(m[0][1], m[0][2], m[0][3], m[1][1], m[1][2], m[1][3], m[3][1], m[3][2], m[3][3]);
+        f32 m21 = detail::determinant3x3(m[0][0], m[0][2], m[0][3], m[1][0], m[1][2], m[1][3], m[3][0], m[3][2], m[3][3]);
+        f32 m22 = detail::determinant3x3(m[0][0], m[0][1], m[0][3], m[1][0], m[1][1], m[1][3], m[3][0], m[3][1], m[3][3]);
+        f32 m23 = detail::determinant3x3(m[0][0], m[0][1], m[0][2], m[1][0], m[1][1], m[1][2], m[3][0], m[3][1], m[3][2]);
+
+        f32 m30 = detail::determinant3x3(m[0][1], m[0][2], m[0][3], m[1][1], m[1][2], m[1][3], m[2][1], m[2][2], m[2][3]);
+        f32 m31 = detail::determinant3x3(m[0][0], m[0][2], m[0][3], m[1][0], m[1][2], m[1][3], m[2][0], m[2][2], m[2][3]);
+        f32 m32 = detail::determinant3x3(m[0][0], m[0][1], m[0][3], m[1][0], m[1][1], m[1][3], m[2][0], m[2][1], m[2][3]);
+        f32 m33 = detail::determinant3x3(m[0][0], m[0][1], m[0][2], m[1][0], m[1][1], m[1][2], m[2][0], m[2][1], m[2][2]);
+        return Mat4(
+            {m00, -m10, m20, -m30}, 
+            {-m01, m11, -m21, m31}, 
+            {m02, -m12, m22, -m32}, 
+            {-m03, m13, -m23, m33});
+    }
+
+    ANTON_MATH_CONSTEXPR Mat4 inverse(Mat4 const& m) {
+        // Laplace expansion by 2x2 minors. The 6 minors of the first two columns (s)
+        // and the 6 minors of the last two columns (c) are shared by all cofactors
+        // and by the determinant.
+#if ANTON_MATH_SSE2
+        if(!ANTON_MATH_CONSTANT_EVALUATED()) {
+            __m128 const c0 = detail::load(m[0]);
+            __m128 const c1 = detail::load(m[1]);
+            __m128 const c2 = detail::load(m[2]);
+            __m128 const c3 = detail::load(m[3]);
+            // (s0, s1, s2, s3), (c0, c1, c2, c3) and (s4, s5, c4, c5).
+            __m128 const s03 = _mm_sub_ps(_mm_mul_ps(_mm_shuffle_ps(c0, c0, _MM_SHUFFLE(1, 0, 0, 0)), _mm_shuffle_ps(c1, c1, _MM_SHUFFLE(2, 3, 2, 1))),
+                                          _mm_mul_ps(_mm_shuffle_ps(c1, c1, _MM_SHUFFLE(1, 0, 0, 0)), _mm_shuffle_ps(c0, c0, _MM_SHUFFLE(2, 3, 2, 1))));
+            __m128 const c03 = _mm_sub_ps(_mm_mul_ps(_mm_shuffle_ps(c2, c2, _MM_SHUFFLE(1, 0, 0, 0)), _mm_shuffle_ps(c3, c3, _MM_SHUFFLE(2, 3, 2, 1))),
+                                          _mm_mul_ps(_mm_shuffle_ps(c3, c3, _MM_SHUFFLE(1, 0, 0, 0)), _mm_shuffle_ps(c2, c2, _MM_SHUFFLE(2, 3, 2, 1))));
+            __m128 const sc45 = _mm_sub_ps(_mm_mul_ps(_mm_shuffle_ps(c0, c2, _MM_SHUFFLE(2, 1, 2, 1)), _mm_shuffle_ps(c1, c3, _MM_SHUFFLE(3, 3, 3, 3))),
+                                           _mm_mul_ps(_mm_shuffle_ps(c1, c3, _MM_SHUFFLE(2, 1, 2, 1)), _mm_shuffle_ps(c0, c2, _MM_SHUFFLE(3, 3, 3, 3))));
+            // kn = (cn, cn, sn, sn)
+            __m128 const k0 = _mm_shuffle_ps(c03, s03, _MM_SHUFFLE(0, 0, 0, 0));
+            __m128 const k1 = _mm_shuffle_ps(c03, s03, _MM_SHUFFLE(1, 1, 1, 1));
+            __m128 const k2 = _mm_shuffle_ps(c03, s03, _MM_SHUFFLE(2, 2, 2, 2));
+            __m128 const k3 = _mm_shuffle_ps(c03, s03, _MM_SHUFFLE(3, 3, 3, 3));
+            __m128 const k4 = _mm_shuffle_ps(sc45, sc45, _MM_SHUFFLE(0, 0, 2, 2));
+            __m128 const k5 = _mm_shuffle_ps(sc45, sc45, _MM_SHUFFLE(1, 1, 3, 3));
+            // rn = (m[1][n], m[0][n], m[3][n], m[2][n])
+            __m128 const t0 = _mm_unpacklo_ps(c1, c0);
+            __m128 const t1 = _mm_unpacklo_ps(c3, c2);
+            __m128 const t2 = _mm_unpackhi_ps(c1, c0);
+            __m128 const t3 = _mm_unpackhi_ps(c3, c2);
+            __m128 const r0 = _mm_movelh_ps(t0, t1);
+            __m128 const r1 = _mm_movehl_ps(t1, t0);
+            __m128 const r2 = _mm_movelh_ps(t2, t3);
+            __m128 const r3 = _mm_movehl_ps(t3, t2);
+            // Columns of the adjugate with the signs of every other row flipped.
+            __m128 const a0 = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(r1, k5), _mm_mul_ps(r2, k4)), _mm_mul_ps(r3, k3));
+            __m128 const a1 = _mm_sub_ps(_mm_sub_ps(_mm_mul_ps(r2, k2), _mm_mul_ps(r0, k5)), _mm_mul_ps(r3, k1));
+            __m128 const a2 = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(r0, k4), _mm_mul_ps(r1, k2)), _mm_mul_ps(r3, k0));
+            __m128 const a3 = _mm_sub_ps(_mm_sub_ps(_mm_mul_ps(r1, k1), _mm_mul_ps(r0, k3)), _mm_mul_ps(r2, k0));
+            __m128 const first_row = _mm_movelh_ps(_mm_unpacklo_ps(a0, a1), _mm_unpacklo_ps(a2, a3));
+            f32 const det = detail::horizontal_sum(_mm_mul_ps(first_row, c0));
+            __m128 const scale = _mm_mul_ps(_mm_set_ps(-1.0f, 1.0f, -1.0f, 1.0f), _mm_set1_ps(1.0f / det));
+            return Mat4(detail::store(_mm_mul_ps(a0, scale)), detail::store(_mm_mul_ps(a1, scale)), detail::store(_mm_mul_ps(a2, scale)),
+                        detail::store(_mm_mul_ps(a3, scale)));
+        }
+#endif
+        f32 const s0 = m[0][0] * m[1][1] - m[1][0] * m[0][1];
+        f32 const s1 = m[0][0] * m[1][2] - m[1][0] * m[0][2];
+        f32 const s2 = m[0][0] * m[1][3] - m[1][0] * m[0][3];
+        f32 const s3 = m[0][1] * m[1][2] - m[1][1] * m[0][2];
+        f32 const s4 = m[0][1] * m[1][3] - m[1][1] * m[0][3];
+        f32 const s5 = m[0][2] * m[1][3] - m[1][2] * m[0][3];
+        f32 const c0 = m[2][0] * m[3][1] - m[3][0] * m[2][1];
+        f32 const c1 = m[2][0] * m[3][2] - m[3][0] * m[2][2];
+        f32 const c2 = m[2][0] * m[3][3] - m[3][0] * m[2][3];
+        f32 const c3 = m[2][1] * m[3][2] - m[3][1] * m[2][2];
+        f32 const c4 = m[2][1] * m[3][3] - m[3][1] * m[2][3];
+        f32 const c5 = m[2][2] * m[3][3] - m[3][2] * m[2][3];
+        f32 const det = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+        f32 const inv_det = 1.0f / det;
+        return Mat4({(m[1][1] * c5 - m[1][2] * c4 + m[1][3] * c3) * inv_det, (-m[0][1] * c5 + m[0][2] * c4 - m[0][3] * c3) * inv_det,
+                     (m[3][1] * s5 - m[3][2] * s4 + m[3][3] * s3) * inv_det, (-m[2][1] * s5 + m[2][2] * s4 - m[2][3] * s3) * inv_det},
+                    {(-m[1][0] * c5 + m[1][2] * c2 - m[1][3] * c1) * inv_det, (m[0][0] * c5 - m[0][2] * c2 + m[0][3] * c1) * inv_det,
+                     (-m[3][0] * s5 + m[3][2] * s2 - m[3][3] * s1) * inv_det, (m[2][0] * s5 - m[2][2] * s2 + m[2][3] * s1) * inv_det},
+                    {(m[1][0] * c4 - m[1][1] * c2 + m[1][3] * c0) * inv_det, (-m[0][0] * c4 + m[0][1] * c2 - m[0][3] * c0) * inv_det,
+                     (m[3][0] * s4 - m[3][1] * s2 + m[3][3] * s0) * inv_det, (-m[2][0] * s4 + m[2][1] * s2 - m[2][3] * s0) * inv_det},
+                    {(-m[1][0] * c3 + m[1][1] * c1 - m[1][2] * c0) * inv_det, (m[0][0] * c3 - m[0][1] * c1 + m[0][2] * c0) * inv_det,
+                     (-m[3][0] * s3 + m[3][1] * s1 - m[3][2] * s0) * inv_det, (m[2][0] * s3 - m[2][1] * s1 + m[2][2] * s0) * inv_det});
+    }
+
+    ANTON_MATH_CONSTEXPR void swap(Mat4& m1, Mat4& m2) {
+        swap(m1[0], m2[0]);
+        swap(m1[1], m2[1]);
+        swap(m1[2], m2[2]);
+        swap(m1[3], m2[3]);
+    }
+} // namespace anton::math
@@ -0,0 +1,266 @@
+#pragma once
+
+#include <anton/math/math.hpp>
+#include <anton/math/detail/constexpr_math.hpp>
+#include <anton/math/detail/libm.hpp>
+
+namespace anton::math {
+    ANTON_MATH_CONSTEXPR bool is_nan(f32 v) {
+        // nan does not compare equal to anything, including itself.
+        return v != v;
+    }
+
+    ANTON_MATH_CONSTEXPR f32 pow(f32 const base, f32 const exp) {
+        if(ANTON_MATH_CONSTANT_EVALUATED()) {
+            return static_cast<f32>(detail::constexpr_pow(base, exp));
+        }
+        return ::powf(base, exp);
+    }
+
+    ANTON_MATH_CONSTEXPR f32 sqrt(f32 const a) {
+        if(ANTON_MATH_CONSTANT_EVALUATED()) {
+            return detail::constexpr_sqrtf(a);
+        }
+        return ::sqrtf(a);
+    }
+
+    ANTON_MATH_CONSTEXPR f32 cbrt(f32 const a) {
+        if(ANTON_MATH_CONSTANT_EVALUATED()) {
+            return static_cast<f32>(detail::constexpr_cbrt(a));
+        }
+        return ::cbrtf(a);
+    }
+
+    ANTON_MATH_CONSTEXPR f32 inv_sqrt(f32 const a) {
+        if(ANTON_MATH_CONSTANT_EVALUATED()) {
+            return static_cast<f32>(detail::constexpr_inv_sqrt(a));
+        }
+        return 1 / sqrt(a);
+    }
+
+    ANTON_MATH_CONSTEXPR f32 sign(f32 const a) {
+        return static_cast<f32>((a > 0.0f) - (a < 0.0f));
+    }
+
+    ANTON_MATH_CONSTEXPR f32 sin(f32 const angle) {
+        if(ANTON_MATH_CONSTANT_EVALUATED()) {
+            return static_cast<f32>(detail::constexpr_sin(angle));
+        }
+        return ::sinf(angle);
+    }
+
+    ANTON_MATH_CONSTEXPR f32 asin(f32 const angle) {
+        if(ANTON_MATH_CONSTANT_EVALUATED()) {
+            return static_cast<f32>(detail::constexpr_asin(angle));
+        }
+        return ::asinf(angle);
+    }
+
+    ANTON_MATH_CONSTEXPR f32 cos(f32 const angle) {
+        if(ANTON_MATH_CONSTANT_EVALUATED()) {
+            return static_cast<f32>(detail::constexpr_cos(angle));
+        }
+        return ::cosf(angle);
+    }
+
+    ANTON_MATH_CONSTEXPR f32 acos(f32 const angle) {
+        if(ANTON_MATH_CONSTANT_EVALUATED()) {
+            return static_cast<f32>(detail::constexpr_acos(angle));
+        }
+        return ::acosf(angle);
+    }
+
+    ANTON_MATH_CONSTEXPR Sin_Cos sincos(f32 const angle) {
+        if(ANTON_MATH_CONSTANT_EVALUATED()) {
+            return {static_cast<f32>(detail::constexpr_sin(angle)), static_cast<f32>(detail::constexpr_cos(angle))};
+        }
+
+        // Zeros keep their sign in sin. Large and non-finite angles.
+        if(angle == 0.0f) {
+            return {angle, 1.0f};
+        } else if(!(math::abs(angle) < 65536.0f)) {
+            return {::sinf(angle), ::cosf(angle)};
+        }
+
+        // Reduce the angle to r in [-pi/4, pi/4] such that angle = r + q * pi / 2.
+        // The reduction is performed in f64 with pi / 2 split into 2 parts, the first
+        // one having 37 significant bits so that q * pi / 2 is exact in it. Adding
+        // and subtracting 1.5 * 2^52 rounds to the nearest integer.
+        f64 const rounding = 6755399441055744.0;
+        f64 const q = ((f64)angle * 0.636619772367581343 + rounding) - rounding;
+        f32 const r = (f32)(((f64)angle - q * 1.5707963267923333) - q * 2.563344151594519e-12);
+        f32 const z = r * r;
+        f32 const s = r + r * z * (-1.6666654611e-1f + z * (8.3321608736e-3f + z * -1.9515295891e-4f));
+        f32 const c = 1.0f - 0.5f * z + z * z * (4.166664568298827e-2f + z * (-1.388731625493765e-3f + z * 2.443315711809948e-5f));
+        switch(static_cast<i32>(q) & 3) {
+            case 0:
+                return {s, c};
+            case 1:
+                return {c, -s};
+            case 2:
+                return {-s, -c};
+            default:
+                return {-c, s};
+        }
+    }
+
+    ANTON_MATH_CONSTEXPR f32 tan(f32 const angle) {
+        if(ANTON_MATH_CONSTANT_EVALUATED()) {
+            return static_cast<f32>(detail::constexpr_tan(angle));
+        }
+        return ::tanf(angle);
+    }
+
+    ANTON_MATH_CONSTEXPR f32 atan(f32 const angle) {
+        if(ANTON_MATH_CONSTANT_EVALUATED()) {
+            return static_cast<f32>(detail::constexpr_atan(angle));
+        }
+        return ::atanf(angle);
+    }
+
+    ANTON_MATH_CONSTEXPR f32 atan2(f32 const y, f32 const x) {
+        if(ANTON_MATH_CONSTANT_EVALUATED()) {
+            return static_cast<f32>(detail::constexpr_atan2(y, x));
+        }
+        return ::atan2f(y, x);
+    }
+
+    // exp
+    // Calculate e^n
+    //
+    ANTON_MATH_CONSTEXPR f32 exp(f32 const n) {
+        if(ANTON_MATH_CONSTANT_EVALUATED()) {
+            return static_cast<f32>(detail::constexpr_exp(n));
+        }
+        return ::expf(n);
+    }
+
+    // log
+    // Compute natural logarithm (base-e).
+    //
+    ANTON_MATH_CONSTEXPR f32 log(f32 const v) {
+        if(ANTON_MATH_CONSTANT_EVALUATED()) {
+            return static_cast<f32>(detail::constexpr_log(v));
+        }
+        return ::logf(v);
+    }
+
+    // log10
+    // Compute base-10 logarithm.
+    //
+    ANTON_MATH_CONSTEXPR f32 log10(f32 const v) {
+        if(ANTON_MATH_CONSTANT_EVALUATED()) {
+            return static_cast<f32>(detail::constexpr_log10(v));
+        }
+        return ::log10f(v);
+    }
+
+    // log2
+    // Compute base-2 logarithm.
+    //
+    ANTON_MATH_CONSTEXPR f32 log2(f32 const v) {
+        if(ANTON_MATH_CONSTANT_EVALUATED()) {
+            return static_cast<f32>(detail::constexpr_log2(v));
+        }
+        return ::log2f(v);
+    }
+
+    // ilog2
+    // Computes the floor of logarithm base 2 of v.
+    //
+    ANTON_MATH_FUNCTION u32 ilog2(u32 const v) {
+        return 32 - clz(v) - 1;
+    }
+
+    ANTON_MATH_FUNCTION u64 ilog2(u64 const v) {
+        return 64 - clz(v) - 1;
+    }
+
+    // ilog10
+    // Computes the floor of logarithm base 10 of v.
+    // Returns 0 for ilog10(0).
+    //
+    ANTON_MATH_FUNCTION u64 ilog10(u64 const v) {
+        u64 powers_of_10[] = {1ULL,
+                              10ULL,
+                              100ULL,
+                              1000ULL,
+                              10000ULL,
+                              100000ULL,
+                              1000000ULL,
+                              10000000ULL,
+                              100000000ULL,
+                              1000000000ULL,
+                              10000000000ULL,
+                              100000000000ULL,
+                              1000000000000ULL,
+                              10000000000000ULL,
+                              100000000000000ULL,
+                              1000000000000000ULL,
+                              10000000000000000ULL,
+                              100000000000000000ULL,
+                              1000000000000000000ULL,
+                              10000000000000000000ULL};
+        u64 const temp = (ilog2(v) + 1) * 1233 >> 12;
+        return temp - (v < powers_of_10[temp]);
+    }
+
+    // mod
+    // Computes the floating point remainder of the operation x/y.
+    // The result has the same sign as x.
+    //
+    ANTON_MATH_FUNCTION f32 mod(f32 const x, f32 const y) {
+        return fmodf(x, y);
+    }
+
+    ANTON_MATH_FUNCTION f32 round(f32 const x) {
+        return ::roundf(x);
+    }
+
+    ANTON_MATH_FUNCTION f32 round_to_nearest(f32 const x, f32 const b) {
+        return round(x / b) * b;
+    }
+
+    ANTON_MATH_FUNCTION f32 floor(f32 const x) {
+        return ::floorf(x);
+    }
+
+    ANTON_MATH_FUNCTION f32 ceil(f32 const x) {
+        return ::ceilf(x);
+    }
+
+    ANTON_MATH_FUNCTION f32 fract(f32 const x) {
+        f32 integral_part;
+        return ::modff(x, &integral_part);
+    }
+
+    // is_almost_zero
+    // Determines whether the value is almost equal to 0 within given tolerance.
+    //
+    ANTON_MATH_CONSTEXPR bool is_almost_zero(f32 const value, f32 const tolerance) {
+        return math::abs(value) <= tolerance;
+    }
+
+    ANTON_MATH_CONSTEXPR f32 step_to_value(f32 const current, f32 const target, f32 const change) {
+        f32 delta = target - current;
+        if (abs(delta) > change) {
+            return current + sign(delta) * change;
+        } else {
+            return target;
+        }
+    }
+
+    ANTON_MATH_CONSTEXPR f32 lerp(f32 const a, f32 const b, f32 const t) {
+        return (1.0f - t) * a + t * b;
+    }
+
+    ANTON_MATH_CONSTEXPR f32 smoothstep(f32 const edge0, f32 const edge1, f32 x) {
+        x = clamp((x - edge0) / (edge1 - edge0), 0.0f, 1.0f);
+        return x * x * (3.0f - 2.0f * x);
+    }
+
+    ANTON_MATH_CONSTEXPR f32 smootherstep(f32 const edge0, f32 const edge1, f32 x) {
+        x = clamp((x - edge0) / (edge1 - edge0), 0.0f, 1.0f);
+        return x * x * x * ((6.0f * x - 15.0f) * x + 10.0f);
+    }
+} // namespace anton::math
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <anton/math/detail/config.hpp>
+
+#if ANTON_MATH_SSE2
+#    if ANTON_MATH_AVX
+#        include <immintrin.h>
+#    else
+#        include <emmintrin.h>
+#    endif
+
+#    include <anton/math/vec4.hpp>
+
+namespace anton::math::detail {
+    [[nodiscard]] inline __m128 load(Vec4 const& v) {
+        return _mm_load_ps(v.data());
+    }
+
+    [[nodiscard]] inline Vec4 store(__m128 const v) {
+        Vec4 r;
+        _mm_store_ps(r.data(), v);
+        return r;
+    }
+
+    // splat
+    // Broadcasts the component at index to all components.
+    //
+    template<i32 index>
+    [[nodiscard]] inline __m128 splat(__m128 const v) {
+        return _mm_shuffle_ps(v, v, _MM_SHUFFLE(index, index, index, index));
+    }
+
+    // horizontal_sum
+    // Sums the components of v.
+    //
+    [[nodiscard]] inline f32 horizontal_sum(__m128 const v) {
+        __m128 const s = _mm_add_ps(v, _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 0, 1)));
+        return _mm_cvtss_f32(_mm_add_ss(s, _mm_movehl_ps(s, s)));
+    }
+
+    // transform
+    // Multiplies the column major matrix c0, c1, c2, c3 by v.
+    //
+    [[nodiscard]] inline __m128 transform(__m128 const c0, __m128 const c1, __m128 const c2, __m128 const c3, __m128 const v) {
+        __m128 const r0 = _mm_add_ps(_mm_mul_ps(c0, splat<0>(v)), _mm_mul_ps(c1, splat<1>(v)));
+        __m128 const r1 = _mm_add_ps(_mm_mul_ps(c2, splat<2>(v)), _mm_mul_ps(c3, splat<3>(v)));
+        return _mm_add_ps(r0, r1);
+    }
+} // namespace anton::math::detail
+#endif
@@ -0,0 +1,166 @@
+#pragma once
+
+#include <anton/math/transform.hpp>
+#include <anton/math/math.hpp>
+
+namespace anton::math {
+    ANTON_MATH_CONSTEXPR Mat4 translate(Vec3 translation) {
+        return {{1, 0, 0, 0}, {0, 1, 0, 0}, {0, 0, 1, 0}, {translation.x, translation.y, translation.z, 1}};
+    }
+
+    ANTON_MATH_CONSTEXPR Mat4 rotate(Quat q) {
+        return {{1 - 2 * q.y * q.y - 2 * q.z * q.z, 2 * q.x * q.y + 2 * q.z * q.w, 2 * q.x * q.z - 2 * q.y * q.w, 0},
+                {2 * q.x * q.y - 2 * q.z * q.w, 1 - 2 * q.x * q.x - 2 * q.z * q.z, 2 * q.y * q.z + 2 * q.x * q.w, 0},
+                {2 * q.x * q.z + 2 * q.y * q.w, 2 * q.y * q.z - 2 * q.x * q.w, 1 - 2 * q.x * q.x - 2 * q.y * q.y, 0},
+                {0, 0, 0, 1}};
+    }
+
+    ANTON_MATH_CONSTEXPR Mat4 rotate_x(f32 angle) {
+        Sin_Cos const sc = math::sincos(angle);
+        return {{1, 0, 0, 0}, {0, sc.cos, -sc.sin, 0}, {0, sc.sin, sc.cos, 0}, {0, 0, 0, 1}};
+    }
+
+    ANTON_MATH_CONSTEXPR Mat4 rotate_y(f32 angle) {
+        Sin_Cos const sc = math::sincos(angle);
+        return {{sc.cos, 0, sc.sin, 0}, {0, 1, 0, 0}, {-sc.sin, 0, sc.cos, 0}, {0, 0, 0, 1}};
+    }
+
+    ANTON_MATH_CONSTEXPR Mat4 rotate_z(f32 angle) {
+        Sin_Cos const sc = math::sincos(angle);
+        return {{sc.cos, -sc.sin, 0, 0}, {sc.sin, sc.cos, 0, 0}, {0, 0, 1, 0}, {0, 0, 0, 1}};
+    }
+
+    ANTON_MATH_CONSTEXPR Mat4 scale(Vec3 scale) {
+        return {{scale.x, 0, 0, 0}, {0, scale.y, 0, 0}, {0, 0, scale.z, 0}, {0, 0, 0, 1}};
+    }
+
+    ANTON_MATH_CONSTEXPR Mat4 scale(f32 scale) {
+        return {{scale, 0, 0, 0}, {0, scale, 0, 0}, {0, 0, scale, 0}, {0, 0, 0, 1}};
+    }
+
+    ANTON_MATH_CONSTEXPR Mat4 orthographic_rh(f32 left, f32 right, f32 bottom, f32 top, f32 near, f32 far) {
+        return {{2.0f / (right - left), 0, 0, 0},
+                {0, 2.0f / (top - bottom), 0, 0},
+                {0, 0, -2.0f / (far - near), 0},
+                {-(right + left) / (right - left), -(top + bottom) / (top - bottom), -(far + near) / (far - near), 1}};
+    }
+
+    ANTON_MATH_CONSTEXPR Mat4 orthographic_lh(f32 left, f32 right, f32 bottom, f32 top, f32 near, f32 far) {
+        return {{2.0f / (right - left), 0, 0, 0},
+                {0, 2.0f / (top - bottom), 0, 0},
+                {0, 0, 2.0f / (far - near), 0},
+                {-(right + left) / (right - left), -(top + bottom) / (top - bottom), -(far + near) / (far - near), 1}};
+    }
+
+    ANTON_MATH_CONSTEXPR Mat4 perspective_rh(f32 const fov, f32 const aspect_ratio, f32 const near, f32 const far) {
+        f32 inv_tan = 1 / (math::tan(fov / 2));
+        return {{inv_tan / aspect_ratio, 0, 0, 0}, {0, inv_tan, 0, 0}, {0, 0, -(far + near) / (far - near), -1}, {0, 0, -2 * far * near / (far - near), 0}};
+    }
+
+    ANTON_MATH_CONSTEXPR Mat4 perspective_rh_zo(f32 const fov, f32 const aspect_ratio, f32 const near, f32 const far) {
+        f32 inv_tan = 1 / (math::tan(fov / 2));
+        return {{inv_tan / aspect_ratio, 0, 0, 0}, {0, inv_tan, 0, 0}, {0, 0, -far / (far - near), -1}, {0, 0, -1 * far * near / (far - near), 0}};
+    }
+
+    ANTON_MATH_CONSTEXPR Mat4 perspective_lh(f32 const fov, f32 const aspect_ratio, f32 const near, f32 const far) {
+        f32 inv_tan = 1 / (math::tan(fov / 2));
+        return {{inv_tan / aspect_ratio, 0, 0, 0}, {0, inv_tan, 0, 0}, {0, 0, (far + near) / (far - near), 1}, {0, 0, -2 * near * far / (far - near), 0}};
+    }
+
+    ANTON_MATH_CONSTEXPR Mat4 lookat_rh(Vec3 const& eye, Vec3 const& center, Vec3 const& up) {
+        Vec3 const f = normalize(center - eye);
+        Vec3 const s = normalize(cross(f, up));
+        Vec3 const u = cross(s, f);
+        Mat4 r = {};
+        r[0][0] = s.x;
+        r[1][0] = s.y;
+        r[2][0] = s.z;
+        r[0][1] = u.x;
+        r[1][1] = u.y;
+        r[2][1] = u.z;
+        r[0][2] = -f.x;
+        r[1][2] = -f.y;
+        r[2][2] = -f.z;
+        r[3][0] = -dot(s, eye);
+        r[3][1] = -dot(u, eye);
+        r[3][2] = dot(f, eye);
+        r[3][3] = 1.f;
+        return r;
+    }
+
+    ANTON_MATH_CONSTEXPR Mat4 inverse_affine(Mat4 const& m) {
+        Vec3 const x = Vec3(m[0]);
+        Vec3 const y = Vec3(m[1]);
+        Vec3 const z = Vec3(m[2]);
+        Vec3 const t = Vec3(m[3]);
+        // The rows of the inverse of the 3x3 block are the cross products of its
+        // columns divided by the determinant.
+        Vec3 const r0 = cross(y, z);
+        Vec3 const r1 = cross(z, x);
+        Vec3 const r2 = cross(x, y);
+        f32 const inv_det = 1.0f / dot(x, r0);
+        Vec3 const i0 = r0 * inv_det;
+        Vec3 const i1 = r1 * inv_det;
+        Vec3 const i2 = r2 * inv_det;
+        return {{i0.x, i1.x, i2.x, 0}, {i0.y, i1.y, i2.y, 0}, {i0.z, i1.z, i2.z, 0}, {-dot(i0, t), -dot(i1, t), -dot(i2, t), 1}};
+    }
+
+    ANTON_MATH_CONSTEXPR Mat4 inverse_rigid(Mat4 const& m) {
+        Vec3 const x = Vec3(m[0]);
+        Vec3 const y = Vec3(m[1]);
+        Vec3 const z = Vec3(m[2]);
+        Vec3 const t = Vec3(m[3]);
+        return {{x.x, y.x, z.x, 0}, {x.y, y.y, z.y, 0}, {x.z, y.z, z.z, 0}, {-dot(x, t), -dot(y, t), -dot(z, t), 1}};
+    }
+
+    ANTON_MATH_CONSTEXPR Mat4 compose(TRS const& trs) {
+        Quat const& q = trs.rotation;
+        Vec3 const& s = trs.scale;
+        Vec3 const& t = trs.translation;
+        return {{(1 - 2 * q.y * q.y - 2 * q.z * q.z) * s.x, (2 * q.x * q.y + 2 * q.z * q.w) * s.x, (2 * q.x * q.z - 2 * q.y * q.w) * s.x, 0},
+                {(2 * q.x * q.y - 2 * q.z * q.w) * s.y, (1 - 2 * q.x * q.x - 2 * q.z * q.z) * s.y, (2 * q.y * q.z + 2 * q.x * q.w) * s.y, 0},
+                {(2 * q.x * q.z + 2 * q.y * q.w) * s.z, (2 * q.y * q.z - 2 * q.x * q.w) * s.z, (1 - 2 * q.x * q.x - 2 * q.y * q.y) * s.z, 0},
+                {t.x, t.y, t.z, 1}};
+    }
+
+    ANTON_MATH_CONSTEXPR TRS decompose(Mat4 const& mat) {
+        Vec3 translation = Vec3(mat[3]);
+        Vec3 scale = {length(Vec3(mat[0])), length(Vec3(mat[1])), length(Vec3(mat[2]))};
+        f32 const m00 = mat[0][0] / scale.x;
+        f32 const m01 = mat[0][1] / scale.x;
+        f32 const m02 = mat[0][2] / scale.x;
+        f32 const m10 = mat[1][0] / scale.y;
+        f32 const m11 = mat[1][1] / scale.y;
+        f32 const m12 = mat[1][2] / scale.y;
+        f32 const m20 = mat[2][0] / scale.z;
+        f32 const m21 = mat[2][1] / scale.z;
+        f32 const m22 = mat[2][2] / scale.z;
+        f32 const trace = m00 + m11 + m22;
+        f32 qw = 0.0f;
+        f32 qx = 0.0f;
+        f32 qy = 0.0f;
+        f32 qz = 0.0f;
+        if(trace > 0.0f) {
+            qw = math::sqrt(1.0f + trace) * 0.5f;
+            qx = 0.25f * (m12 - m21) / qw;
+            qy = 0.25f * (m20 - m02) / qw;
+            qz = 0.25f * (m01 - m10) / qw;
+        } else if(m00 > m11 && m00 > m22) {
+            qx = math::sqrt(1.0f + m00 - m11 - m22) * 0.5f;
+            qy = 0.25f * (m01 + m10) / qx;
+            qz = 0.25f * (m02 + m20) / qx;
+            qw = 0.25f * (m12 - m21) / qx;
+        } else if(m11 > m22) {
+            qy = math::sqrt(1.0f + m11 - m00 - m22) * 0.5f;
+            qx = 0.25f * (m01 + m10) / qy;
+            qz = 0.25f * (m12 + m21) / qy;
+            qw = 0.25f * (m20 - m02) / qy;
+        } else {
+            qz = math::sqrt(1.0f + m22 - m00 - m11) * 0.5f;
+            qx = 0.25f * (m02 + m20) / qz;
+            qy = 0.25f * (m12 + m21) / qz;
+            qw = 0.25f * (m01 - m10) / qz;
+        }
+        return {{qx, qy, qz, qw}, translation, scale};
+    }
+} // namespace anton::math
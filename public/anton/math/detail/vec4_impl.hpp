@@ -0,0 +1,338 @@
+#pragma once
+
+#include <anton/math/vec2.hpp>
+#include <anton/math/vec3.hpp>
+#include <anton/math/vec4.hpp>
+#include <anton/math/math.hpp>
+#include <anton/math/detail/simd.hpp>
+#include <anton/math/detail/utility.hpp>
+
+namespace anton::math {
+    ANTON_MATH_CONSTEXPR Vec4::Vec4(Vec2 const& vec, f32 z /* = 0.0f */, f32 w /* = 0.0f */): x(vec.x), y(vec.y), z(z), w(w) {}
+    ANTON_MATH_CONSTEXPR Vec4::Vec4(Vec3 const& vec, f32 w /* = 0.0f */): x(vec.x), y(vec.y), z(vec.z), w(w) {}
+    ANTON_MATH_CONSTEXPR Vec4::Vec4(f32 const* const p): x(p[0]), y(p[1]), z(p[2]), w(p[3]) {}
+
+    ANTON_MATH_CONSTEXPR f32& Vec4::operator[](i32 index) {
+        // Pointer arithmetic across the members is not allowed in constant expressions.
+        if(ANTON_MATH_CONSTANT_EVALUATED()) {
+            switch(index) {
+                case 0: return x;
+                case 1: return y;
+                case 2: return z;
+                default: return w;
+            }
+        }
+        return (&x)[index];
+    }
+
+    ANTON_MATH_CONSTEXPR f32 const& Vec4::operator[](i32 index) const {
+        if(ANTON_MATH_CONSTANT_EVALUATED()) {
+            switch(index) {
+                case 0: return x;
+                case 1: return y;
+                case 2: return z;
+                default: return w;
+            }
+        }
+        return (&x)[index];
+    }
+
+    ANTON_MATH_CONSTEXPR f32* Vec4::data() {
+        return &x;
+    }
+
+    ANTON_MATH_CONSTEXPR f32 const* Vec4::data() const {
+        return &x;
+    }
+
+    ANTON_MATH_CONSTEXPR void swap(Vec4& a, Vec4& b) {
+        detail::swap(a.x, b.x);
+        detail::swap(a.y, b.y);
+        detail::swap(a.z, b.z);
+        detail::swap(a.w, b.w);
+    }
+
+    ANTON_MATH_CONSTEXPR Vec4 operator-(Vec4 const& v) {
+#if ANTON_MATH_SSE2
+        if(!ANTON_MATH_CONSTANT_EVALUATED()) {
+            return detail::store(_mm_xor_ps(detail::load(v), _mm_set1_ps(-0.0f)));
+        }
+#endif
+        return {-v.x, -v.y, -v.z, -v.w};
+    }
+
+    ANTON_MATH_CONSTEXPR Vec4& operator+=(Vec4& v, Vec4 const& a) {
+#if ANTON_MATH_SSE2
+        if(!ANTON_MATH_CONSTANT_EVALUATED()) {
+            _mm_store_ps(v.data(), _mm_add_ps(detail::load(v), detail::load(a)));
+            return v;
+        }
+#endif
+        v.x += a.x;
+        v.y += a.y;
+        v.z += a.z;
+        v.w += a.w;
+        return v;
+    }
+
+    ANTON_MATH_CONSTEXPR Vec4& operator-=(Vec4& v, Vec4 const& a) {
+#if ANTON_MATH_SSE2
+        if(!ANTON_MATH_CONSTANT_EVALUATED()) {
+            _mm_store_ps(v.data(), _mm_sub_ps(detail::load(v), detail::load(a)));
+            return v;
+        }
+#endif
+        v.x -= a.x;
+        v.y -= a.y;
+        v.z -= a.z;
+        v.w -= a.w;
+        return v;
+    }
+
+    ANTON_MATH_CONSTEXPR Vec4& operator*=(Vec4& v, Vec4 const& a) {
+#if ANTON_MATH_SSE2
+        if(!ANTON_MATH_CONSTANT_EVALUATED()) {
+            _mm_store_ps(v.data(), _mm_mul_ps(detail::load(v), detail::load(a)));
+            return v;
+        }
+#endif
+        v.x *= a.x;
+        v.y *= a.y;
+        v.z *= a.z;
+        v.w *= a.w;
+        return v;
+    }
+
+    ANTON_MATH_CONSTEXPR Vec4& operator/=(Vec4& v, Vec4 const& a) {
+#if ANTON_MATH_SSE2
+        if(!ANTON_MATH_CONSTANT_EVALUATED()) {
+            _mm_store_ps(v.data(), _mm_div_ps(detail::load(v), detail::load(a)));
+            return v;
+        }
+#endif
+        v.x /= a.x;
+        v.y /= a.y;
+        v.z /= a.z;
+        v.w /= a.w;
+        return v;
+    }
+
+    ANTON_MATH_CONSTEXPR Vec4& operator+=(Vec4& v, f32 a) {
+#if ANTON_MATH_SSE2
+        if(!ANTON_MATH_CONSTANT_EVALUATED()) {
+            _mm_store_ps(v.data(), _mm_add_ps(detail::load(v), _mm_set1_ps(a)));
+            return v;
+        }
+#endif
+        v.x += a;
+        v.y += a;
+        v.z += a;
+        v.w += a;
+        return v;
+    }
+
+    ANTON_MATH_CONSTEXPR Vec4& operator-=(Vec4& v, f32 a) {
+#if ANTON_MATH_SSE2
+        if(!ANTON_MATH_CONSTANT_EVALUATED()) {
+            _mm_store_ps(v.data(), _mm_sub_ps(detail::load(v), _mm_set1_ps(a)));
+            return v;
+        }
+#endif
+        v.x -= a;
+        v.y -= a;
+        v.z -= a;
+        v.w -= a;
+        return v;
+    }
+
+    ANTON_MATH_CONSTEXPR Vec4& operator*=(Vec4& v, f32 a) {
+#if ANTON_MATH_SSE2
+        if(!ANTON_MATH_CONSTANT_EVALUATED()) {
+            _mm_store_ps(v.data(), _mm_mul_ps(detail::load(v), _mm_set1_ps(a)));
+            return v;
+        }
+#endif
+        v.x *= a;
+        v.y *= a;
+        v.z *= a;
+        v.w *= a;
+        return v;
+    }
+
+    ANTON_MATH_CONSTEXPR Vec4& operator/=(Vec4& v, f32 a) {
+#if ANTON_MATH_SSE2
+        if(!ANTON_MATH_CONSTANT_EVALUATED()) {
+            _mm_store_ps(v.data(), _mm_div_ps(detail::load(v), _mm_set1_ps(a)));
+            return v;
+        }
+#endif
+        v.x /= a;
+        v.y /= a;
+        v.z /= a;
+        v.w /= a;
+        return v;
+    }
+
+    ANTON_MATH_CONSTEXPR Vec4 operator+(Vec4 const& a, Vec4 const& b) {
+#if ANTON_MATH_SSE2
+        if(!ANTON_MATH_CONSTANT_EVALUATED()) {
+            return detail::store(_mm_add_ps(detail::load(a), detail::load(b)));
+        }
+#endif
+        return {a.x + b.x, a.y + b.y, a.z + b.z, a.w + b.w};
+    }
+
+    ANTON_MATH_CONSTEXPR Vec4 operator-(Vec4 const& a, Vec4 const& b) {
+#if ANTON_MATH_SSE2
+        if(!ANTON_MATH_CONSTANT_EVALUATED()) {
+            return detail::store(_mm_sub_ps(detail::load(a), detail::load(b)));
+        }
+#endif
+        return {a.x - b.x, a.y - b.y, a.z - b.z, a.w - b.w};
+    }
+
+    ANTON_MATH_CONSTEXPR Vec4 operator*(Vec4 const& a, Vec4 const& b) {
+#if ANTON_MATH_SSE2
+        if(!ANTON_MATH_CONSTANT_EVALUATED()) {
+            return detail::store(_mm_mul_ps(detail::load(a), detail::load(b)));
+        }
+#endif
+        return {a.x * b.x, a.y * b.y, a.z * b.z, a.w * b.w};
+    }
+
+    ANTON_MATH_CONSTEXPR Vec4 operator/(Vec4 const& a, Vec4 const& b) {
+#if ANTON_MATH_SSE2
+        if(!ANTON_MATH_CONSTANT_EVALUATED()) {
+            return detail::store(_mm_div_ps(detail::load(a), detail::load(b)));
+        }
+#endif
+        return {a.x / b.x, a.y / b.y, a.z / b.z, a.w / b.w};
+    }
+
+    ANTON_MATH_CONSTEXPR Vec4 operator+(Vec4 const& a, f32 b) {
+#if ANTON_MATH_SSE2
+        if(!ANTON_MATH_CONSTANT_EVALUATED()) {
+            return detail::store(_mm_add_ps(detail::load(a), _mm_set1_ps(b)));
+        }
+#endif
+        return {a.x + b, a.y + b, a.z + b, a.w + b};
+    }
+
+    ANTON_MATH_CONSTEXPR Vec4 operator-(Vec4 const& a, f32 b) {
+#if ANTON_MATH_SSE2
+        if(!ANTON_MATH_CONSTANT_EVALUATED()) {
+            return detail::store(_mm_sub_ps(detail::load(a), _mm_set1_ps(b)));
+        }
+#endif
+        return {a.x - b, a.y - b, a.z - b, a.w - b};
+    }
+
+    ANTON_MATH_CONSTEXPR Vec4 operator*(Vec4 const& a, f32 b) {
+#if ANTON_MATH_SSE2
+        if(!ANTON_MATH_CONSTANT_EVALUATED()) {
+            return detail::store(_mm_mul_ps(detail::load(a), _mm_set1_ps(b)));
+        }
+#endif
+        return {a.x * b, a.y * b, a.z * b, a.w * b};
+    }
+
+    ANTON_MATH_CONSTEXPR Vec4 operator*(f32 b, Vec4 const& a) {
+#if ANTON_MATH_SSE2
+        if(!ANTON_MATH_CONSTANT_EVALUATED()) {
+            return detail::store(_mm_mul_ps(detail::load(a), _mm_set1_ps(b)));
+        }
+#endif
+        return {a.x * b, a.y * b, a.z * b, a.w * b};
+    }
+
+    ANTON_MATH_CONSTEXPR Vec4 operator/(Vec4 const& a, f32 b) {
+#if ANTON_MATH_SSE2
+        if(!ANTON_MATH_CONSTANT_EVALUATED()) {
+            return detail::store(_mm_div_ps(detail::load(a), _mm_set1_ps(b)));
+        }
+#endif
+        return {a.x / b, a.y / b, a.z / b, a.w / b};
+    }
+
+    ANTON_MATH_CONSTEXPR bool operator==(Vec4 const& a, Vec4 const& b) {
+        return a.x == b.x && a.y == b.y && a.z == b.z && a.w == b.w;
+    }
+
+    ANTON_MATH_CONSTEXPR bool operator!=(Vec4 const& a, Vec4 const& b) {
+        return a.x != b.x || a.y != b.y || a.z != b.z || a.w != b.w;
+    }
+
+    ANTON_MATH_CONSTEXPR Vec4 max(Vec4 const& v1, Vec4 const& v2) {
+#if ANTON_MATH_SSE2
+        if(!ANTON_MATH_CONSTANT_EVALUATED()) {
+            return detail::store(_mm_max_ps(detail::load(v1), detail::load(v2)));
+        }
+#endif
+        return {v1.x > v2.x ? v1.x : v2.x, v1.y > v2.y ? v1.y : v2.y, v1.z > v2.z ? v1.z : v2.z, v1.w > v2.w ? v1.w : v2.w};
+    }
+
+    ANTON_MATH_CONSTEXPR Vec4 min(Vec4 const& v1, Vec4 const& v2) {
+#if ANTON_MATH_SSE2
+        if(!ANTON_MATH_CONSTANT_EVALUATED()) {
+            return detail::store(_mm_min_ps(detail::load(v1), detail::load(v2)));
+        }
+#endif
+        return {v1.x < v2.x ? v1.x : v2.x, v1.y < v2.y ? v1.y : v2.y, v1.z < v2.z ? v1.z : v2.z, v1.w < v2.w ? v1.w : v2.w};
+    }
+
+    ANTON_MATH_CONSTEXPR bool is_almost_zero(Vec4 const& v, f32 const tolerance /* = 0.000001f */) {
+        return math::abs(v.x) <= tolerance && math::abs(v.y) <= tolerance && math::abs(v.z) <= tolerance && math::abs(v.w) <= tolerance;
+    }
+
+    ANTON_MATH_CONSTEXPR f32 dot(Vec4 const& v1, Vec4 const& v2) {
+#if ANTON_MATH_SSE2
+        if(!ANTON_MATH_CONSTANT_EVALUATED()) {
+            return detail::horizontal_sum(_mm_mul_ps(detail::load(v1), detail::load(v2)));
+        }
+#endif
+        return v1.x * v2.x + v1.y * v2.y + v1.z * v2.z + v1.w * v2.w;
+    }
+
+    ANTON_MATH_CONSTEXPR f32 length_squared(Vec4 const& v) {
+#if ANTON_MATH_SSE2
+        if(!ANTON_MATH_CONSTANT_EVALUATED()) {
+            __m128 const r = detail::load(v);
+            return detail::horizontal_sum(_mm_mul_ps(r, r));
+        }
+#endif
+        return v.x * v.x + v.y * v.y + v.z * v.z + v.w * v.w;
+    }
+
+    ANTON_MATH_CONSTEXPR f32 length(Vec4 const& v) {
+        return math::sqrt(v.x * v.x + v.y * v.y + v.z * v.z + v.w * v.w);
+    }
+
+    ANTON_MATH_CONSTEXPR Vec4 normalize(Vec4 vec, f32 const tolerance /*  = 0.000001f */) {
+        if(!is_almost_zero(vec, tolerance)) {
+            f32 const inverse_vec_length = math::inv_sqrt(length_squared(vec));
+            return vec * inverse_vec_length;
+        } else {
+            return Vec4{};
+        }
+    }
+
+    ANTON_MATH_CONSTEXPR Vec4 lerp(Vec4 const& a, Vec4 const& b, f32 const t) {
+        return (1.0f - t) * a + t * b;
+    }
+
+    ANTON_MATH_CONSTEXPR Vec4 slerp(Vec4 const& a, Vec4 const& b, f32 const t) {
+        Vec4 const norm_a = normalize(a);
+        Vec4 const norm_b = normalize(b);
+        f32 const angle_cos = clamp(dot(norm_a, norm_b), -1.0f, 1.0f);
+        // We use small angle approximation for sin when the angle is < 0.1 radians
+        if(angle_cos < 0.995f) {
+            f32 const angle = acos(angle_cos);
+            f32 const inv_sin_angle = 1.0f / sin(angle);
+            f32 const f0 = inv_sin_angle * sin((1.0f - t) * angle);
+            f32 const f1 = inv_sin_angle * sin(t * angle);
+            return f0 * a + f1 * b;
+        } else {
+            return (1.0f - t) * a + t * b;
+        }
+    }
+} // namespace anton::math
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <anton/types.hpp>
+
+namespace anton::math {
+    // Instruction_Set
+    // Instruction sets that the array kernels of the library are compiled for.
+    // The kernels of each instruction set produce the same results within the
+    // tolerance documented by the respective functions.
+    //
+    enum struct Instruction_Set : u8 {
+        scalar,
+        sse2,
+        // AVX2 and FMA.
+        avx2,
+        // AVX-512F, AVX2 and FMA.
+        avx512,
+    };
+
+    // get_instruction_set_name
+    //
+    // Returns:
+    // Null-terminated lowercase name of instruction_set.
+    //
+    [[nodiscard]] char const* get_instruction_set_name(Instruction_Set instruction_set);
+
+    // is_instruction_set_supported
+    // Checks whether the kernels for instruction_set have been compiled into the library
+    // and whether the processor and the operating system support the instruction set.
+    //
+    [[nodiscard]] bool is_instruction_set_supported(Instruction_Set instruction_set);
+
+    // get_best_instruction_set
+    // Detects the best instruction set supported by the library and the processor.
+    //
+    [[nodiscard]] Instruction_Set get_best_instruction_set();
+
+    // get_instruction_set
+    // The instruction set currently used by the array kernels. The instruction set is
+    // selected with get_best_instruction_set once at startup.
+    //
+    [[nodiscard]] Instruction_Set get_instruction_set();
+
+    // set_instruction_set
+    // Forces the array kernels to use instruction_set. Must not be called while any
+    // array kernel is executing.
+    //
+    // Returns:
+    // true if instruction_set is supported and has been selected.
+    // false otherwise, in which case the selection is left unchanged.
+    //
+    bool set_instruction_set(Instruction_Set instruction_set);
+} // namespace anton::math
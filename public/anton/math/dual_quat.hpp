@@ -0,0 +1,116 @@
+#pragma once
+
+#include <anton/types.hpp>
+#include <anton/math/detail/config.hpp>
+#include <anton/math/mat4.hpp>
+#include <anton/math/quat.hpp>
+#include <anton/math/transform.hpp>
+#include <anton/math/vec3.hpp>
+
+namespace anton::math {
+    // Dual_Quat
+    // Dual quaternion real + eps * dual representing a rigid transformation, i.e. a
+    // rotation followed by a translation. A unit dual quaternion has a unit real part
+    // and a dual part orthogonal to it. The real part is the rotation and the dual part
+    // is 0.5 * translation * real where translation is the pure quaternion
+    // (translation, 0).
+    //
+    struct Dual_Quat {
+        // Identity transformation.
+        // Equivalent to Dual_Quat(Quat(0, 0, 0, 1), Quat(0, 0, 0, 0))
+        static Dual_Quat const identity;
+
+        // from_rotation_translation
+        // Constructs the unit dual quaternion of the rotation by rotation followed by the
+        // translation by translation.
+        //
+        // Parameters:
+        // rotation - unit quaternion.
+        // translation - the translation vector.
+        //
+        [[nodiscard]] static ANTON_MATH_CONSTEXPR Dual_Quat from_rotation_translation(Quat const& rotation, Vec3 const& translation);
+
+        Quat real;
+        Quat dual = Quat(0, 0, 0, 0);
+
+        Dual_Quat() = default;
+        constexpr Dual_Quat(Quat const& real, Quat const& dual): real(real), dual(dual) {}
+
+        [[nodiscard]] ANTON_MATH_CONSTEXPR f32* data();
+        [[nodiscard]] ANTON_MATH_CONSTEXPR f32 const* data() const;
+    };
+
+    inline constexpr Dual_Quat const Dual_Quat::identity = Dual_Quat(Quat(0, 0, 0, 1), Quat(0, 0, 0, 0));
+
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Dual_Quat operator-(Dual_Quat const& q);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Dual_Quat operator+(Dual_Quat const& q1, Dual_Quat const& q2);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Dual_Quat operator-(Dual_Quat const& q1, Dual_Quat const& q2);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Dual_Quat operator*(Dual_Quat const& q, f32 a);
+
+    // operator*
+    // Composition. Applying the result is equivalent to applying q followed by p.
+    //
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Dual_Quat operator*(Dual_Quat const& p, Dual_Quat const& q);
+
+    // normalize
+    // Scales q so that its real part is a unit quaternion and removes the component of
+    // the dual part parallel to the real part, which yields the nearest unit dual
+    // quaternion, e.g. of a weighted sum of unit dual quaternions. The real part of q
+    // must be non-zero.
+    //
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Dual_Quat normalize(Dual_Quat const& q);
+
+    // conjugate
+    // Conjugates both parts of q. If q is a unit dual quaternion, the result is the
+    // inverse transformation.
+    //
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Dual_Quat conjugate(Dual_Quat const& q);
+
+    // get_translation
+    // The translation of the unit dual quaternion q, i.e. the vector part of
+    // 2 * q.dual * conjugate(q.real).
+    //
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Vec3 get_translation(Dual_Quat const& q);
+
+    // transform_point
+    // Transforms point p by the unit dual quaternion q, i.e. rotates it and translates
+    // it.
+    //
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Vec3 transform_point(Dual_Quat const& q, Vec3 const& p);
+
+    // transform_direction
+    // Rotates direction d by the unit dual quaternion q. The translation does not
+    // affect directions.
+    //
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Vec3 transform_direction(Dual_Quat const& q, Vec3 const& d);
+
+    // to_dual_quat
+    // Converts the rotation and the translation of trs to a unit dual quaternion. Dual
+    // quaternions cannot represent scale, therefore the scale of trs is discarded.
+    //
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Dual_Quat to_dual_quat(TRS const& trs);
+
+    // to_dual_quat
+    // Decomposes m with decompose and converts the rotation and the translation to a
+    // unit dual quaternion. The scale of m is discarded.
+    //
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Dual_Quat to_dual_quat(Mat4 const& m);
+
+    // to_trs
+    // Converts the unit dual quaternion q to its rotation and translation. The scale is
+    // 1.
+    //
+    [[nodiscard]] ANTON_MATH_CONSTEXPR TRS to_trs(Dual_Quat const& q);
+
+    // to_mat4
+    // Builds the transformation matrix of the unit dual quaternion q.
+    // Equivalent to compose(to_trs(q)).
+    //
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Mat4 to_mat4(Dual_Quat const& q);
+
+    ANTON_MATH_CONSTEXPR void swap(Dual_Quat& q1, Dual_Quat& q2);
+} // namespace anton::math
+
+#if ANTON_MATH_INLINE
+#    include <anton/math/detail/dual_quat_impl.hpp>
+#endif
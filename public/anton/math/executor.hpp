@@ -0,0 +1,90 @@
+#pragma once
+
+#include <anton/types.hpp>
+
+// Parallel execution of the array functions.
+//
+// The functions in batch.hpp, soa.hpp, vec3_array.hpp and vec4_array.hpp split arrays
+// that are large enough into chunks and run the chunks on the executor installed with
+// set_executor. Without an executor, which is the default, the arrays are processed on
+// the calling thread.
+//
+// The chunks start at multiples of 16 elements, the widest vector of the kernels,
+// therefore every element is computed by exactly the same instructions as it would be
+// on a single thread and the results are bitwise identical regardless of the executor,
+// the number of threads and the order in which the chunks complete.
+//
+namespace anton::math {
+    // Executor
+    // Interface of the job systems that the array functions distribute their work to.
+    // Implement it to run the array functions on the job system of the application.
+    //
+    struct Executor {
+    public:
+        virtual ~Executor() = default;
+
+        // get_concurrency
+        // The number of tasks the executor is able to run simultaneously including the
+        // calling thread. The array functions split their work into a few times as many
+        // tasks to balance the load.
+        //
+        [[nodiscard]] virtual i64 get_concurrency() const = 0;
+
+        // parallel_for
+        // Invokes task(context, index) exactly once for each index in [0, task_count)
+        // and returns once all invocations have completed. The invocations may run in
+        // any order and concurrently on any thread, including the calling one. task
+        // does not throw.
+        //
+        virtual void parallel_for(i64 task_count, void (*task)(void* context, i64 index), void* context) = 0;
+    };
+
+    // Thread_Pool
+    // Executor with a fixed number of worker threads. Each parallel_for divides the
+    // tasks evenly among the workers and the calling thread, which then take tasks
+    // from the front of their own range and, once it is exhausted, steal the back half
+    // of the range of another thread.
+    //
+    // The pool runs one parallel_for at a time. parallel_for called from another thread
+    // while the pool is busy runs its tasks on the calling thread.
+    //
+    struct Thread_Pool: public Executor {
+    public:
+        // Starts thread_count worker threads. When thread_count is 0, starts one worker
+        // fewer than the number of hardware threads so that together with the calling
+        // thread every hardware thread is busy. thread_count must not be negative,
+        // negative values are treated as 0.
+        explicit Thread_Pool(i64 thread_count = 0);
+        Thread_Pool(Thread_Pool const&) = delete;
+        Thread_Pool& operator=(Thread_Pool const&) = delete;
+        // Joins the worker threads. Must not be called during parallel_for.
+        ~Thread_Pool() override;
+
+        // get_thread_count
+        // The number of worker threads.
+        //
+        [[nodiscard]] i64 get_thread_count() const;
+
+        [[nodiscard]] i64 get_concurrency() const override;
+        void parallel_for(i64 task_count, void (*task)(void* context, i64 index), void* context) override;
+
+    private:
+        struct Impl;
+
+        Impl* _impl;
+    };
+
+    // get_executor
+    // The executor used by the array functions or nullptr if the arrays are processed
+    // on the calling thread.
+    //
+    [[nodiscard]] Executor* get_executor();
+
+    // set_executor
+    // Installs executor to be used by the array functions. nullptr makes the array
+    // functions process the arrays on the calling thread. The executor is not owned by
+    // the library and must outlive its use. Must not be called while any array function
+    // is executing.
+    //
+    void set_executor(Executor* executor);
+} // namespace anton::math
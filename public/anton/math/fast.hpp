@@ -0,0 +1,109 @@
+#pragma once
+
+#include <anton/types.hpp>
+#include <anton/math/detail/config.hpp>
+#include <anton/math/quat.hpp>
+#include <anton/math/vec2.hpp>
+#include <anton/math/vec3.hpp>
+#include <anton/math/vec4.hpp>
+
+// anton::math::fast
+// Approximations of the functions in anton::math that trade precision for speed.
+// Each function states the maximum error over its documented domain. The results
+// outside of the domain are unspecified. Special values (nan, infinities, denormals)
+// are not handled unless stated otherwise.
+//
+namespace anton::math::fast {
+    // inv_sqrt
+    // Computes 1 / sqrt(a) with a relative error below 5e-6.
+    // a must be positive, finite and normal.
+    //
+    [[nodiscard]] ANTON_MATH_FUNCTION f32 inv_sqrt(f32 a);
+
+    // sin
+    // Computes the sine of angle with an absolute error below 1e-6 for |angle| <= 8192.
+    // The error grows proportionally to |angle| past 8192. |angle| must be below 2^22.
+    //
+    [[nodiscard]] ANTON_MATH_FUNCTION f32 sin(f32 angle);
+
+    // cos
+    // Computes the cosine of angle with an absolute error below 1e-6 for |angle| <= 8192.
+    // The error grows proportionally to |angle| past 8192. |angle| must be below 2^22.
+    //
+    [[nodiscard]] ANTON_MATH_FUNCTION f32 cos(f32 angle);
+
+    // asin
+    // Computes the arcsine of x with an absolute error below 1e-5. x must be in [-1, 1].
+    //
+    [[nodiscard]] ANTON_MATH_FUNCTION f32 asin(f32 x);
+
+    // acos
+    // Computes the arccosine of x with an absolute error below 1e-5. x must be in [-1, 1].
+    //
+    [[nodiscard]] ANTON_MATH_FUNCTION f32 acos(f32 x);
+
+    // atan
+    // Computes the arctangent of x with an absolute error below 2e-5. x must not be nan.
+    //
+    [[nodiscard]] ANTON_MATH_FUNCTION f32 atan(f32 x);
+
+    // atan2
+    // Computes the angle of the point (x, y) with an absolute error below 2e-5.
+    // Returns 0 when both x and y are 0. x and y must be finite.
+    //
+    [[nodiscard]] ANTON_MATH_FUNCTION f32 atan2(f32 y, f32 x);
+
+    // exp2
+    // Computes 2^n with a relative error below 5e-6. Results smaller than 2^-126 are
+    // flushed to 0 and results larger than the largest finite f32 are infinity.
+    // n must not be nan.
+    //
+    [[nodiscard]] ANTON_MATH_FUNCTION f32 exp2(f32 n);
+
+    // exp
+    // Computes e^n with a relative error below 1e-5. Results smaller than 2^-126 are
+    // flushed to 0 and results larger than the largest finite f32 are infinity.
+    // n must not be nan.
+    //
+    [[nodiscard]] ANTON_MATH_FUNCTION f32 exp(f32 n);
+
+    // log2
+    // Computes the base-2 logarithm of v with an absolute error below 1e-5.
+    // v must be positive, finite and normal.
+    //
+    [[nodiscard]] ANTON_MATH_FUNCTION f32 log2(f32 v);
+
+    // log
+    // Computes the natural logarithm of v with an absolute error below 1e-5.
+    // v must be positive, finite and normal.
+    //
+    [[nodiscard]] ANTON_MATH_FUNCTION f32 log(f32 v);
+
+    // normalize
+    // math::normalize computed with fast::inv_sqrt. The components have a relative
+    // error below 5e-6.
+    //
+    [[nodiscard]] ANTON_MATH_FUNCTION Vec2 normalize(Vec2 vec, f32 tolerance = 0.000001f);
+    [[nodiscard]] ANTON_MATH_FUNCTION Vec3 normalize(Vec3 vec, f32 tolerance = 0.000001f);
+    [[nodiscard]] ANTON_MATH_FUNCTION Vec4 normalize(Vec4 vec, f32 tolerance = 0.000001f);
+    [[nodiscard]] ANTON_MATH_FUNCTION Quat normalize(Quat const& q);
+
+    // orient_towards
+    // Constructs a unit quaternion that rotates start onto target without evaluating
+    // any trigonometric functions. The rotated start is within 1e-5 of target when the
+    // angle between them is at most 175 degrees. The error grows as target approaches
+    // -start. Returns the identity if start and target point in opposite directions.
+    // start and target must be unit vectors.
+    //
+    [[nodiscard]] ANTON_MATH_FUNCTION Quat orient_towards(Vec3 start, Vec3 target);
+
+    // slerp
+    // math::slerp computed with fast::acos and fast::sin. The components have an
+    // absolute error below 1e-4. Both a and b must be unit quaternions.
+    //
+    [[nodiscard]] ANTON_MATH_FUNCTION Quat slerp(Quat const& a, Quat const& b, f32 t);
+} // namespace anton::math::fast
+
+#if ANTON_MATH_INLINE
+#    include <anton/math/detail/fast_impl.hpp>
+#endif
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <anton/types.hpp>
+#include <anton/math/affine3.hpp>
+#include <anton/math/mat4.hpp>
+#include <anton/math/transform.hpp>
+
+namespace anton::math {
+    // Hierarchy
+    // Forest of nodes described by the indices of their parents, ordered by levels for
+    // the propagation of transformations from the roots to the leaves. Level 0 consists
+    // of the roots, level k + 1 of the children of the nodes of level k. The children of
+    // a node are adjacent within their level.
+    //
+    struct Hierarchy {
+    public:
+        Hierarchy();
+        // Parameters:
+        // parents - array of count indices. parents[i] is the index of the parent of node i
+        //           or -1 if node i is a root. The parents must not form cycles.
+        // count - the number of nodes. May be 0.
+        //
+        Hierarchy(i64 const* parents, i64 count);
+        Hierarchy(Hierarchy const& other);
+        Hierarchy(Hierarchy&& other);
+        ~Hierarchy();
+        Hierarchy& operator=(Hierarchy const& other);
+        Hierarchy& operator=(Hierarchy&& other);
+
+        // size
+        // The number of nodes.
+        //
+        [[nodiscard]] i64 size() const;
+
+        // get_parents
+        // Array of size indices of the parents of the nodes, -1 for the roots.
+        //
+        [[nodiscard]] i64 const* get_parents() const;
+
+        // get_level_count
+        // The number of levels, i.e. the depth of the deepest node plus 1.
+        //
+        [[nodiscard]] i64 get_level_count() const;
+
+        // get_nodes
+        // Array of size indices of the nodes ordered by levels.
+        //
+        [[nodiscard]] i64 const* get_nodes() const;
+
+        // get_level_offset
+        // The position in get_nodes of the first node of level. The nodes of level are
+        // [get_level_offset(level), get_level_offset(level + 1)). level may be equal to
+        // get_level_count.
+        //
+        [[nodiscard]] i64 get_level_offset(i64 level) const;
+
+    private:
+        i64* _parents;
+        // Indices of the nodes ordered by levels.
+        i64* _nodes;
+        // get_level_count() + 1 offsets into _nodes.
+        i64* _level_offsets;
+        i64 _size;
+        i64 _level_count;
+    };
+
+    // compute_world_transforms
+    // Computes the world transformations of all nodes of hierarchy from their local
+    // transformations, which are relative to their parents. Equivalent to
+    // worlds[i] = worlds[parent(i)] * local(i) evaluated in level order and
+    // worlds[i] = local(i) for the roots, where local(i) is compose(locals[i]) for TRS,
+    // to_mat4(locals[i]) for Affine3 and locals[i] for Mat4.
+    //
+    // The nodes of each level are processed in batches with the array kernels and
+    // split across the executor (executor.hpp) when the level is large enough. The
+    // transformations are gathered by node index, hence numbering the nodes in the
+    // order of get_nodes makes the accesses sequential.
+    //
+    // Parameters:
+    // hierarchy - the hierarchy to propagate the transformations through.
+    // locals - array of hierarchy.size() local transformations.
+    // worlds - array of hierarchy.size() matrices to write the world transformations to.
+    //          Must not overlap locals.
+    //
+    void compute_world_transforms(Hierarchy const& hierarchy, TRS const* locals, Mat4* worlds);
+    void compute_world_transforms(Hierarchy const& hierarchy, Affine3 const* locals, Mat4* worlds);
+    void compute_world_transforms(Hierarchy const& hierarchy, Mat4 const* locals, Mat4* worlds);
+
+    // update_world_transforms
+    // Recomputes the world transformations of the nodes marked in dirty and of all of
+    // their descendants, leaving the remaining world transformations unchanged. The
+    // world transformations of the remaining nodes must be up to date.
+    //
+    // Parameters:
+    // hierarchy - the hierarchy to propagate the transformations through.
+    // locals - array of hierarchy.size() local transformations.
+    // dirty - array of hierarchy.size() flags. Nonzero dirty[i] marks node i as changed.
+    //         On return, the flags of all recomputed nodes are set to 1, which allows
+    //         uploading only the changed world transformations. The caller clears them
+    //         before marking the changes of the next update.
+    // worlds - array of hierarchy.size() matrices to write the world transformations to.
+    //          Must not overlap locals.
+    //
+    void update_world_transforms(Hierarchy const& hierarchy, TRS const* locals, u8* dirty, Mat4* worlds);
+    void update_world_transforms(Hierarchy const& hierarchy, Affine3 const* locals, u8* dirty, Mat4* worlds);
+    void update_world_transforms(Hierarchy const& hierarchy, Mat4 const* locals, u8* dirty, Mat4* worlds);
+} // namespace anton::math
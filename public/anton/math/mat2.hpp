@@ -1,6 +1,7 @@
 #pragma once
 
 #include <anton/types.hpp>
+#include <anton/math/detail/config.hpp>
 #include <anton/math/vec2.hpp>
 
 namespace anton::math {
@@ -12,48 +13,55 @@ namespace anton::math {
         static Mat2 const zero;
         static Mat2 const identity;
 
-        Mat2();
-        Mat2(Vec2 const& a, Vec2 const& b);
-        explicit Mat2(f32 const* p);
+        constexpr Mat2(): columns{} {}
+        constexpr Mat2(Vec2 const& a, Vec2 const& b): columns{a, b} {}
+        explicit ANTON_MATH_CONSTEXPR Mat2(f32 const* p);
 
-        [[nodiscard]] Vec2& operator[](i32 column);
-        [[nodiscard]] Vec2 const& operator[](i32 column) const;
+        [[nodiscard]] ANTON_MATH_CONSTEXPR Vec2& operator[](i32 column);
+        [[nodiscard]] ANTON_MATH_CONSTEXPR Vec2 const& operator[](i32 column) const;
 
-        [[nodiscard]] f32& operator()(i32 column, i32 row);
-        [[nodiscard]] f32 const& operator()(i32 column, i32 row) const;
+        [[nodiscard]] ANTON_MATH_CONSTEXPR f32& operator()(i32 column, i32 row);
+        [[nodiscard]] ANTON_MATH_CONSTEXPR f32 const& operator()(i32 column, i32 row) const;
 
-        [[nodiscard]] f32* data();
-        [[nodiscard]] f32 const* data() const;
+        [[nodiscard]] ANTON_MATH_FUNCTION f32* data();
+        [[nodiscard]] ANTON_MATH_FUNCTION f32 const* data() const;
 
-        Mat2& operator+=(f32 a);
-        Mat2& operator-=(f32 a);
-        Mat2& operator*=(f32 a);
-        Mat2& operator/=(f32 a);
+        ANTON_MATH_CONSTEXPR Mat2& operator+=(f32 a);
+        ANTON_MATH_CONSTEXPR Mat2& operator-=(f32 a);
+        ANTON_MATH_CONSTEXPR Mat2& operator*=(f32 a);
+        ANTON_MATH_CONSTEXPR Mat2& operator/=(f32 a);
 
-        Mat2& operator+=(Mat2 const& m);
-        Mat2& operator-=(Mat2 const& m);
-        Mat2& operator*=(Mat2 const& rhs);
+        ANTON_MATH_CONSTEXPR Mat2& operator+=(Mat2 const& m);
+        ANTON_MATH_CONSTEXPR Mat2& operator-=(Mat2 const& m);
+        ANTON_MATH_CONSTEXPR Mat2& operator*=(Mat2 const& rhs);
 
     private:
         Vec2 columns[2];
     };
 
-    [[nodiscard]] Mat2 operator+(Mat2 m, f32 a);
-    [[nodiscard]] Mat2 operator-(Mat2 m, f32 a);
-    [[nodiscard]] Mat2 operator*(Mat2 m, f32 a);
-    [[nodiscard]] Mat2 operator/(Mat2 m, f32 a);
-    [[nodiscard]] Mat2 operator+(Mat2 lhs, Mat2 const& rhs);
-    [[nodiscard]] Mat2 operator-(Mat2 lhs, Mat2 const& rhs);
-    [[nodiscard]] Mat2 operator*(Mat2 lhs, Mat2 const& rhs);
-    [[nodiscard]] Vec2 operator*(Mat2 const& lhs, Vec2 const& rhs);
+    inline constexpr Mat2 const Mat2::zero = Mat2();
+    inline constexpr Mat2 const Mat2::identity = Mat2({1, 0}, {0, 1});
 
-    [[nodiscard]] Mat2 transpose(Mat2 m);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Mat2 operator+(Mat2 m, f32 a);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Mat2 operator-(Mat2 m, f32 a);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Mat2 operator*(Mat2 m, f32 a);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Mat2 operator/(Mat2 m, f32 a);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Mat2 operator+(Mat2 lhs, Mat2 const& rhs);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Mat2 operator-(Mat2 lhs, Mat2 const& rhs);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Mat2 operator*(Mat2 lhs, Mat2 const& rhs);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Vec2 operator*(Mat2 const& lhs, Vec2 const& rhs);
 
-    [[nodiscard]] f32 determinant(Mat2 const& m);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Mat2 transpose(Mat2 m);
 
-    [[nodiscard]] Mat2 adjugate(Mat2 const& m);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR f32 determinant(Mat2 const& m);
 
-    [[nodiscard]] Mat2 inverse(Mat2 const& m);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Mat2 adjugate(Mat2 const& m);
 
-    void swap(Mat2& m1, Mat2& m2);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Mat2 inverse(Mat2 const& m);
+
+    ANTON_MATH_CONSTEXPR void swap(Mat2& m1, Mat2& m2);
 } // namespace anton::math
+
+#if ANTON_MATH_INLINE
+#    include <anton/math/detail/mat2_impl.hpp>
+#endif
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <anton/types.hpp>
+#include <anton/math/detail/config.hpp>
 #include <anton/math/vec3.hpp>
 
 namespace anton::math {
@@ -14,49 +15,56 @@ namespace anton::math {
         static Mat3 const zero;
         static Mat3 const identity;
 
-        Mat3();
-        Mat3(Vec3 const& a, Vec3 const& b, Vec3 const& c);
-        explicit Mat3(Mat4 const& mat);
-        explicit Mat3(f32 const* p);
+        constexpr Mat3(): columns{} {}
+        constexpr Mat3(Vec3 const& a, Vec3 const& b, Vec3 const& c): columns{a, b, c} {}
+        explicit ANTON_MATH_CONSTEXPR Mat3(Mat4 const& mat);
+        explicit ANTON_MATH_CONSTEXPR Mat3(f32 const* p);
 
-        [[nodiscard]] Vec3& operator[](i32 column);
-        [[nodiscard]] Vec3 const& operator[](i32 column) const;
+        [[nodiscard]] ANTON_MATH_CONSTEXPR Vec3& operator[](i32 column);
+        [[nodiscard]] ANTON_MATH_CONSTEXPR Vec3 const& operator[](i32 column) const;
 
-        [[nodiscard]] f32& operator()(i32 column, i32 row);
-        [[nodiscard]] f32 const& operator()(i32 column, i32 row) const;
+        [[nodiscard]] ANTON_MATH_CONSTEXPR f32& operator()(i32 column, i32 row);
+        [[nodiscard]] ANTON_MATH_CONSTEXPR f32 const& operator()(i32 column, i32 row) const;
 
-        [[nodiscard]] f32* data();
-        [[nodiscard]] f32 const* data() const;
+        [[nodiscard]] ANTON_MATH_FUNCTION f32* data();
+        [[nodiscard]] ANTON_MATH_FUNCTION f32 const* data() const;
 
-        Mat3& operator+=(f32 a);
-        Mat3& operator-=(f32 a);
-        Mat3& operator*=(f32 a);
-        Mat3& operator/=(f32 a);
+        ANTON_MATH_CONSTEXPR Mat3& operator+=(f32 a);
+        ANTON_MATH_CONSTEXPR Mat3& operator-=(f32 a);
+        ANTON_MATH_CONSTEXPR Mat3& operator*=(f32 a);
+        ANTON_MATH_CONSTEXPR Mat3& operator/=(f32 a);
 
-        Mat3& operator+=(Mat3 const& m);
-        Mat3& operator-=(Mat3 const& m);
-        Mat3& operator*=(Mat3 const& rhs);
+        ANTON_MATH_CONSTEXPR Mat3& operator+=(Mat3 const& m);
+        ANTON_MATH_CONSTEXPR Mat3& operator-=(Mat3 const& m);
+        ANTON_MATH_CONSTEXPR Mat3& operator*=(Mat3 const& rhs);
 
     private:
         Vec3 columns[3];
     };
 
-    [[nodiscard]] Mat3 operator+(Mat3 m, f32 a);
-    [[nodiscard]] Mat3 operator-(Mat3 m, f32 a);
-    [[nodiscard]] Mat3 operator*(Mat3 m, f32 a);
-    [[nodiscard]] Mat3 operator/(Mat3 m, f32 a);
-    [[nodiscard]] Mat3 operator+(Mat3 lhs, Mat3 const& rhs);
-    [[nodiscard]] Mat3 operator-(Mat3 lhs, Mat3 const& rhs);
-    [[nodiscard]] Mat3 operator*(Mat3 lhs, Mat3 const& rhs);
-    [[nodiscard]] Vec3 operator*(Mat3 const& lhs, Vec3 const& rhs);
+    inline constexpr Mat3 const Mat3::zero = Mat3();
+    inline constexpr Mat3 const Mat3::identity = Mat3({1, 0, 0}, {0, 1, 0}, {0, 0, 1});
 
-    [[nodiscard]] Mat3 transpose(Mat3 m);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Mat3 operator+(Mat3 m, f32 a);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Mat3 operator-(Mat3 m, f32 a);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Mat3 operator*(Mat3 m, f32 a);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Mat3 operator/(Mat3 m, f32 a);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Mat3 operator+(Mat3 lhs, Mat3 const& rhs);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Mat3 operator-(Mat3 lhs, Mat3 const& rhs);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Mat3 operator*(Mat3 lhs, Mat3 const& rhs);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Vec3 operator*(Mat3 const& lhs, Vec3 const& rhs);
 
-    [[nodiscard]] f32 determinant(Mat3 const& m);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Mat3 transpose(Mat3 m);
 
-    [[nodiscard]] Mat3 adjugate(Mat3 const& m);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR f32 determinant(Mat3 const& m);
 
-    [[nodiscard]] Mat3 inverse(Mat3 const& m);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Mat3 adjugate(Mat3 const& m);
 
-    void swap(Mat3& m1, Mat3& m2);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Mat3 inverse(Mat3 const& m);
+
+    ANTON_MATH_CONSTEXPR void swap(Mat3& m1, Mat3& m2);
 } // namespace anton::math
+
+#if ANTON_MATH_INLINE
+#    include <anton/math/detail/mat3_impl.hpp>
+#endif
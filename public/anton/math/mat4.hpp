@@ -1,6 +1,7 @@
 #pragma once
 
 #include <anton/types.hpp>
+#include <anton/math/detail/config.hpp>
 #include <anton/math/vec4.hpp>
 
 namespace anton::math {
@@ -12,48 +13,60 @@ namespace anton::math {
         static Mat4 const zero;
         static Mat4 const identity;
 
-        Mat4();
-        Mat4(Vec4 const& a, Vec4 const& b, Vec4 const& c, Vec4 const& d);
-        explicit Mat4(f32 const* p);
+        constexpr Mat4(): columns{} {}
+        constexpr Mat4(Vec4 const& a, Vec4 const& b, Vec4 const& c, Vec4 const& d): columns{a, b, c, d} {}
+        explicit ANTON_MATH_CONSTEXPR Mat4(f32 const* p);
 
-        [[nodiscard]] Vec4& operator[](i32 column);
-        [[nodiscard]] Vec4 const& operator[](i32 column) const;
+        [[nodiscard]] ANTON_MATH_CONSTEXPR Vec4& operator[](i32 column);
+        [[nodiscard]] ANTON_MATH_CONSTEXPR Vec4 const& operator[](i32 column) const;
 
-        [[nodiscard]] f32& operator()(i32 column, i32 row);
-        [[nodiscard]] f32 const& operator()(i32 column, i32 row) const;
+        [[nodiscard]] ANTON_MATH_CONSTEXPR f32& operator()(i32 column, i32 row);
+        [[nodiscard]] ANTON_MATH_CONSTEXPR f32 const& operator()(i32 column, i32 row) const;
 
-        [[nodiscard]] f32* data();
-        [[nodiscard]] f32 const* data() const;
+        [[nodiscard]] ANTON_MATH_FUNCTION f32* data();
+        [[nodiscard]] ANTON_MATH_FUNCTION f32 const* data() const;
 
-        Mat4& operator+=(f32 a);
-        Mat4& operator-=(f32 a);
-        Mat4& operator*=(f32 a);
-        Mat4& operator/=(f32 a);
+        ANTON_MATH_CONSTEXPR Mat4& operator+=(f32 a);
+        ANTON_MATH_CONSTEXPR Mat4& operator-=(f32 a);
+        ANTON_MATH_CONSTEXPR Mat4& operator*=(f32 a);
+        ANTON_MATH_CONSTEXPR Mat4& operator/=(f32 a);
 
-        Mat4& operator+=(Mat4 const& m);
-        Mat4& operator-=(Mat4 const& m);
-        Mat4& operator*=(Mat4 const& rhs);
+        ANTON_MATH_CONSTEXPR Mat4& operator+=(Mat4 const& m);
+        ANTON_MATH_CONSTEXPR Mat4& operator-=(Mat4 const& m);
+        ANTON_MATH_CONSTEXPR Mat4& operator*=(Mat4 const& rhs);
 
     private:
         Vec4 columns[4];
     };
 
-    [[nodiscard]] Mat4 operator+(Mat4 m, f32 const a);
-    [[nodiscard]] Mat4 operator-(Mat4 m, f32 const a);
-    [[nodiscard]] Mat4 operator*(Mat4 m, f32 const a);
-    [[nodiscard]] Mat4 operator/(Mat4 m, f32 const a);
-    [[nodiscard]] Mat4 operator+(Mat4 lhs, Mat4 const& rhs);
-    [[nodiscard]] Mat4 operator-(Mat4 lhs, Mat4 const& rhs);
-    [[nodiscard]] Mat4 operator*(Mat4 lhs, Mat4 const& rhs);
-    [[nodiscard]] Vec4 operator*(Mat4 const& lhs, Vec4 const& rhs);
+    inline constexpr Mat4 const Mat4::zero = Mat4();
+    inline constexpr Mat4 const Mat4::identity = Mat4{{1, 0, 0, 0}, {0, 1, 0, 0}, {0, 0, 1, 0}, {0, 0, 0, 1}};
 
-    [[nodiscard]] Mat4 transpose(Mat4 mat);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Mat4 operator+(Mat4 m, f32 const a);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Mat4 operator-(Mat4 m, f32 const a);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Mat4 operator*(Mat4 m, f32 const a);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Mat4 operator/(Mat4 m, f32 const a);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Mat4 operator+(Mat4 lhs, Mat4 const& rhs);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Mat4 operator-(Mat4 lhs, Mat4 const& rhs);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Mat4 operator*(Mat4 lhs, Mat4 const& rhs);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Vec4 operator*(Mat4 const& lhs, Vec4 const& rhs);
 
-    [[nodiscard]] f32 determinant(Mat4 const& m);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Mat4 transpose(Mat4 mat);
 
-    [[nodiscard]] Mat4 adjugate(Mat4 const& m);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR f32 determinant(Mat4 const& m);
 
-    [[nodiscard]] Mat4 inverse(Mat4 const& m);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Mat4 adjugate(Mat4 const& m);
 
-    void swap(Mat4& m1, Mat4& m2);
+    // inverse
+    // Computes the inverse of m by Laplace expansion with shared 2x2 minors. The result
+    // matches adjugate(m) / determinant(m) within a relative error of 8 * FLT_EPSILON
+    // times the condition number of m. The result is undefined if m is singular.
+    //
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Mat4 inverse(Mat4 const& m);
+
+    ANTON_MATH_CONSTEXPR void swap(Mat4& m1, Mat4& m2);
 } // namespace anton::math
+
+#if ANTON_MATH_INLINE
+#    include <anton/math/detail/mat4_impl.hpp>
+#endif
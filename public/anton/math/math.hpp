@@ -7,6 +7,7 @@
 #undef near
 
 #include <anton/types.hpp>
+#include <anton/math/detail/config.hpp>
 
 extern "C" {
 #if ANTON_COMPILER_MSVC
@@ -51,84 +52,99 @@ constexpr f32 golden_ratio = 1.61803398f;
 // is_nan
 // Checks whether v is nan.
 //
-[[nodiscard]] bool is_nan(f32 v);
+[[nodiscard]] ANTON_MATH_CONSTEXPR bool is_nan(f32 v);
 
-[[nodiscard]] f32 pow(f32 base, f32 exp);
+[[nodiscard]] ANTON_MATH_CONSTEXPR f32 pow(f32 base, f32 exp);
 
-[[nodiscard]] f32 sqrt(f32 a);
+[[nodiscard]] ANTON_MATH_CONSTEXPR f32 sqrt(f32 a);
 
-[[nodiscard]] f32 cbrt(f32 a);
+[[nodiscard]] ANTON_MATH_CONSTEXPR f32 cbrt(f32 a);
 
-[[nodiscard]] f32 inv_sqrt(f32 a);
+[[nodiscard]] ANTON_MATH_CONSTEXPR f32 inv_sqrt(f32 a);
 
-[[nodiscard]] f32 sign(f32 a);
+[[nodiscard]] ANTON_MATH_CONSTEXPR f32 sign(f32 a);
 
-[[nodiscard]] f32 sin(f32 angle);
+[[nodiscard]] ANTON_MATH_CONSTEXPR f32 sin(f32 angle);
 
-[[nodiscard]] f32 asin(f32 angle);
+[[nodiscard]] ANTON_MATH_CONSTEXPR f32 asin(f32 angle);
 
-[[nodiscard]] f32 cos(f32 angle);
+[[nodiscard]] ANTON_MATH_CONSTEXPR f32 cos(f32 angle);
 
-[[nodiscard]] f32 acos(f32 angle);
+[[nodiscard]] ANTON_MATH_CONSTEXPR f32 acos(f32 angle);
 
-[[nodiscard]] f32 tan(f32 angle);
+// Sin_Cos
+// The sine and the cosine of an angle.
+//
+struct Sin_Cos {
+  f32 sin;
+  f32 cos;
+};
+
+// sincos
+// Computes the sine and the cosine of angle sharing the range reduction. The
+// results are within 2 ULP of the exact values. Angles with |angle| >= 65536
+// and non-finite angles are forwarded to sin and cos.
+//
+[[nodiscard]] ANTON_MATH_CONSTEXPR Sin_Cos sincos(f32 angle);
+
+[[nodiscard]] ANTON_MATH_CONSTEXPR f32 tan(f32 angle);
 
-[[nodiscard]] f32 atan(f32 angle);
+[[nodiscard]] ANTON_MATH_CONSTEXPR f32 atan(f32 angle);
 
-[[nodiscard]] f32 atan2(f32 y, f32 x);
+[[nodiscard]] ANTON_MATH_CONSTEXPR f32 atan2(f32 y, f32 x);
 
 // exp
 // Calculate e^n
 //
-[[nodiscard]] f32 exp(f32 n);
+[[nodiscard]] ANTON_MATH_CONSTEXPR f32 exp(f32 n);
 
 // log
 // Compute natural logarithm (base-e).
 //
-[[nodiscard]] f32 log(f32 v);
+[[nodiscard]] ANTON_MATH_CONSTEXPR f32 log(f32 v);
 
 // log10
 // Compute base-10 logarithm.
 //
-[[nodiscard]] f32 log10(f32 v);
+[[nodiscard]] ANTON_MATH_CONSTEXPR f32 log10(f32 v);
 
 // log2
 // Compute base-2 logarithm.
 //
-[[nodiscard]] f32 log2(f32 v);
+[[nodiscard]] ANTON_MATH_CONSTEXPR f32 log2(f32 v);
 
 // ilog2
 // Computes the floor of logarithm base 2 of v.
 //
-[[nodiscard]] u32 ilog2(u32 v);
+[[nodiscard]] ANTON_MATH_FUNCTION u32 ilog2(u32 v);
 
-[[nodiscard]] u64 ilog2(u64 v);
+[[nodiscard]] ANTON_MATH_FUNCTION u64 ilog2(u64 v);
 
 // ilog10
 // Computes the floor of logarithm base 10 of v.
 // Returns 0 for ilog10(0).
 //
-[[nodiscard]] u64 ilog10(u64 v);
+[[nodiscard]] ANTON_MATH_FUNCTION u64 ilog10(u64 v);
 
 // mod
 // Computes the floating point remainder of the operation x/y.
 // The result has the same sign as x.
 //
-[[nodiscard]] f32 mod(f32 x, f32 y);
+[[nodiscard]] ANTON_MATH_FUNCTION f32 mod(f32 x, f32 y);
 
-[[nodiscard]] f32 round(f32 x);
+[[nodiscard]] ANTON_MATH_FUNCTION f32 round(f32 x);
 
 // round_to_nearest
 // Rounds x to the nearest multiple of b.
 // b must be positive.
 //
-[[nodiscard]] f32 round_to_nearest(f32 x, f32 b);
+[[nodiscard]] ANTON_MATH_FUNCTION f32 round_to_nearest(f32 x, f32 b);
 
-[[nodiscard]] f32 floor(f32 x);
+[[nodiscard]] ANTON_MATH_FUNCTION f32 floor(f32 x);
 
-[[nodiscard]] f32 ceil(f32 x);
+[[nodiscard]] ANTON_MATH_FUNCTION f32 ceil(f32 x);
 
-[[nodiscard]] f32 fract(f32 x);
+[[nodiscard]] ANTON_MATH_FUNCTION f32 fract(f32 x);
 
 template <typename T> [[nodiscard]] constexpr T abs(T const a) {
   return a < T(0) ? -a : a;
@@ -179,19 +195,19 @@ template <typename T>
 // is_almost_zero
 // Determines whether the value is almost equal to 0 within given tolerance.
 //
-[[nodiscard]] bool is_almost_zero(f32 value, f32 tolerance = 0.000001f);
+[[nodiscard]] ANTON_MATH_CONSTEXPR bool is_almost_zero(f32 value, f32 tolerance = 0.000001f);
 
-[[nodiscard]] f32 step_to_value(f32 current, f32 target, f32 change);
+[[nodiscard]] ANTON_MATH_CONSTEXPR f32 step_to_value(f32 current, f32 target, f32 change);
 
 // lerp
 // Computes the linear interpolation between a and b for the parameter t in the
 // interval [0, 1].
 //
-[[nodiscard]] f32 lerp(f32 a, f32 b, f32 t);
+[[nodiscard]] ANTON_MATH_CONSTEXPR f32 lerp(f32 a, f32 b, f32 t);
 
 // smoothstep
 //
-[[nodiscard]] f32 smoothstep(f32 edge0, f32 edge1, f32 x);
+[[nodiscard]] ANTON_MATH_CONSTEXPR f32 smoothstep(f32 edge0, f32 edge1, f32 x);
 
 // smootherstep
 // Improved version of smoothstep that has zero 1st and 2nd order derivatives at
@@ -200,7 +216,7 @@ template <typename T>
 // Returns 0 if x <= edge0, 1 if x >= edge1, otherwise computes 6x^5 - 15x^4 +
 // 10x^3 with x rescaled to range [0.0, 1.0].
 //
-[[nodiscard]] f32 smootherstep(f32 edge0, f32 edge1, f32 x);
+[[nodiscard]] ANTON_MATH_CONSTEXPR f32 smootherstep(f32 edge0, f32 edge1, f32 x);
 
 // popcount
 // Counts the number of set bits in v.
@@ -295,3 +311,7 @@ template <typename T>
 #endif
 }
 } // namespace anton::math
+
+#if ANTON_MATH_INLINE
+#  include <anton/math/detail/math_impl.hpp>
+#endif
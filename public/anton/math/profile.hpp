@@ -0,0 +1,161 @@
+#pragma once
+
+#include <anton/types.hpp>
+#include <anton/math/detail/config.hpp>
+
+// Hardware performance counters of the array kernels.
+//
+// When the library is built with ANTON_MATH_PROFILE, every invocation of an array
+// kernel is counted and, on Linux, measured with the performance counters of the
+// processor via perf_event_open. The counters are opened once per thread on the first
+// measurement and count user-mode events of the calling thread only. Each measurement
+// costs two system calls, hence the instrumented kernels are noticeably slower on
+// small arrays and the library must not be profiled when benchmarking latency.
+//
+// Without ANTON_MATH_PROFILE the kernels are not instrumented, the profiles remain
+// zero and read_perf_counters returns zeros.
+//
+namespace anton::math {
+    // Perf_Counters
+    // User-mode events counted by the processor.
+    //
+    struct Perf_Counters {
+        u64 cycles = 0;
+        u64 instructions = 0;
+        // Last level cache misses.
+        u64 cache_misses = 0;
+        // Mispredicted branches.
+        u64 branch_misses = 0;
+    };
+
+    [[nodiscard]] Perf_Counters operator+(Perf_Counters const& lhs, Perf_Counters const& rhs);
+    [[nodiscard]] Perf_Counters operator-(Perf_Counters const& lhs, Perf_Counters const& rhs);
+
+    // Kernel
+    // The array kernels shared by the functions in batch.hpp, blend.hpp, clip.hpp,
+    // hierarchy.hpp, quat_array.hpp, soa.hpp, track.hpp, vec3_array.hpp and
+    // vec4_array.hpp. The functions of each group below share a single kernel.
+    //
+    enum struct Kernel : u8 {
+        // multiply(Mat4 const*, Mat4 const*, Mat4*, i64), compute_world_transforms and
+        // update_world_transforms (hierarchy.hpp).
+        mat4_multiply,
+        // multiply(Mat4 const&, Mat4 const*, Mat4*, i64)
+        mat4_multiply_lhs,
+        // multiply(Mat4 const*, Mat4 const&, Mat4*, i64)
+        mat4_multiply_rhs,
+        // inverse(Mat4 const*, Mat4*, i64)
+        mat4_inverse,
+        // inverse_affine(Mat4 const*, Mat4*, i64)
+        mat4_inverse_affine,
+        // inverse_rigid(Mat4 const*, Mat4*, i64)
+        mat4_inverse_rigid,
+        // compose(TRS const*, Mat4*, i64), the propagation of TRS (hierarchy.hpp) and
+        // sample of Compressed_Clip to matrices (clip.hpp).
+        trs_compose_mat4,
+        // compose(TRS const*, Affine3*, i64)
+        trs_compose_affine3,
+        // decompose(Mat4 const*, TRS*, i64)
+        trs_decompose,
+        // transform_points
+        transform_points,
+        // transform_directions
+        transform_directions,
+        // transform_points_projective
+        transform_points_projective,
+        // transform(Mat4 const&, Vec4 const*, Vec4*, i64)
+        transform_vec4,
+        // skin
+        dual_quat_skin,
+        // Componentwise +, -, *, /, min and max of SoA vectors and arrays.
+        // Elements are floats.
+        soa_elementwise,
+        // Componentwise +, -, *, / with a scalar of SoA vectors and arrays and conjugate
+        // of Quat_Array. Elements are floats.
+        soa_elementwise_scalar,
+        // lerp of SoA vectors and arrays. Elements are floats.
+        soa_lerp,
+        // sample of Vec3_Track arrays (track.hpp). Elements are floats.
+        soa_lerp_varying,
+        // dot of SoA vectors and arrays.
+        soa_dot,
+        // length of SoA vectors and arrays.
+        soa_length,
+        // normalize of SoA vectors, arrays and Quat_Array.
+        soa_normalize,
+        // cross of SoA vectors and arrays.
+        soa_cross,
+        // multiply of Quat_Array (quat_array.hpp).
+        soa_quat_multiply,
+        // rotate(Quat_Array const&, Vec3_Array const&, Vec3_Array&).
+        soa_quat_rotate,
+        // rotate(Quat const&, Vec3_Array const&, Vec3_Array&).
+        soa_transform_directions,
+        // slerp of Quat_Array and Vec3_Array (blend.hpp).
+        soa_slerp,
+        // sample of Quat_Track arrays (track.hpp).
+        soa_slerp_varying,
+        // blend (blend.hpp).
+        soa_blend,
+        // Conversions from arrays of structures to SoA vectors and arrays.
+        aos_to_soa,
+        // Conversions from SoA vectors and arrays to arrays of structures.
+        soa_to_aos,
+        // sin, cos, tan, asin, acos, atan, exp, log and log2 of arrays.
+        unary_function,
+        // atan2 and pow of arrays.
+        binary_function,
+        // sincos of arrays.
+        sincos,
+    };
+
+    constexpr i64 kernel_count = static_cast<i64>(Kernel::sincos) + 1;
+
+    // get_kernel_name
+    //
+    // Returns:
+    // Null-terminated lowercase name of kernel.
+    //
+    [[nodiscard]] char const* get_kernel_name(Kernel kernel);
+
+    // Kernel_Profile
+    // Accumulated measurements of a kernel since the start of the program or the last
+    // call to reset_kernel_profiles. elements is the sum of the counts of elements
+    // that the kernel has been invoked with. Divide counters by elements to obtain the
+    // events per element.
+    //
+    struct Kernel_Profile {
+        i64 calls = 0;
+        i64 elements = 0;
+        Perf_Counters counters;
+    };
+
+    // is_profiling_available
+    // Checks whether the library has been built with ANTON_MATH_PROFILE and the
+    // performance counters could be opened on the calling thread. Opening the counters
+    // might fail when the processor does not expose them (e.g. in virtual machines) or
+    // when perf_event_paranoid forbids unprivileged access.
+    //
+    [[nodiscard]] bool is_profiling_available();
+
+    // read_perf_counters
+    // Reads the performance counters of the calling thread. The difference of two
+    // reads measures the code executed between them, which allows measuring code
+    // outside of the library in the same units as the kernels.
+    //
+    // Returns:
+    // The current values of the counters or zeros if profiling is not available.
+    //
+    [[nodiscard]] Perf_Counters read_perf_counters();
+
+    // get_kernel_profile
+    // Accumulated measurements of kernel over all threads.
+    //
+    [[nodiscard]] Kernel_Profile get_kernel_profile(Kernel kernel);
+
+    // reset_kernel_profiles
+    // Zeroes the profiles of all kernels. Must not be called while any array kernel is
+    // executing.
+    //
+    void reset_kernel_profiles();
+} // namespace anton::math
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <anton/types.hpp>
+#include <anton/math/detail/config.hpp>
 #include <anton/math/vec3.hpp>
 #include <anton/math/vec4.hpp>
 
@@ -16,7 +17,7 @@ namespace anton::math {
         // axis - normalized axis of rotation.
         // angle - angle of rotation in radians.
         //
-        [[nodiscard]] static Quat from_axis_angle(Vec3 const axis, f32 const angle);
+        [[nodiscard]] static ANTON_MATH_CONSTEXPR Quat from_axis_angle(Vec3 const axis, f32 const angle);
 
         f32 x = 0;
         f32 y = 0;
@@ -24,55 +25,57 @@ namespace anton::math {
         f32 w = 1;
 
         Quat() = default;
-        Quat(f32 x, f32 y, f32 z, f32 w);
+        constexpr Quat(f32 x, f32 y, f32 z, f32 w): x(x), y(y), z(z), w(w) {}
 
-        [[nodiscard]] f32* data();
-        [[nodiscard]] f32 const* data() const;
+        [[nodiscard]] ANTON_MATH_CONSTEXPR f32* data();
+        [[nodiscard]] ANTON_MATH_CONSTEXPR f32 const* data() const;
     };
 
-    [[nodiscard]] Quat operator-(Quat const& q);
-    [[nodiscard]] Quat operator+(Quat const& q1, Quat const& q2);
-    [[nodiscard]] Quat operator-(Quat const& q1, Quat const& q2);
+    inline constexpr Quat const Quat::identity = Quat(0, 0, 0, 1);
+
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Quat operator-(Quat const& q);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Quat operator+(Quat const& q1, Quat const& q2);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Quat operator-(Quat const& q1, Quat const& q2);
 
     // Hamilton Product
     //
-    [[nodiscard]] Quat operator*(Quat const& p, Quat const& q);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Quat operator*(Quat const& p, Quat const& q);
 
     // operator*
     // Performs rotation of v by q.
     //
-    Vec3 operator*(Quat const& q, Vec3 const& v);
+    ANTON_MATH_CONSTEXPR Vec3 operator*(Quat const& q, Vec3 const& v);
 
     // operator*
     // Performs rotation of v by q.
     //
-    Vec4 operator*(Quat const& q, Vec4 const& v);
+    ANTON_MATH_CONSTEXPR Vec4 operator*(Quat const& q, Vec4 const& v);
 
-    [[nodiscard]] Quat operator*(Quat const& q, f32 a);
-    [[nodiscard]] Quat operator/(Quat const& q, f32 a);
-    [[nodiscard]] f32 length_squared(Quat const& q);
-    [[nodiscard]] f32 length(Quat const& q);
-    [[nodiscard]] Quat normalize(Quat const& q);
-    [[nodiscard]] Quat conjugate(Quat const& q);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Quat operator*(Quat const& q, f32 a);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Quat operator/(Quat const& q, f32 a);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR f32 length_squared(Quat const& q);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR f32 length(Quat const& q);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Quat normalize(Quat const& q);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Quat conjugate(Quat const& q);
 
     // inverse
     // Calculates the multiplicative inverse of q. q must be non-zero.
     // If q is normalized, this function returns the same result as conjugate.
     //
-    [[nodiscard]] Quat inverse(Quat const& q);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Quat inverse(Quat const& q);
 
     // orient_towards
     // Constructs a unit quaternion that orients an object towards target from 
     // its inital orientation towards start.
     // start and target must be unit vectors.
     //
-    [[nodiscard]] Quat orient_towards(Vec3 const start, Vec3 const target);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Quat orient_towards(Vec3 const start, Vec3 const target);
 
     // slerp
     // Computes the spherical interpolation between a and b for the parameter t in the interval [0, 1].
     // Both a and b must be unit quaternions.
     //
-    [[nodiscard]] Quat slerp(Quat const& a, Quat const& b, f32 t);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Quat slerp(Quat const& a, Quat const& b, f32 t);
 
     struct Axis_Angle {
         Vec3 axis;
@@ -89,7 +92,11 @@ namespace anton::math {
     // Axis-angle representation of the quaternion. 
     // The axis is normalized. The angle is in radians.
     //
-    [[nodiscard]] Axis_Angle to_axis_angle(Quat const& q);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Axis_Angle to_axis_angle(Quat const& q);
 
-    void swap(Quat& q1, Quat& q2);
+    ANTON_MATH_CONSTEXPR void swap(Quat& q1, Quat& q2);
 } // namespace anton::math
+
+#if ANTON_MATH_INLINE
+#    include <anton/math/detail/quat_impl.hpp>
+#endif
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <anton/types.hpp>
+#include <anton/math/quat.hpp>
+#include <anton/math/vec3_array.hpp>
+
+namespace anton::math {
+    // Quat_Array
+    // Array of Quat stored as a structure of arrays. The x, y, z and w components are
+    // stored in separate arrays aligned to 64 bytes, hence the array functions below
+    // process full SIMD registers of each component.
+    //
+    struct Quat_Array {
+    public:
+        Quat_Array();
+        // Constructs an array of size identity quaternions.
+        explicit Quat_Array(i64 size);
+        Quat_Array(Quat_Array const& other);
+        Quat_Array(Quat_Array&& other);
+        ~Quat_Array();
+        Quat_Array& operator=(Quat_Array const& other);
+        Quat_Array& operator=(Quat_Array&& other);
+
+        [[nodiscard]] i64 size() const;
+
+        // resize
+        // Changes the size of the array. New quaternions are the identity.
+        //
+        void resize(i64 size);
+
+        // Arrays of size floats holding the components of the quaternions.
+        [[nodiscard]] f32* x();
+        [[nodiscard]] f32 const* x() const;
+        [[nodiscard]] f32* y();
+        [[nodiscard]] f32 const* y() const;
+        [[nodiscard]] f32* z();
+        [[nodiscard]] f32 const* z() const;
+        [[nodiscard]] f32* w();
+        [[nodiscard]] f32 const* w() const;
+
+        [[nodiscard]] Quat get(i64 index) const;
+        void set(i64 index, Quat const& q);
+
+    private:
+        // The components are stored one after another, each consisting of _capacity floats.
+        f32* _data;
+        i64 _size;
+        i64 _capacity;
+    };
+
+    // The functions below operate on arrays of equal size. out must have the same size
+    // as the inputs and may be one of them.
+
+    // multiply
+    // out[i] = a[i] * b[i], the Hamilton product.
+    //
+    void multiply(Quat_Array const& a, Quat_Array const& b, Quat_Array& out);
+
+    // conjugate
+    // out[i] = conjugate(q[i]).
+    //
+    void conjugate(Quat_Array const& q, Quat_Array& out);
+
+    // normalize
+    // out[i] = normalize(q[i]). Zero quaternions remain zero.
+    //
+    void normalize(Quat_Array const& q, Quat_Array& out);
+
+    // rotate
+    // out[i] = q[i] * v[i]. The quaternions must be unit quaternions.
+    //
+    void rotate(Quat_Array const& q, Vec3_Array const& v, Vec3_Array& out);
+
+    // rotate
+    // out[i] = q * v[i]. The rotation matrix of q is computed once for all vectors.
+    // q must be a unit quaternion.
+    //
+    void rotate(Quat const& q, Vec3_Array const& v, Vec3_Array& out);
+} // namespace anton::math
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <anton/types.hpp>
+#include <anton/math/mat4.hpp>
+#include <anton/math/quat.hpp>
+#include <anton/math/quat_array.hpp>
+#include <anton/math/vec3.hpp>
+#include <anton/math/vec3_array.hpp>
+#include <anton/math/vec4.hpp>
+#include <anton/math/vec4_array.hpp>
+
+// Conversions between arrays of structures (Vec3, Vec4, Quat, Mat4) and structures of
+// arrays holding each component in a separate array of floats. The conversions are
+// performed with the shuffle based transposition kernels of the instruction set selected
+// in dispatch.hpp. The input and the output must not overlap.
+
+namespace anton::math {
+    // to_soa
+    // Transposes count vectors into the component arrays. Equivalent to x[i] = in[i].x,
+    // y[i] = in[i].y and so on.
+    //
+    void to_soa(Vec3 const* in, f32* x, f32* y, f32* z, i64 count);
+    void to_soa(Vec4 const* in, f32* x, f32* y, f32* z, f32* w, i64 count);
+    void to_soa(Quat const* in, f32* x, f32* y, f32* z, f32* w, i64 count);
+
+    // to_soa
+    // Transposes count matrices into 16 element arrays. Equivalent to
+    // out[4 * column + row][i] = in[i][column][row].
+    //
+    // Parameters:
+    // in - array of count matrices.
+    // out - array of 16 pointers to arrays of count floats.
+    // count - the number of matrices. May be 0.
+    //
+    void to_soa(Mat4 const* in, f32* const* out, i64 count);
+
+    // to_soa
+    // Transposes out.size() vectors from in into out.
+    //
+    void to_soa(Vec3 const* in, Vec3_Array& out);
+    void to_soa(Vec4 const* in, Vec4_Array& out);
+    void to_soa(Quat const* in, Vec4_Array& out);
+    void to_soa(Quat const* in, Quat_Array& out);
+
+    // to_aos
+    // Inverse of to_soa. Equivalent to out[i] = {x[i], y[i], ...}.
+    //
+    void to_aos(f32 const* x, f32 const* y, f32 const* z, Vec3* out, i64 count);
+    void to_aos(f32 const* x, f32 const* y, f32 const* z, f32 const* w, Vec4* out, i64 count);
+    void to_aos(f32 const* x, f32 const* y, f32 const* z, f32 const* w, Quat* out, i64 count);
+
+    // to_aos
+    // Inverse of to_soa. Equivalent to out[i][column][row] = in[4 * column + row][i].
+    //
+    // Parameters:
+    // in - array of 16 pointers to arrays of count floats.
+    // out - array of count matrices.
+    // count - the number of matrices. May be 0.
+    //
+    void to_aos(f32 const* const* in, Mat4* out, i64 count);
+
+    // to_aos
+    // Transposes in.size() vectors from in into out.
+    //
+    void to_aos(Vec3_Array const& in, Vec3* out);
+    void to_aos(Vec4_Array const& in, Vec4* out);
+    void to_aos(Vec4_Array const& in, Quat* out);
+    void to_aos(Quat_Array const& in, Quat* out);
+} // namespace anton::math
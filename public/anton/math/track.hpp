@@ -0,0 +1,146 @@
+#pragma once
+
+#include <anton/types.hpp>
+#include <anton/math/blend.hpp>
+#include <anton/math/quat.hpp>
+#include <anton/math/vec3.hpp>
+
+namespace anton::math {
+    struct Quat_Array;
+    struct Vec3_Array;
+
+    // Quat_Track
+    // Keyframe track of rotations. The rotation between 2 keys is interpolated with
+    // slerp, before the first key and after the last key it is constant. An empty
+    // track is the identity at all times.
+    //
+    struct Quat_Track {
+    public:
+        // Constructs an empty track.
+        Quat_Track();
+        // Parameters:
+        // times - array of count strictly increasing times of the keys.
+        // keys - array of count unit quaternions.
+        // count - the number of keys. May be 0.
+        //
+        Quat_Track(f32 const* times, Quat const* keys, i64 count);
+        Quat_Track(Quat_Track const& other);
+        Quat_Track(Quat_Track&& other);
+        ~Quat_Track();
+        Quat_Track& operator=(Quat_Track const& other);
+        Quat_Track& operator=(Quat_Track&& other);
+
+        // size
+        // The number of keys.
+        //
+        [[nodiscard]] i64 size() const;
+
+        [[nodiscard]] f32 const* get_times() const;
+        [[nodiscard]] Quat const* get_keys() const;
+
+    private:
+        f32* _times;
+        Quat* _keys;
+        i64 _size;
+    };
+
+    // Vec3_Track
+    // Keyframe track of translations or scales. The value between 2 keys is
+    // interpolated with lerp, before the first key and after the last key it is
+    // constant. An empty track is zero at all times.
+    //
+    struct Vec3_Track {
+    public:
+        // Constructs an empty track.
+        Vec3_Track();
+        // Parameters:
+        // times - array of count strictly increasing times of the keys.
+        // keys - array of count values.
+        // count - the number of keys. May be 0.
+        //
+        Vec3_Track(f32 const* times, Vec3 const* keys, i64 count);
+        Vec3_Track(Vec3_Track const& other);
+        Vec3_Track(Vec3_Track&& other);
+        ~Vec3_Track();
+        Vec3_Track& operator=(Vec3_Track const& other);
+        Vec3_Track& operator=(Vec3_Track&& other);
+
+        // size
+        // The number of keys.
+        //
+        [[nodiscard]] i64 size() const;
+
+        [[nodiscard]] f32 const* get_times() const;
+        [[nodiscard]] Vec3 const* get_keys() const;
+
+    private:
+        f32* _times;
+        Vec3* _keys;
+        i64 _size;
+    };
+
+    // Sampling
+    //
+    // The samplers locate the keys surrounding time starting from a cursor, which is the
+    // index of the key preceding the previously sampled time. A cursor belongs to a
+    // single playing instance of a track and must be initialized to 0. When time moves
+    // forward by less than a few keys since the previous sample, e.g. during playback,
+    // the keys are found in constant time. Otherwise they are found with a binary
+    // search. Looping and other mappings of the playback time are the concern of the
+    // caller.
+
+    // sample
+    // Samples the track at time, which is slerp(keys[k], keys[k + 1], t) where
+    // times[k] <= time < times[k + 1] and t = (time - times[k]) / (times[k + 1] - times[k]).
+    //
+    // Parameters:
+    // track - the track to sample.
+    // time - the time to sample the track at.
+    // cursor - the cursor of the instance. Updated to the index of the key preceding
+    //          time.
+    //
+    [[nodiscard]] Quat sample(Quat_Track const& track, f32 time, i64& cursor);
+
+    // sample
+    // Samples the track at time, which is lerp(keys[k], keys[k + 1], t) where
+    // times[k] <= time < times[k + 1] and t = (time - times[k]) / (times[k + 1] - times[k]).
+    //
+    // Parameters:
+    // track - the track to sample.
+    // time - the time to sample the track at.
+    // cursor - the cursor of the instance. Updated to the index of the key preceding
+    //          time.
+    //
+    [[nodiscard]] Vec3 sample(Vec3_Track const& track, f32 time, i64& cursor);
+
+    // sample
+    // Samples count tracks at time into an array, e.g. the rotations of the bones of a
+    // skeleton. The keys are located per track and interpolated with the array kernels.
+    // The tracks are split across the executor (executor.hpp) when there are enough of
+    // them.
+    //
+    // Parameters:
+    // tracks - array of count tracks.
+    // count - the number of tracks.
+    // time - the time to sample the tracks at.
+    // method - the evaluation of slerp (blend.hpp).
+    // cursors - array of count cursors of the tracks.
+    // out - array of count quaternions to write the samples to.
+    //
+    void sample(Quat_Track const* tracks, i64 count, f32 time, Slerp_Method method, i64* cursors, Quat_Array& out);
+
+    // sample
+    // Samples count tracks at time into an array, e.g. the translations of the bones
+    // of a skeleton. The keys are located per track and interpolated with the array
+    // kernels. The tracks are split across the executor (executor.hpp) when there are
+    // enough of them.
+    //
+    // Parameters:
+    // tracks - array of count tracks.
+    // count - the number of tracks.
+    // time - the time to sample the tracks at.
+    // cursors - array of count cursors of the tracks.
+    // out - array of count vectors to write the samples to.
+    //
+    void sample(Vec3_Track const* tracks, i64 count, f32 time, i64* cursors, Vec3_Array& out);
+} // namespace anton::math
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <anton/types.hpp>
+#include <anton/math/detail/config.hpp>
 #include <anton/math/mat4.hpp>
 #include <anton/math/quat.hpp>
 #include <anton/math/vec3.hpp>
@@ -15,7 +16,7 @@ namespace anton::math {
     // Returns:
     // Transformation matrix that translates by the translation vector.
     //
-    [[nodiscard]] Mat4 translate(Vec3 translation);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Mat4 translate(Vec3 translation);
 
     // rotate
     // Constructs a rotation matrix that performs rotation by quaternion q.
@@ -26,7 +27,7 @@ namespace anton::math {
     // Returns:
     // Transformation matrix that rotates by q.
     //
-    [[nodiscard]] Mat4 rotate(Quat q);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Mat4 rotate(Quat q);
 
     // rotate_x
     // Constructs a rotation matrix that performs rotation about x axis by angle.
@@ -37,7 +38,7 @@ namespace anton::math {
     // Returns:
     // Transformation matrix that rotates about x by angle.
     //
-    [[nodiscard]] Mat4 rotate_x(f32 angle);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Mat4 rotate_x(f32 angle);
 
     // rotate_y
     // Constructs a rotation matrix that performs rotation about y axis by angle.
@@ -48,7 +49,7 @@ namespace anton::math {
     // Returns:
     // Transformation matrix that rotates about y by angle.
     //
-    [[nodiscard]] Mat4 rotate_y(f32 angle);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Mat4 rotate_y(f32 angle);
 
     // rotate_z
     // Constructs a rotation matrix that performs rotation about z axis by angle.
@@ -59,7 +60,7 @@ namespace anton::math {
     // Returns:
     // Transformation matrix that rotates about z by angle.
     //
-    [[nodiscard]] Mat4 rotate_z(f32 angle);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Mat4 rotate_z(f32 angle);
 
     // scale
     // Constructs a non-uniform scale transform.
@@ -70,7 +71,7 @@ namespace anton::math {
     // Returns:
     // Non-uniform scale transformation matrix.
     //
-    [[nodiscard]] Mat4 scale(Vec3 scale);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Mat4 scale(Vec3 scale);
 
     // scale
     // Construct a uniform scale tansform.
@@ -81,17 +82,17 @@ namespace anton::math {
     // Returns:
     // Uniform scale transformation matrix.
     //
-    [[nodiscard]] Mat4 scale(f32 scale);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Mat4 scale(f32 scale);
 
     // orthographic_rh
     // Calculates orthographic projection mat to [-1, 1] clip space for right-handed coordinate system.
     //
-    [[nodiscard]] Mat4 orthographic_rh(f32 left, f32 right, f32 bottom, f32 top, f32 near, f32 far);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Mat4 orthographic_rh(f32 left, f32 right, f32 bottom, f32 top, f32 near, f32 far);
 
     // orthographic_lh
     // Calculates orthographic projection mat to [-1, 1] clip space for left-handed coordinate system.
     //
-    [[nodiscard]] Mat4 orthographic_lh(f32 left, f32 right, f32 bottom, f32 top, f32 near, f32 far);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Mat4 orthographic_lh(f32 left, f32 right, f32 bottom, f32 top, f32 near, f32 far);
 
     // perspective_rh
     // Calculates perspective projection mat to [-1, 1] clip space for right-handed coordinate system.
@@ -102,7 +103,7 @@ namespace anton::math {
     // near         - position of near plane.
     // far          - position of the far plane.
     //
-    [[nodiscard]] Mat4 perspective_rh(f32 fov, f32 aspect_ratio, f32 near, f32 far);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Mat4 perspective_rh(f32 fov, f32 aspect_ratio, f32 near, f32 far);
 
     // perspective_rh_zo
     // Calculates perspective projection mat to [0, 1] clip space for right-handed coordinate system.
@@ -113,7 +114,7 @@ namespace anton::math {
     // near         - position of near plane.
     // far          - position of the far plane.
     //
-    [[nodiscard]] Mat4 perspective_rh_zo(f32 fov, f32 aspect_ratio, f32 near, f32 far);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Mat4 perspective_rh_zo(f32 fov, f32 aspect_ratio, f32 near, f32 far);
 
     // perspective_lh
     // Calculates perspective projection mat to [-1, 1] clip space for left-handed coordinate system.
@@ -124,7 +125,7 @@ namespace anton::math {
     // near         - position of near plane.
     // far          - position of the far plane.
     //
-    [[nodiscard]] Mat4 perspective_lh(f32 fov, f32 aspect_ratio, f32 near, f32 far);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Mat4 perspective_lh(f32 fov, f32 aspect_ratio, f32 near, f32 far);
 
     // lookat_rh
     // Calculates the view mat for looking at a point for right-handed coordinate systems.
@@ -133,17 +134,52 @@ namespace anton::math {
     // center - point to look at.
     // up - orients the resulting view to have this vec as "up".
     //
-    [[nodiscard]] Mat4 lookat_rh(Vec3 const& eye, Vec3 const& center, Vec3 const& up);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Mat4 lookat_rh(Vec3 const& eye, Vec3 const& center, Vec3 const& up);
 
-    struct Decomposed_Mat {
+    // inverse_affine
+    // Computes the inverse of an affine transformation, i.e. a matrix whose last row is
+    // (0, 0, 0, 1), by inverting the upper 3x3 block and transforming the negated
+    // translation by it. Cheaper and more precise than inverse for such matrices.
+    // The last row of m is assumed to be (0, 0, 0, 1) and is not read.
+    //
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Mat4 inverse_affine(Mat4 const& m);
+
+    // inverse_rigid
+    // Computes the inverse of a rigid transformation, i.e. a composition of a rotation and
+    // a translation, by transposing the rotation and rotating the negated translation.
+    // The upper 3x3 block of m must be orthonormal and the last row of m is assumed to be
+    // (0, 0, 0, 1) and is not read.
+    //
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Mat4 inverse_rigid(Mat4 const& m);
+
+    // TRS
+    // Transformation that scales, then rotates and then translates. Default constructed
+    // TRS is the identity transformation.
+    //
+    struct TRS {
         Quat rotation;
         Vec3 translation;
-        Vec3 scale;
+        Vec3 scale = Vec3{1.0f};
     };
 
+    using Decomposed_Mat = TRS;
+
+    // compose
+    // Builds the transformation matrix of trs in a single pass.
+    // Equivalent to translate(trs.translation) * rotate(trs.rotation) * scale(trs.scale).
+    //
+    // Parameters:
+    // trs - the transformation. The rotation must be a unit quaternion.
+    //
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Mat4 compose(TRS const& trs);
+
     // decompose
     // Decomposes a simple transformation mat (translation, rotation, (non-uniform) scale)
     // into individual elements.
     //
-    [[nodiscard]] Decomposed_Mat decompose(Mat4 const& mat);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR TRS decompose(Mat4 const& mat);
 } // namespace anton::math
+
+#if ANTON_MATH_INLINE
+#    include <anton/math/detail/transform_impl.hpp>
+#endif
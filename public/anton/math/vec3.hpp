@@ -1,6 +1,7 @@
 #pragma once
 
 #include <anton/types.hpp>
+#include <anton/math/detail/config.hpp>
 
 namespace anton::math {
     struct Vec2;
@@ -22,57 +23,57 @@ namespace anton::math {
             f32 b;
         };
 
-        Vec3();
-        explicit Vec3(f32 v);
-        Vec3(f32 x, f32 y, f32 z);
-        explicit Vec3(Vec2 const& vec2, f32 z = 0.0f);
-        explicit Vec3(Vec4 const& vec4);
-        explicit Vec3(f32 const* const p);
+        constexpr Vec3(): x(0.0f), y(0.0f), z(0.0f) {}
+        explicit constexpr Vec3(f32 v): x(v), y(v), z(v) {}
+        constexpr Vec3(f32 x, f32 y, f32 z): x(x), y(y), z(z) {}
+        explicit ANTON_MATH_CONSTEXPR Vec3(Vec2 const& vec2, f32 z = 0.0f);
+        explicit ANTON_MATH_CONSTEXPR Vec3(Vec4 const& vec4);
+        explicit ANTON_MATH_CONSTEXPR Vec3(f32 const* const p);
 
-        [[nodiscard]] f32& operator[](i32 index);
-        [[nodiscard]] f32 const& operator[](i32 index) const;
+        [[nodiscard]] ANTON_MATH_CONSTEXPR f32& operator[](i32 index);
+        [[nodiscard]] ANTON_MATH_CONSTEXPR f32 const& operator[](i32 index) const;
 
-        [[nodiscard]] f32* data();
-        [[nodiscard]] f32 const* data() const;
+        [[nodiscard]] ANTON_MATH_CONSTEXPR f32* data();
+        [[nodiscard]] ANTON_MATH_CONSTEXPR f32 const* data() const;
     };
     
-    void swap(Vec3& a, Vec3& b);
+    ANTON_MATH_CONSTEXPR void swap(Vec3& a, Vec3& b);
 
-    [[nodiscard]] Vec3 operator-(Vec3 const& v);
-    Vec3& operator+=(Vec3& v, Vec3 const& a);
-    Vec3& operator-=(Vec3& v, Vec3 const& a);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Vec3 operator-(Vec3 const& v);
+    ANTON_MATH_CONSTEXPR Vec3& operator+=(Vec3& v, Vec3 const& a);
+    ANTON_MATH_CONSTEXPR Vec3& operator-=(Vec3& v, Vec3 const& a);
 
     // Componentwise multiply.
     //
-    Vec3& operator*=(Vec3& v, Vec3 const& a);
+    ANTON_MATH_CONSTEXPR Vec3& operator*=(Vec3& v, Vec3 const& a);
 
     // Componentwise divide.
     //
-    Vec3& operator/=(Vec3& v, Vec3 const& a);
+    ANTON_MATH_CONSTEXPR Vec3& operator/=(Vec3& v, Vec3 const& a);
 
-    Vec3& operator+=(Vec3& v, f32 a);
-    Vec3& operator-=(Vec3& v, f32 a);
-    Vec3& operator*=(Vec3& v, f32 a);
-    Vec3& operator/=(Vec3& v, f32 a);
+    ANTON_MATH_CONSTEXPR Vec3& operator+=(Vec3& v, f32 a);
+    ANTON_MATH_CONSTEXPR Vec3& operator-=(Vec3& v, f32 a);
+    ANTON_MATH_CONSTEXPR Vec3& operator*=(Vec3& v, f32 a);
+    ANTON_MATH_CONSTEXPR Vec3& operator/=(Vec3& v, f32 a);
 
-    [[nodiscard]] Vec3 operator+(Vec3 const& a, Vec3 const& b);
-    [[nodiscard]] Vec3 operator-(Vec3 const& a, Vec3 const& b);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Vec3 operator+(Vec3 const& a, Vec3 const& b);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Vec3 operator-(Vec3 const& a, Vec3 const& b);
 
     // Componentwise multiply.
     //
-    [[nodiscard]] Vec3 operator*(Vec3 const& a, Vec3 const& b);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Vec3 operator*(Vec3 const& a, Vec3 const& b);
 
     // Componentwise divide.
     //
-    [[nodiscard]] Vec3 operator/(Vec3 const& a, Vec3 const& b);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Vec3 operator/(Vec3 const& a, Vec3 const& b);
     
-    [[nodiscard]] Vec3 operator+(Vec3 const& a, f32 b);
-    [[nodiscard]] Vec3 operator-(Vec3 const& a, f32 b);
-    [[nodiscard]] Vec3 operator*(Vec3 const& a, f32 b);
-    [[nodiscard]] Vec3 operator*(f32 b, Vec3 const& a);
-    [[nodiscard]] Vec3 operator/(Vec3 const& a, f32 b);
-    [[nodiscard]] bool operator==(Vec3 const& a, Vec3 const& b);
-    [[nodiscard]] bool operator!=(Vec3 const& a, Vec3 const& b);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Vec3 operator+(Vec3 const& a, f32 b);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Vec3 operator-(Vec3 const& a, f32 b);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Vec3 operator*(Vec3 const& a, f32 b);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Vec3 operator*(f32 b, Vec3 const& a);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Vec3 operator/(Vec3 const& a, f32 b);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR bool operator==(Vec3 const& a, Vec3 const& b);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR bool operator!=(Vec3 const& a, Vec3 const& b);
 
     // max
     // Performs componentwise max on the components of the vectors.
@@ -80,7 +81,7 @@ namespace anton::math {
     // Returns:
     // Vec3 where each component is the max of the corresponding components in v1 and v2.
     //
-    [[nodiscard]] Vec3 max(Vec3 const& v1, Vec3 const& v2);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Vec3 max(Vec3 const& v1, Vec3 const& v2);
 
     // min
     // Performs componentwise min on the components of the vectors.
@@ -88,30 +89,30 @@ namespace anton::math {
     // Returns:
     // Vec3 where each component is the min of the corresponding components in v1 and v2.
     //
-    [[nodiscard]] Vec3 min(Vec3 const& v1, Vec3 const& v2);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Vec3 min(Vec3 const& v1, Vec3 const& v2);
 
-    [[nodiscard]] bool is_almost_zero(Vec3 const& v, f32 const tolerance = 0.000001f);
-    [[nodiscard]] f32 dot(Vec3 const& v1, Vec3 const& v2);
-    [[nodiscard]] Vec3 cross(Vec3 const& v1, Vec3 const& v2);
-    [[nodiscard]] f32 length_squared(Vec3 const& v);
-    [[nodiscard]] f32 length(Vec3 const& v);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR bool is_almost_zero(Vec3 const& v, f32 const tolerance = 0.000001f);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR f32 dot(Vec3 const& v1, Vec3 const& v2);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Vec3 cross(Vec3 const& v1, Vec3 const& v2);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR f32 length_squared(Vec3 const& v);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR f32 length(Vec3 const& v);
 
     // normalize
     // If vec is non-zero with given tolerance, returns normalized copy of the vec.
     // Otherwise returns zero vec.
     //
-    [[nodiscard]] Vec3 normalize(Vec3 vec, f32 tolerance = 0.000001f);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Vec3 normalize(Vec3 vec, f32 tolerance = 0.000001f);
 
     // lerp
     // Computes the linear interpolation between a and b for the parameter t in the interval [0, 1].
     //
-    [[nodiscard]] Vec3 lerp(Vec3 const& a, Vec3 const& b, f32 t);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Vec3 lerp(Vec3 const& a, Vec3 const& b, f32 t);
 
     // slerp
     // Computes the spherical interpolation between a and b for the parameter t in the interval [0, 1].
     // Both vectors a and b must be non-zero.
     //
-    [[nodiscard]] Vec3 slerp(Vec3 const& a, Vec3 const& b, f32 t);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Vec3 slerp(Vec3 const& a, Vec3 const& b, f32 t);
 
     // perpendicular
     // Generates a random perpendicular vector to v.
@@ -122,5 +123,9 @@ namespace anton::math {
     // Returns:
     // A normalized vector perpendicular to v.
     //
-    [[nodiscard]] Vec3 perpendicular(Vec3 const& v);
+    [[nodiscard]] ANTON_MATH_CONSTEXPR Vec3 perpendicular(Vec3 const& v);
 } // namespace anton::math
+
+#if ANTON_MATH_INLINE
+#    include <anton/math/detail/vec3_impl.hpp>
+#endif
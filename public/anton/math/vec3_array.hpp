@@ -0,0 +1,103 @@
+#pragma once
+
+#include <anton/types.hpp>
+#include <anton/math/vec3.hpp>
+
+namespace anton::math {
+    // Vec3_Array
+    // Array of Vec3 stored as a structure of arrays. The x, y and z components are
+    // stored in separate arrays aligned to 64 bytes, hence the array functions below
+    // process full SIMD registers of each component.
+    //
+    struct Vec3_Array {
+    public:
+        Vec3_Array();
+        // Constructs an array of size zero vectors.
+        explicit Vec3_Array(i64 size);
+        Vec3_Array(Vec3_Array const& other);
+        Vec3_Array(Vec3_Array&& other);
+        ~Vec3_Array();
+        Vec3_Array& operator=(Vec3_Array const& other);
+        Vec3_Array& operator=(Vec3_Array&& other);
+
+        [[nodiscard]] i64 size() const;
+
+        // resize
+        // Changes the size of the array. New vectors are zero.
+        //
+        void resize(i64 size);
+
+        // Arrays of size floats holding the components of the vectors.
+        [[nodiscard]] f32* x();
+        [[nodiscard]] f32 const* x() const;
+        [[nodiscard]] f32* y();
+        [[nodiscard]] f32 const* y() const;
+        [[nodiscard]] f32* z();
+        [[nodiscard]] f32 const* z() const;
+
+        [[nodiscard]] Vec3 get(i64 index) const;
+        void set(i64 index, Vec3 const& v);
+
+    private:
+        // The components are stored one after another, each consisting of _capacity floats.
+        f32* _data;
+        i64 _size;
+        i64 _capacity;
+    };
+
+    // The functions below operate on arrays of equal size. out must have the same size
+    // as the inputs and may be one of them.
+
+    // out[i] = a[i] + b[i]
+    void add(Vec3_Array const& a, Vec3_Array const& b, Vec3_Array& out);
+    // out[i] = a[i] - b[i]
+    void subtract(Vec3_Array const& a, Vec3_Array const& b, Vec3_Array& out);
+    // Componentwise multiply.
+    void multiply(Vec3_Array const& a, Vec3_Array const& b, Vec3_Array& out);
+    // Componentwise divide.
+    void divide(Vec3_Array const& a, Vec3_Array const& b, Vec3_Array& out);
+
+    // out[i] = a[i] + b
+    void add(Vec3_Array const& a, f32 b, Vec3_Array& out);
+    // out[i] = a[i] - b
+    void subtract(Vec3_Array const& a, f32 b, Vec3_Array& out);
+    // out[i] = a[i] * b
+    void multiply(Vec3_Array const& a, f32 b, Vec3_Array& out);
+    // out[i] = a[i] / b
+    void divide(Vec3_Array const& a, f32 b, Vec3_Array& out);
+
+    // out[i] = max(a[i], b[i])
+    void max(Vec3_Array const& a, Vec3_Array const& b, Vec3_Array& out);
+    // out[i] = min(a[i], b[i])
+    void min(Vec3_Array const& a, Vec3_Array const& b, Vec3_Array& out);
+
+    // dot
+    // out[i] = dot(a[i], b[i]). out must point to an array of a.size() floats.
+    //
+    void dot(Vec3_Array const& a, Vec3_Array const& b, f32* out);
+
+    // cross
+    // out[i] = cross(a[i], b[i]). out may be a or b.
+    //
+    void cross(Vec3_Array const& a, Vec3_Array const& b, Vec3_Array& out);
+
+    // length_squared
+    // out[i] = length_squared(a[i]). out must point to an array of a.size() floats.
+    //
+    void length_squared(Vec3_Array const& a, f32* out);
+
+    // length
+    // out[i] = length(a[i]). out must point to an array of a.size() floats.
+    //
+    void length(Vec3_Array const& a, f32* out);
+
+    // normalize
+    // out[i] = normalize(a[i], tolerance). out may be a.
+    //
+    void normalize(Vec3_Array const& a, Vec3_Array& out, f32 tolerance = 0.000001f);
+
+    // lerp
+    // out[i] = lerp(a[i], b[i], t). out may be a or b.
+    //
+    void lerp(Vec3_Array const& a, Vec3_Array const& b, f32 t, Vec3_Array& out);
+} // namespace anton::math
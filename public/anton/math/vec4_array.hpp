@@ -0,0 +1,100 @@
+#pragma once
+
+#include <anton/types.hpp>
+#include <anton/math/vec4.hpp>
+
+namespace anton::math {
+    // Vec4_Array
+    // Array of Vec4 stored as a structure of arrays. The x, y, z and w components are
+    // stored in separate arrays aligned to 64 bytes, hence the array functions below
+    // process full SIMD registers of each component.
+    //
+    struct Vec4_Array {
+    public:
+        Vec4_Array();
+        // Constructs an array of size zero vectors.
+        explicit Vec4_Array(i64 size);
+        Vec4_Array(Vec4_Array const& other);
+        Vec4_Array(Vec4_Array&& other);
+        ~Vec4_Array();
+        Vec4_Array& operator=(Vec4_Array const& other);
+        Vec4_Array& operator=(Vec4_Array&& other);
+
+        [[nodiscard]] i64 size() const;
+
+        // resize
+        // Changes the size of the array. New vectors are zero.
+        //
+        void resize(i64 size);
+
+        // Arrays of size floats holding the components of the vectors.
+        [[nodiscard]] f32* x();
+        [[nodiscard]] f32 const* x() const;
+        [[nodiscard]] f32* y();
+        [[nodiscard]] f32 const* y() const;
+        [[nodiscard]] f32* z();
+        [[nodiscard]] f32 const* z() const;
+        [[nodiscard]] f32* w();
+        [[nodiscard]] f32 const* w() const;
+
+        [[nodiscard]] Vec4 get(i64 index) const;
+        void set(i64 index, Vec4 const& v);
+
+    private:
+        // The components are stored one after another, each consisting of _capacity floats.
+        f32* _data;
+        i64 _size;
+        i64 _capacity;
+    };
+
+    // The functions below operate on arrays of equal size. out must have the same size
+    // as the inputs and may be one of them.
+
+    // out[i] = a[i] + b[i]
+    void add(Vec4_Array const& a, Vec4_Array const& b, Vec4_Array& out);
+    // out[i] = a[i] - b[i]
+    void subtract(Vec4_Array const& a, Vec4_Array const& b, Vec4_Array& out);
+    // Componentwise multiply.
+    void multiply(Vec4_Array const& a, Vec4_Array const& b, Vec4_Array& out);
+    // Componentwise divide.
+    void divide(Vec4_Array const& a, Vec4_Array const& b, Vec4_Array& out);
+
+    // out[i] = a[i] + b
+    void add(Vec4_Array const& a, f32 b, Vec4_Array& out);
+    // out[i] = a[i] - b
+    void subtract(Vec4_Array const& a, f32 b, Vec4_Array& out);
+    // out[i] = a[i] * b
+    void multiply(Vec4_Array const& a, f32 b, Vec4_Array& out);
+    // out[i] = a[i] / b
+    void divide(Vec4_Array const& a, f32 b, Vec4_Array& out);
+
+    // out[i] = max(a[i], b[i])
+    void max(Vec4_Array const& a, Vec4_Array const& b, Vec4_Array& out);
+    // out[i] = min(a[i], b[i])
+    void min(Vec4_Array const& a, Vec4_Array const& b, Vec4_Array& out);
+
+    // dot
+    // out[i] = dot(a[i], b[i]). out must point to an array of a.size() floats.
+    //
+    void dot(Vec4_Array const& a, Vec4_Array const& b, f32* out);
+
+    // length_squared
+    // out[i] = length_squared(a[i]). out must point to an array of a.size() floats.
+    //
+    void length_squared(Vec4_Array const& a, f32* out);
+
+    // length
+    // out[i] = length(a[i]). out must point to an array of a.size() floats.
+    //
+    void length(Vec4_Array const& a, f32* out);
+
+    // normalize
+    // out[i] = normalize(a[i], tolerance). out may be a.
+    //
+    void normalize(Vec4_Array const& a, Vec4_Array& out, f32 tolerance = 0.000001f);
+
+    // lerp
+    // out[i] = lerp(a[i], b[i], t). out may be a or b.
+    //
+    void lerp(Vec4_Array const& a, Vec4_Array const& b, f32 t, Vec4_Array& out);
+} // namespace anton::math
@@ -0,0 +1,1722 @@
+// Accuracy harness of anton_math.
+//
+// Evaluates the functions of the library over dense (or, with --exhaustive, all)
+// f32 inputs of their domains and compares the results against double precision
+// references. For every case the maximum and the mean error in ULP, the maximum
+// absolute and relative error and the inputs that produced the maximum error are
+// reported. A case passes when its error in the metric of its budget (ulp, absolute
+// or relative, printed next to the budget) stays within the budget. The budgets are
+// the bounds that the library documents where it documents one. The functions that
+// forward to the C library are held to 2 ULP, which glibc and the other common C
+// libraries meet for their float functions.
+//
+// Usage: anton_math_accuracy [--exhaustive] [--filter <substring>] [--json <path>]
+//   --exhaustive       sweep every f32 of the domains of the unary functions and use
+//                      larger samples for the remaining cases. Takes hours.
+//   --filter <text>    run only the cases whose name contains text.
+//   --json <path>      write the results to path as JSON.
+//
+// The process exits with 1 when any case exceeds its budget.
+
+#include <anton/math/affine3.hpp>
+#include <anton/math/batch.hpp>
+#include <anton/math/blend.hpp>
+#include <anton/math/clip.hpp>
+#include <anton/math/detail/constexpr_math.hpp>
+#include <anton/math/dispatch.hpp>
+#include <anton/math/dual_quat.hpp>
+#include <anton/math/fast.hpp>
+#include <anton/math/hierarchy.hpp>
+#include <anton/math/math.hpp>
+#include <anton/math/quat.hpp>
+#include <anton/math/quat_array.hpp>
+#include <anton/math/track.hpp>
+#include <anton/math/transform.hpp>
+#include <anton/math/vec3.hpp>
+#include <anton/math/vec3_array.hpp>
+#include <anton/math/vec4.hpp>
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <string>
+#include <vector>
+
+using namespace anton;
+namespace math = anton::math;
+
+namespace {
+    enum struct Metric { ulp, absolute, relative };
+
+    char const* get_metric_name(Metric const metric) {
+        switch(metric) {
+            case Metric::ulp:
+                return "ulp";
+            case Metric::absolute:
+                return "absolute";
+            case Metric::relative:
+                return "relative";
+        }
+        return "";
+    }
+
+    struct Budget {
+        Metric metric;
+        f64 value;
+    };
+
+    struct Result {
+        std::string name;
+        std::string domain;
+        Budget budget;
+        i64 samples = 0;
+        f64 max_ulp = 0.0;
+        f64 sum_ulp = 0.0;
+        f64 max_abs = 0.0;
+        f64 max_rel = 0.0;
+        // The inputs that produced the largest error in the metric of the budget.
+        f32 worst[2] = {};
+        f64 worst_error = -1.0;
+    };
+
+    struct Options {
+        bool exhaustive = false;
+        char const* filter = nullptr;
+        char const* json = nullptr;
+    };
+
+    Options options;
+    // deque keeps the references returned by begin_case valid.
+    std::deque<Result> results;
+
+    // The number of samples per range of the unary functions in the dense mode.
+    constexpr i64 dense_samples = 1 << 22;
+    // The number of samples of the binary functions and the vector operations.
+    i64 get_random_samples() {
+        return options.exhaustive ? (i64(1) << 28) : (i64(1) << 20);
+    }
+
+    // splitmix64
+    struct Random {
+        u64 state;
+
+        u64 next() {
+            u64 z = (state += 0x9E3779B97F4A7C15ull);
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+            return z ^ (z >> 31);
+        }
+
+        // Uniform in [lo, hi].
+        f64 uniform(f64 const lo, f64 const hi) {
+            return lo + (hi - lo) * (static_cast<f64>(next() >> 11) * 0x1.0p-53);
+        }
+    };
+
+    // The distance between f32 numbers at the magnitude of v.
+    f64 get_ulp(f64 const v) {
+        f64 const a = std::fabs(v);
+        if(a < 0x1.0p-126) {
+            return 0x1.0p-149;
+        }
+        int e = 0;
+        std::frexp(a, &e);
+        return std::ldexp(1.0, e - 24);
+    }
+
+    // Maps f32 to integers preserving order, so that consecutive integers are
+    // consecutive f32.
+    i64 to_ordered(f32 const v) {
+        i32 bits = 0;
+        std::memcpy(&bits, &v, sizeof(f32));
+        return bits < 0 ? -static_cast<i64>(bits & 0x7FFFFFFF) : bits;
+    }
+
+    f32 from_ordered(i64 const v) {
+        i32 const bits = v < 0 ? static_cast<i32>(-v) | static_cast<i32>(0x80000000) : static_cast<i32>(v);
+        f32 r = 0.0f;
+        std::memcpy(&r, &bits, sizeof(f32));
+        return r;
+    }
+
+    // Invokes callback with f32 in [lo, hi]. In the dense mode the f32 are evenly
+    // spaced in the ordered representation, which yields the same number of samples
+    // for every binade. In the exhaustive mode every f32 is visited.
+    template<typename F>
+    void for_each_f32(f32 const lo, f32 const hi, i64 const count, F&& callback) {
+        i64 const first = to_ordered(lo);
+        i64 const last = to_ordered(hi);
+        i64 const stride = options.exhaustive ? 1 : (last - first) / count + 1;
+        for(i64 i = first; i <= last; i += stride) {
+            callback(from_ordered(i));
+        }
+    }
+
+    bool is_selected(char const* const name) {
+        return options.filter == nullptr || std::strstr(name, options.filter) != nullptr;
+    }
+
+    Result& begin_case(std::string name, std::string domain, Budget const budget) {
+        Result& r = results.emplace_back();
+        r.name = static_cast<std::string&&>(name);
+        r.domain = static_cast<std::string&&>(domain);
+        r.budget = budget;
+        return r;
+    }
+
+    void record_error(Result& r, f64 const ulp, f64 const abs, f64 const rel, f32 const in0, f32 const in1) {
+        r.samples += 1;
+        r.sum_ulp += ulp;
+        r.max_ulp = ulp > r.max_ulp ? ulp : r.max_ulp;
+        r.max_abs = abs > r.max_abs ? abs : r.max_abs;
+        r.max_rel = rel > r.max_rel ? rel : r.max_rel;
+        f64 const error = r.budget.metric == Metric::ulp ? ulp : (r.budget.metric == Metric::absolute ? abs : rel);
+        if(error > r.worst_error) {
+            r.worst_error = error;
+            r.worst[0] = in0;
+            r.worst[1] = in1;
+        }
+    }
+
+    // Records the error of a single value against the reference. The reference is
+    // the exact result of the function at the f32 inputs. nan and infinities must
+    // be reproduced exactly, results that overflow f32 must be infinite.
+    void record(Result& r, f32 const value, f64 const reference, f32 const in0, f32 const in1 = 0.0f) {
+        constexpr f64 inf = HUGE_VAL;
+        if(std::isnan(reference) || std::isnan(value)) {
+            bool const same = std::isnan(reference) && std::isnan(value);
+            record_error(r, same ? 0.0 : inf, same ? 0.0 : inf, same ? 0.0 : inf, in0, in1);
+            return;
+        }
+
+        f32 const rounded = static_cast<f32>(reference);
+        if(std::isinf(rounded) || std::isinf(value)) {
+            bool const same = rounded == value;
+            record_error(r, same ? 0.0 : inf, same ? 0.0 : inf, same ? 0.0 : inf, in0, in1);
+            return;
+        }
+
+        f64 const abs = std::fabs(static_cast<f64>(value) - reference);
+        f64 const rel = reference != 0.0 ? abs / std::fabs(reference) : (abs != 0.0 ? inf : 0.0);
+        record_error(r, abs / get_ulp(reference), abs, rel, in0, in1);
+    }
+
+    // Records the error of a vector of n components. The errors of all components are
+    // measured relative to the largest component of the reference, which keeps the
+    // components close to 0 from dominating the ULP error.
+    void record_vector(Result& r, f32 const* const value, f64 const* const reference, i32 const n, f32 const in0, f32 const in1 = 0.0f) {
+        f64 scale = 0.0;
+        for(i32 i = 0; i < n; ++i) {
+            scale = std::fmax(scale, std::fabs(reference[i]));
+        }
+
+        f64 abs = 0.0;
+        for(i32 i = 0; i < n; ++i) {
+            f64 const d = std::fabs(static_cast<f64>(value[i]) - reference[i]);
+            abs = std::isnan(d) ? HUGE_VAL : std::fmax(abs, d);
+        }
+
+        f64 const rel = scale != 0.0 ? abs / scale : abs;
+        record_error(r, abs / get_ulp(scale), abs, rel, in0, in1);
+    }
+
+    //
+    // Scalar functions
+    //
+
+    using Unary_Function = f32 (*)(f32);
+    using Unary_Reference = f64 (*)(f64);
+
+    struct Unary_Case {
+        char const* name;
+        Unary_Function function;
+        Unary_Reference reference;
+        f32 lo;
+        f32 hi;
+        Budget budget;
+    };
+
+    std::string format_range(f32 const lo, f32 const hi) {
+        char buffer[64];
+        std::snprintf(buffer, sizeof(buffer), "[%.9g, %.9g]", lo, hi);
+        return buffer;
+    }
+
+    void run_unary(Unary_Case const& c) {
+        if(!is_selected(c.name)) {
+            return;
+        }
+
+        Result& r = begin_case(c.name, format_range(c.lo, c.hi), c.budget);
+        for_each_f32(c.lo, c.hi, dense_samples, [&](f32 const x) { record(r, c.function(x), c.reference(x), x); });
+    }
+
+    f64 ref_inv_sqrt(f64 const v) {
+        return 1.0 / std::sqrt(v);
+    }
+
+    f64 ref_exp2(f64 const v) {
+        return std::exp2(v);
+    }
+
+    f64 ref_fract(f64 const v) {
+        f64 integral = 0.0;
+        return std::modf(v, &integral);
+    }
+
+    f64 ref_smoothstep(f64 const v) {
+        f64 const x = std::fmin(std::fmax(v, 0.0), 1.0);
+        return x * x * (3.0 - 2.0 * x);
+    }
+
+    f64 ref_smootherstep(f64 const v) {
+        f64 const x = std::fmin(std::fmax(v, 0.0), 1.0);
+        return x * x * x * ((6.0 * x - 15.0) * x + 10.0);
+    }
+
+    constexpr f32 f32_max = 3.40282347e+38f;
+    constexpr f32 f32_min_normal = 1.17549435e-38f;
+
+    void run_scalar_cases() {
+        Budget const one_ulp{Metric::ulp, 1.0};
+        Budget const libm{Metric::ulp, 2.0};
+        Budget const exact{Metric::ulp, 0.0};
+        Unary_Case const cases[] = {
+            {"sqrt", [](f32 x) { return math::sqrt(x); }, [](f64 x) { return std::sqrt(x); }, 0.0f, f32_max, {Metric::ulp, 0.5}},
+            {"cbrt", [](f32 x) { return math::cbrt(x); }, [](f64 x) { return std::cbrt(x); }, -f32_max, f32_max, libm},
+            {"inv_sqrt", [](f32 x) { return math::inv_sqrt(x); }, ref_inv_sqrt, f32_min_normal, f32_max, {Metric::ulp, 1.5}},
+            {"sin", [](f32 x) { return math::sin(x); }, [](f64 x) { return std::sin(x); }, -f32_max, f32_max, libm},
+            {"cos", [](f32 x) { return math::cos(x); }, [](f64 x) { return std::cos(x); }, -f32_max, f32_max, libm},
+            {"sincos.sin", [](f32 x) { return math::sincos(x).sin; }, [](f64 x) { return std::sin(x); }, -f32_max, f32_max, {Metric::ulp, 2.0}},
+            {"sincos.cos", [](f32 x) { return math::sincos(x).cos; }, [](f64 x) { return std::cos(x); }, -f32_max, f32_max, {Metric::ulp, 2.0}},
+            {"tan", [](f32 x) { return math::tan(x); }, [](f64 x) { return std::tan(x); }, -f32_max, f32_max, libm},
+            {"asin", [](f32 x) { return math::asin(x); }, [](f64 x) { return std::asin(x); }, -1.0f, 1.0f, libm},
+            {"acos", [](f32 x) { return math::acos(x); }, [](f64 x) { return std::acos(x); }, -1.0f, 1.0f, libm},
+            {"atan", [](f32 x) { return math::atan(x); }, [](f64 x) { return std::atan(x); }, -f32_max, f32_max, libm},
+            {"exp", [](f32 x) { return math::exp(x); }, [](f64 x) { return std::exp(x); }, -104.0f, 89.0f, libm},
+            {"log", [](f32 x) { return math::log(x); }, [](f64 x) { return std::log(x); }, 0.0f, f32_max, libm},
+            {"log2", [](f32 x) { return math::log2(x); }, [](f64 x) { return std::log2(x); }, 0.0f, f32_max, libm},
+            {"log10", [](f32 x) { return math::log10(x); }, [](f64 x) { return std::log10(x); }, 0.0f, f32_max, libm},
+            {"round", [](f32 x) { return math::round(x); }, [](f64 x) { return std::round(x); }, -f32_max, f32_max, exact},
+            {"floor", [](f32 x) { return math::floor(x); }, [](f64 x) { return std::floor(x); }, -f32_max, f32_max, exact},
+            {"ceil", [](f32 x) { return math::ceil(x); }, [](f64 x) { return std::ceil(x); }, -f32_max, f32_max, exact},
+            {"fract", [](f32 x) { return math::fract(x); }, ref_fract, -f32_max, f32_max, exact},
+            {"smoothstep", [](f32 x) { return math::smoothstep(0.0f, 1.0f, x); }, ref_smoothstep, -1.0f, 2.0f, {Metric::ulp, 2.0}},
+            // (6x - 15)x + 10 cancels as x approaches 1, which costs smootherstep about
+            // 20 ULP there.
+            {"smootherstep", [](f32 x) { return math::smootherstep(0.0f, 1.0f, x); }, ref_smootherstep, -1.0f, 2.0f, {Metric::ulp, 24.0}},
+            // The compile-time implementations of detail/constexpr_math.hpp evaluated
+            // at runtime.
+            {"constexpr.sqrt", [](f32 x) { return math::detail::constexpr_sqrtf(x); }, [](f64 x) { return std::sqrt(x); }, 0.0f, f32_max, {Metric::ulp, 0.5}},
+            {"constexpr.cbrt", [](f32 x) { return static_cast<f32>(math::detail::constexpr_cbrt(x)); }, [](f64 x) { return std::cbrt(x); }, -f32_max,
+             f32_max, one_ulp},
+            {"constexpr.inv_sqrt", [](f32 x) { return static_cast<f32>(math::detail::constexpr_inv_sqrt(x)); }, ref_inv_sqrt, f32_min_normal, f32_max,
+             one_ulp},
+            {"constexpr.sin", [](f32 x) { return static_cast<f32>(math::detail::constexpr_sin(x)); }, [](f64 x) { return std::sin(x); }, -f32_max, f32_max,
+             one_ulp},
+            {"constexpr.cos", [](f32 x) { return static_cast<f32>(math::detail::constexpr_cos(x)); }, [](f64 x) { return std::cos(x); }, -f32_max, f32_max,
+             one_ulp},
+            {"constexpr.tan", [](f32 x) { return static_cast<f32>(math::detail::constexpr_tan(x)); }, [](f64 x) { return std::tan(x); }, -f32_max, f32_max,
+             one_ulp},
+            {"constexpr.asin", [](f32 x) { return static_cast<f32>(math::detail::constexpr_asin(x)); }, [](f64 x) { return std::asin(x); }, -1.0f, 1.0f,
+             one_ulp},
+            {"constexpr.acos", [](f32 x) { return static_cast<f32>(math::detail::constexpr_acos(x)); }, [](f64 x) { return std::acos(x); }, -1.0f, 1.0f,
+             one_ulp},
+            {"constexpr.atan", [](f32 x) { return static_cast<f32>(math::detail::constexpr_atan(x)); }, [](f64 x) { return std::atan(x); }, -f32_max,
+             f32_max, one_ulp},
+            {"constexpr.exp", [](f32 x) { return static_cast<f32>(math::detail::constexpr_exp(x)); }, [](f64 x) { return std::exp(x); }, -104.0f, 89.0f,
+             one_ulp},
+            {"constexpr.log", [](f32 x) { return static_cast<f32>(math::detail::constexpr_log(x)); }, [](f64 x) { return std::log(x); }, 0.0f, f32_max,
+             one_ulp},
+            {"constexpr.log2", [](f32 x) { return static_cast<f32>(math::detail::constexpr_log2(x)); }, [](f64 x) { return std::log2(x); }, 0.0f, f32_max,
+             one_ulp},
+            {"constexpr.log10", [](f32 x) { return static_cast<f32>(math::detail::constexpr_log10(x)); }, [](f64 x) { return std::log10(x); }, 0.0f,
+             f32_max, one_ulp},
+            // The fast functions with the bounds stated in fast.hpp.
+            {"fast.inv_sqrt", [](f32 x) { return math::fast::inv_sqrt(x); }, ref_inv_sqrt, f32_min_normal, f32_max, {Metric::relative, 5e-6}},
+            {"fast.sin", [](f32 x) { return math::fast::sin(x); }, [](f64 x) { return std::sin(x); }, -8192.0f, 8192.0f, {Metric::absolute, 1e-6}},
+            {"fast.cos", [](f32 x) { return math::fast::cos(x); }, [](f64 x) { return std::cos(x); }, -8192.0f, 8192.0f, {Metric::absolute, 1e-6}},
+            {"fast.asin", [](f32 x) { return math::fast::asin(x); }, [](f64 x) { return std::asin(x); }, -1.0f, 1.0f, {Metric::absolute, 1e-5}},
+            {"fast.acos", [](f32 x) { return math::fast::acos(x); }, [](f64 x) { return std::acos(x); }, -1.0f, 1.0f, {Metric::absolute, 1e-5}},
+            {"fast.atan", [](f32 x) { return math::fast::atan(x); }, [](f64 x) { return std::atan(x); }, -f32_max, f32_max, {Metric::absolute, 2e-5}},
+            {"fast.exp2", [](f32 x) { return math::fast::exp2(x); }, ref_exp2, -126.0f, 127.99f, {Metric::relative, 5e-6}},
+            {"fast.exp", [](f32 x) { return math::fast::exp(x); }, [](f64 x) { return std::exp(x); }, -87.0f, 88.0f, {Metric::relative, 1e-5}},
+            {"fast.log2", [](f32 x) { return math::fast::log2(x); }, [](f64 x) { return std::log2(x); }, f32_min_normal, f32_max, {Metric::absolute, 1e-5}},
+            {"fast.log", [](f32 x) { return math::fast::log(x); }, [](f64 x) { return std::log(x); }, f32_min_normal, f32_max, {Metric::absolute, 1e-5}},
+        };
+
+        for(Unary_Case const& c: cases) {
+            run_unary(c);
+        }
+
+        Random random{1};
+        i64 const samples = get_random_samples();
+        // The binary functions are sampled on a grid of f32 evenly spaced in the
+        // ordered representation, so that every pair of binades is covered.
+        i64 const side = static_cast<i64>(std::sqrt(static_cast<f64>(samples)));
+        if(is_selected("atan2")) {
+            Result& r = begin_case("atan2", "y, x in [-max, max]", libm);
+            Result& rc = begin_case("constexpr.atan2", "y, x in [-max, max]", one_ulp);
+            for_each_f32(-f32_max, f32_max, side, [&](f32 const y) {
+                for_each_f32(-f32_max, f32_max, side, [&](f32 const x) {
+                    f64 const reference = std::atan2(static_cast<f64>(y), static_cast<f64>(x));
+                    record(r, math::atan2(y, x), reference, y, x);
+                    record(rc, static_cast<f32>(math::detail::constexpr_atan2(y, x)), reference, y, x);
+                });
+            });
+        }
+
+        if(is_selected("fast.atan2")) {
+            Result& r = begin_case("fast.atan2", "y, x in [-max, max]", {Metric::absolute, 2e-5});
+            for_each_f32(-f32_max, f32_max, side, [&](f32 const y) {
+                for_each_f32(-f32_max, f32_max, side, [&](f32 const x) {
+                    record(r, math::fast::atan2(y, x), std::atan2(static_cast<f64>(y), static_cast<f64>(x)), y, x);
+                });
+            });
+        }
+
+        if(is_selected("pow")) {
+            Result& r = begin_case("pow", "base in [0, max], exp in [-64, 64]", libm);
+            Result& rc = begin_case("constexpr.pow", "base in [0, max], exp in [-64, 64]", one_ulp);
+            for_each_f32(0.0f, f32_max, side, [&](f32 const base) {
+                for(i64 i = 0; i < side; ++i) {
+                    f32 const exp = static_cast<f32>(random.uniform(-64.0, 64.0));
+                    f64 const reference = std::pow(static_cast<f64>(base), static_cast<f64>(exp));
+                    record(r, math::pow(base, exp), reference, base, exp);
+                    record(rc, static_cast<f32>(math::detail::constexpr_pow(base, exp)), reference, base, exp);
+                }
+            });
+        }
+
+        if(is_selected("mod")) {
+            Result& r = begin_case("mod", "x, y in [-max, max]", exact);
+            for_each_f32(-f32_max, f32_max, side, [&](f32 const x) {
+                for_each_f32(-f32_max, f32_max, side, [&](f32 const y) {
+                    record(r, math::mod(x, y), std::fmod(static_cast<f64>(x), static_cast<f64>(y)), x, y);
+                });
+            });
+        }
+
+        if(is_selected("lerp")) {
+            // The result is not close to 0, where lerp suffers from cancellation.
+            Result& r = begin_case("lerp", "a, b in [1, 2], t in [0, 1]", {Metric::ulp, 2.0});
+            for(i64 i = 0; i < samples; ++i) {
+                f32 const a = static_cast<f32>(random.uniform(1.0, 2.0));
+                f32 const b = static_cast<f32>(random.uniform(1.0, 2.0));
+                f32 const t = static_cast<f32>(random.uniform(0.0, 1.0));
+                f64 const reference = (1.0 - static_cast<f64>(t)) * a + static_cast<f64>(t) * b;
+                record(r, math::lerp(a, b, t), reference, a, t);
+            }
+        }
+    }
+
+    //
+    // Array functions
+    //
+
+    using Array_Function = void (*)(f32 const*, f32*, i64);
+
+    struct Array_Case {
+        char const* name;
+        Array_Function function;
+        Unary_Reference reference;
+        f32 lo;
+        f32 hi;
+        f64 budget;
+    };
+
+    void run_array_cases() {
+        Array_Case const cases[] = {
+            {"sin", [](f32 const* in, f32* out, i64 n) { math::sin(in, out, n); }, [](f64 x) { return std::sin(x); }, -f32_max, f32_max, 2.0},
+            {"cos", [](f32 const* in, f32* out, i64 n) { math::cos(in, out, n); }, [](f64 x) { return std::cos(x); }, -f32_max, f32_max, 2.0},
+            {"tan", [](f32 const* in, f32* out, i64 n) { math::tan(in, out, n); }, [](f64 x) { return std::tan(x); }, -f32_max, f32_max, 3.0},
+            {"asin", [](f32 const* in, f32* out, i64 n) { math::asin(in, out, n); }, [](f64 x) { return std::asin(x); }, -1.0f, 1.0f, 2.5},
+            {"acos", [](f32 const* in, f32* out, i64 n) { math::acos(in, out, n); }, [](f64 x) { return std::acos(x); }, -1.0f, 1.0f, 1.5},
+            {"atan", [](f32 const* in, f32* out, i64 n) { math::atan(in, out, n); }, [](f64 x) { return std::atan(x); }, -f32_max, f32_max, 2.5},
+            {"exp", [](f32 const* in, f32* out, i64 n) { math::exp(in, out, n); }, [](f64 x) { return std::exp(x); }, -104.0f, 89.0f, 1.5},
+            {"log", [](f32 const* in, f32* out, i64 n) { math::log(in, out, n); }, [](f64 x) { return std::log(x); }, 0.0f, f32_max, 1.0},
+            {"log2", [](f32 const* in, f32* out, i64 n) { math::log2(in, out, n); }, [](f64 x) { return std::log2(x); }, 0.0f, f32_max, 1.5},
+        };
+
+        constexpr i64 block = 1 << 16;
+        std::vector<f32> in0(block);
+        std::vector<f32> in1(block);
+        std::vector<f32> out0(block);
+        std::vector<f32> out1(block);
+        math::Instruction_Set const previous = math::get_instruction_set();
+        for(u8 i = 0; i <= static_cast<u8>(math::Instruction_Set::avx512); ++i) {
+            math::Instruction_Set const instruction_set = static_cast<math::Instruction_Set>(i);
+            if(!math::is_instruction_set_supported(instruction_set)) {
+                continue;
+            }
+
+            math::set_instruction_set(instruction_set);
+            std::string const suffix = std::string("[") + math::get_instruction_set_name(instruction_set) + "]";
+            for(Array_Case const& c: cases) {
+                std::string const name = std::string("array.") + c.name + suffix;
+                if(!is_selected(name.c_str())) {
+                    continue;
+                }
+
+                Result& r = begin_case(name, format_range(c.lo, c.hi), {Metric::ulp, c.budget});
+                i64 count = 0;
+                auto flush = [&] {
+                    c.function(in0.data(), out0.data(), count);
+                    for(i64 j = 0; j < count; ++j) {
+                        record(r, out0[j], c.reference(in0[j]), in0[j]);
+                    }
+                    count = 0;
+                };
+                for_each_f32(c.lo, c.hi, dense_samples, [&](f32 const x) {
+                    in0[count++] = x;
+                    if(count == block) {
+                        flush();
+                    }
+                });
+                flush();
+            }
+
+            std::string const sincos_name = "array.sincos" + suffix;
+            if(is_selected(sincos_name.c_str())) {
+                Result& r = begin_case(sincos_name, format_range(-f32_max, f32_max), {Metric::ulp, 2.0});
+                i64 count = 0;
+                auto flush = [&] {
+                    math::sincos(in0.data(), out0.data(), out1.data(), count);
+                    for(i64 j = 0; j < count; ++j) {
+                        record(r, out0[j], std::sin(static_cast<f64>(in0[j])), in0[j]);
+                        record(r, out1[j], std::cos(static_cast<f64>(in0[j])), in0[j]);
+                    }
+                    count = 0;
+                };
+                for_each_f32(-f32_max, f32_max, dense_samples, [&](f32 const x) {
+                    in0[count++] = x;
+                    if(count == block) {
+                        flush();
+                    }
+                });
+                flush();
+            }
+
+            std::string const atan2_name = "array.atan2" + suffix;
+            std::string const pow_name = "array.pow" + suffix;
+            bool const run_atan2 = is_selected(atan2_name.c_str());
+            bool const run_pow = is_selected(pow_name.c_str());
+            if(run_atan2 || run_pow) {
+                Result* const r_atan2 = run_atan2 ? &begin_case(atan2_name, "y, x in [-max, max]", {Metric::ulp, 3.0}) : nullptr;
+                Result* const r_pow = run_pow ? &begin_case(pow_name, "base in [0, max], exp in [-64, 64]", {Metric::ulp, 1.0}) : nullptr;
+                Random random{2};
+                i64 const samples = get_random_samples();
+                for(i64 done = 0; done < samples; done += block) {
+                    for(i64 j = 0; j < block; ++j) {
+                        in0[j] = from_ordered(static_cast<i64>(random.uniform(to_ordered(-f32_max), to_ordered(f32_max))));
+                        in1[j] = from_ordered(static_cast<i64>(random.uniform(to_ordered(-f32_max), to_ordered(f32_max))));
+                    }
+
+                    if(r_atan2 != nullptr) {
+                        math::atan2(in0.data(), in1.data(), out0.data(), block);
+                        for(i64 j = 0; j < block; ++j) {
+                            record(*r_atan2, out0[j], std::atan2(static_cast<f64>(in0[j]), static_cast<f64>(in1[j])), in0[j], in1[j]);
+                        }
+                    }
+
+                    if(r_pow != nullptr) {
+                        for(i64 j = 0; j < block; ++j) {
+                            in0[j] = std::fabs(in0[j]);
+                            in1[j] = static_cast<f32>(random.uniform(-64.0, 64.0));
+                        }
+                        math::pow(in0.data(), in1.data(), out0.data(), block);
+                        for(i64 j = 0; j < block; ++j) {
+                            record(*r_pow, out0[j], std::pow(static_cast<f64>(in0[j]), static_cast<f64>(in1[j])), in0[j], in1[j]);
+                        }
+                    }
+                }
+            }
+        }
+        math::set_instruction_set(previous);
+    }
+
+    //
+    // Vector, quaternion and transform operations
+    //
+
+    constexpr f64 pi = 3.14159265358979323846;
+
+    struct Quat64 {
+        f64 x;
+        f64 y;
+        f64 z;
+        f64 w;
+    };
+
+    // A uniformly distributed unit quaternion rounded to f32.
+    math::Quat random_quat(Random& random) {
+        f64 const u0 = random.uniform(0.0, 1.0);
+        f64 const u1 = random.uniform(0.0, 2.0 * pi);
+        f64 const u2 = random.uniform(0.0, 2.0 * pi);
+        f64 const a = std::sqrt(1.0 - u0);
+        f64 const b = std::sqrt(u0);
+        return {static_cast<f32>(a * std::sin(u1)), static_cast<f32>(a * std::cos(u1)), static_cast<f32>(b * std::sin(u2)),
+                static_cast<f32>(b * std::cos(u2))};
+    }
+
+    math::Vec3 random_unit_vec3(Random& random) {
+        f64 const z = random.uniform(-1.0, 1.0);
+        f64 const phi = random.uniform(0.0, 2.0 * pi);
+        f64 const s = std::sqrt(1.0 - z * z);
+        return {static_cast<f32>(s * std::cos(phi)), static_cast<f32>(s * std::sin(phi)), static_cast<f32>(z)};
+    }
+
+    // Spherical interpolation of a and b of n components that are unit vectors,
+    // evaluated without the small angle approximation.
+    void ref_slerp(f64 const* const a, f64 const* const b, i32 const n, f64 const t, f64* const out) {
+        f64 d = 0.0;
+        for(i32 i = 0; i < n; ++i) {
+            d += a[i] * b[i];
+        }
+        d = std::fmin(std::fmax(d, -1.0), 1.0);
+        f64 const angle = std::acos(d);
+        f64 const s = std::sin(angle);
+        f64 const f0 = s != 0.0 ? std::sin((1.0 - t) * angle) / s : 1.0 - t;
+        f64 const f1 = s != 0.0 ? std::sin(t * angle) / s : t;
+        for(i32 i = 0; i < n; ++i) {
+            out[i] = f0 * a[i] + f1 * b[i];
+        }
+    }
+
+    template<typename F>
+    void run_normalize(char const* const name, i32 const n, Budget const budget, F&& normalize) {
+        if(!is_selected(name)) {
+            return;
+        }
+
+        Result& r = begin_case(name, "components in [-1000, 1000]", budget);
+        Random random{3};
+        i64 const samples = get_random_samples();
+        for(i64 i = 0; i < samples; ++i) {
+            f32 v[4] = {};
+            f64 length_squared = 0.0;
+            for(i32 j = 0; j < n; ++j) {
+                // Vary the magnitude of the vector to cover many binades.
+                v[j] = static_cast<f32>(random.uniform(-1.0, 1.0) * std::exp2(random.uniform(-10.0, 10.0)));
+                length_squared += static_cast<f64>(v[j]) * v[j];
+            }
+            f64 reference[4] = {};
+            for(i32 j = 0; j < n; ++j) {
+                reference[j] = v[j] / std::sqrt(length_squared);
+            }
+            f32 result[4] = {};
+            normalize(v, result);
+            record_vector(r, result, reference, n, v[0], v[1]);
+        }
+    }
+
+    void run_vector_cases() {
+        // inv_sqrt contributes 1.5 ULP, the length and the scaling the rest.
+        run_normalize("normalize(Vec3)", 3, {Metric::ulp, 4.0}, [](f32 const* v, f32* out) {
+            math::Vec3 const r = math::normalize(math::Vec3{v[0], v[1], v[2]}, 0.0f);
+            std::memcpy(out, &r, 3 * sizeof(f32));
+        });
+        run_normalize("normalize(Vec4)", 4, {Metric::ulp, 4.0}, [](f32 const* v, f32* out) {
+            math::Vec4 const r = math::normalize(math::Vec4{v[0], v[1], v[2], v[3]}, 0.0f);
+            for(i32 i = 0; i < 4; ++i) {
+                out[i] = r[i];
+            }
+        });
+        run_normalize("normalize(Quat)", 4, {Metric::ulp, 4.0}, [](f32 const* v, f32* out) {
+            math::Quat const r = math::normalize(math::Quat{v[0], v[1], v[2], v[3]});
+            std::memcpy(out, &r, 4 * sizeof(f32));
+        });
+        // fast::normalize is bounded by the relative error of fast::inv_sqrt.
+        run_normalize("fast.normalize(Vec3)", 3, {Metric::relative, 5e-6}, [](f32 const* v, f32* out) {
+            math::Vec3 const r = math::fast::normalize(math::Vec3{v[0], v[1], v[2]}, 0.0f);
+            std::memcpy(out, &r, 3 * sizeof(f32));
+        });
+
+        i64 const samples = get_random_samples();
+        if(is_selected("slerp(Quat)")) {
+            // slerp interpolates linearly when the angle between the quaternions is
+            // below acos(0.9999). The interpolated quaternion is shorter than 1 by up
+            // to angle^2 / 8, that is 2.5e-5.
+            Result& r = begin_case("slerp(Quat)", "unit quaternions, t in [0, 1]", {Metric::absolute, 3e-5});
+            Result& rf = begin_case("fast.slerp(Quat)", "unit quaternions, t in [0, 1]", {Metric::absolute, 1e-4});
+            Random random{4};
+            for(i64 i = 0; i < samples; ++i) {
+                math::Quat const a = random_quat(random);
+                math::Quat b = random_quat(random);
+                // Cover the linear interpolation branch with close quaternions.
+                if(i % 4 == 0) {
+                    f32 const k = static_cast<f32>(random.uniform(0.0, 0.02));
+                    b = math::normalize(a + math::Quat{b.x * k, b.y * k, b.z * k, b.w * k});
+                }
+                f32 const t = static_cast<f32>(random.uniform(0.0, 1.0));
+                f64 const qa[4] = {a.x, a.y, a.z, a.w};
+                f64 qb[4] = {b.x, b.y, b.z, b.w};
+                // slerp takes the shorter path.
+                if(qa[0] * qb[0] + qa[1] * qb[1] + qa[2] * qb[2] + qa[3] * qb[3] < 0.0) {
+                    for(f64& c: qb) {
+                        c = -c;
+                    }
+                }
+                f64 reference[4];
+                ref_slerp(qa, qb, 4, t, reference);
+                math::Quat const result = math::slerp(a, b, t);
+                record_vector(r, &result.x, reference, 4, t);
+                math::Quat const result_fast = math::fast::slerp(a, b, t);
+                record_vector(rf, &result_fast.x, reference, 4, t);
+            }
+        }
+
+        if(is_selected("slerp(Vec3)")) {
+            // slerp of Vec3 interpolates linearly when the angle is below acos(0.995),
+            // which shortens the result by up to angle^2 / 8, that is 1.25e-3. The
+            // interpolation is ill-conditioned for nearly opposite vectors, which are
+            // excluded.
+            Result& r = begin_case("slerp(Vec3)", "unit vectors at most 175 degrees apart, t in [0, 1]", {Metric::absolute, 1.5e-3});
+            Random random{5};
+            f64 const min_cos = std::cos(175.0 * pi / 180.0);
+            for(i64 i = 0; i < samples; ++i) {
+                math::Vec3 const a = random_unit_vec3(random);
+                math::Vec3 const b = random_unit_vec3(random);
+                f64 const va[3] = {a.x, a.y, a.z};
+                f64 const vb[3] = {b.x, b.y, b.z};
+                if(va[0] * vb[0] + va[1] * vb[1] + va[2] * vb[2] < min_cos) {
+                    continue;
+                }
+                f32 const t = static_cast<f32>(random.uniform(0.0, 1.0));
+                f64 reference[3];
+                ref_slerp(va, vb, 3, t, reference);
+                math::Vec3 const result = math::slerp(a, b, t);
+                record_vector(r, &result.x, reference, 3, t);
+            }
+        }
+
+        bool const run_rotate = is_selected("rotate(Quat, Vec3)");
+        bool const run_rotate_array = is_selected("rotate(Quat_Array, Vec3_Array)");
+        if(run_rotate || run_rotate_array) {
+            // The reference rotates by the quaternion normalized in f64, hence the
+            // error includes the deviation of the f32 quaternion from unit length. The
+            // error is measured relative to the largest component, hence the rounding
+            // of the larger intermediate cross products accounts for most of it.
+            char const* const domain = "unit quaternions, vector components in [-100, 100]";
+            Result* const r_rotate = run_rotate ? &begin_case("rotate(Quat, Vec3)", domain, {Metric::ulp, 16.0}) : nullptr;
+            Result* const r_array = run_rotate_array ? &begin_case("rotate(Quat_Array, Vec3_Array)", domain, {Metric::ulp, 16.0}) : nullptr;
+            constexpr i64 block = 1 << 12;
+            math::Quat_Array quats(block);
+            math::Vec3_Array vectors(block);
+            math::Vec3_Array rotated(block);
+            Random random{7};
+            for(i64 done = 0; done < samples; done += block) {
+                for(i64 j = 0; j < block; ++j) {
+                    quats.set(j, random_quat(random));
+                    vectors.set(j, math::Vec3{static_cast<f32>(random.uniform(-100.0, 100.0)), static_cast<f32>(random.uniform(-100.0, 100.0)),
+                                              static_cast<f32>(random.uniform(-100.0, 100.0))});
+                }
+
+                if(r_array != nullptr) {
+                    math::rotate(quats, vectors, rotated);
+                }
+
+                for(i64 j = 0; j < block; ++j) {
+                    math::Quat const q = quats.get(j);
+                    math::Vec3 const v = vectors.get(j);
+                    f64 const n = std::sqrt(static_cast<f64>(q.x) * q.x + static_cast<f64>(q.y) * q.y + static_cast<f64>(q.z) * q.z +
+                                            static_cast<f64>(q.w) * q.w);
+                    Quat64 const u{q.x / n, q.y / n, q.z / n, q.w / n};
+                    // v' = v + 2w (u x v) + 2 u x (u x v).
+                    f64 const c[3] = {u.y * v.z - u.z * v.y, u.z * v.x - u.x * v.z, u.x * v.y - u.y * v.x};
+                    f64 const cc[3] = {u.y * c[2] - u.z * c[1], u.z * c[0] - u.x * c[2], u.x * c[1] - u.y * c[0]};
+                    f64 const reference[3] = {v.x + 2.0 * (u.w * c[0] + cc[0]), v.y + 2.0 * (u.w * c[1] + cc[1]), v.z + 2.0 * (u.w * c[2] + cc[2])};
+                    if(r_rotate != nullptr) {
+                        math::Vec3 const result = q * v;
+                        record_vector(*r_rotate, &result.x, reference, 3, q.w, v.x);
+                    }
+                    if(r_array != nullptr) {
+                        math::Vec3 const result = rotated.get(j);
+                        record_vector(*r_array, &result.x, reference, 3, q.w, v.x);
+                    }
+                }
+            }
+        }
+
+        bool const run_mat4 = is_selected("decompose(Mat4)");
+        bool const run_affine3 = is_selected("decompose(Affine3)");
+        if(run_mat4 || run_affine3) {
+            // The matrices are composed in f64 and rounded to f32. The decomposition
+            // is compared against the original transformation, with the rotation in
+            // the hemisphere of the result.
+            char const* const domain = "unit rotation, scale in [0.1, 10], translation in [-100, 100]";
+            Result* const r_mat4 = run_mat4 ? &begin_case("decompose(Mat4)", domain, {Metric::ulp, 16.0}) : nullptr;
+            Result* const r_affine3 = run_affine3 ? &begin_case("decompose(Affine3)", domain, {Metric::ulp, 16.0}) : nullptr;
+            Random random{6};
+            for(i64 i = 0; i < samples; ++i) {
+                math::Quat const q = random_quat(random);
+                f64 const s[3] = {random.uniform(0.1, 10.0), random.uniform(0.1, 10.0), random.uniform(0.1, 10.0)};
+                f64 const t[3] = {random.uniform(-100.0, 100.0), random.uniform(-100.0, 100.0), random.uniform(-100.0, 100.0)};
+                f64 const x = q.x;
+                f64 const y = q.y;
+                f64 const z = q.z;
+                f64 const w = q.w;
+                f64 const n = std::sqrt(x * x + y * y + z * z + w * w);
+                Quat64 const u{x / n, y / n, z / n, w / n};
+                // Columns of the rotation matrix as in math::rotate.
+                f64 const rotation[3][3] = {{1 - 2 * (u.y * u.y + u.z * u.z), 2 * (u.x * u.y + u.z * u.w), 2 * (u.x * u.z - u.y * u.w)},
+                                            {2 * (u.x * u.y - u.z * u.w), 1 - 2 * (u.x * u.x + u.z * u.z), 2 * (u.y * u.z + u.x * u.w)},
+                                            {2 * (u.x * u.z + u.y * u.w), 2 * (u.y * u.z - u.x * u.w), 1 - 2 * (u.x * u.x + u.y * u.y)}};
+                math::Mat4 m = math::Mat4::identity;
+                for(i32 c = 0; c < 3; ++c) {
+                    for(i32 j = 0; j < 3; ++j) {
+                        m[c][j] = static_cast<f32>(rotation[c][j] * s[c]);
+                    }
+                    m[3][c] = static_cast<f32>(t[c]);
+                }
+
+                auto check = [&](Result& r, math::TRS const& trs) {
+                    f64 const sign = u.x * trs.rotation.x + u.y * trs.rotation.y + u.z * trs.rotation.z + u.w * trs.rotation.w < 0.0 ? -1.0 : 1.0;
+                    f64 const reference_rotation[4] = {sign * u.x, sign * u.y, sign * u.z, sign * u.w};
+                    record_vector(r, &trs.rotation.x, reference_rotation, 4, q.w);
+                    record_vector(r, &trs.scale.x, s, 3, q.w);
+                    record_vector(r, &trs.translation.x, t, 3, q.w);
+                };
+                if(r_mat4 != nullptr) {
+                    check(*r_mat4, math::decompose(m));
+                }
+                if(r_affine3 != nullptr) {
+                    check(*r_affine3, math::decompose(math::Affine3(m)));
+                }
+            }
+        }
+    }
+
+    //
+    // Hierarchies
+    //
+
+    // Column-major like math::Mat4.
+    struct Mat64 {
+        f64 m[4][4];
+    };
+
+    Mat64 ref_multiply(Mat64 const& a, Mat64 const& b) {
+        Mat64 r;
+        for(i32 c = 0; c < 4; ++c) {
+            for(i32 j = 0; j < 4; ++j) {
+                r.m[c][j] = a.m[0][j] * b.m[c][0] + a.m[1][j] * b.m[c][1] + a.m[2][j] * b.m[c][2] + a.m[3][j] * b.m[c][3];
+            }
+        }
+        return r;
+    }
+
+    Mat64 ref_local(math::Mat4 const& local) {
+        Mat64 r;
+        for(i32 c = 0; c < 4; ++c) {
+            for(i32 j = 0; j < 4; ++j) {
+                r.m[c][j] = local[c][j];
+            }
+        }
+        return r;
+    }
+
+    Mat64 ref_local(math::Affine3 const& local) {
+        Mat64 r;
+        for(i32 c = 0; c < 4; ++c) {
+            for(i32 j = 0; j < 3; ++j) {
+                r.m[c][j] = local[c][j];
+            }
+            r.m[c][3] = c == 3 ? 1.0 : 0.0;
+        }
+        return r;
+    }
+
+    // translate(trs.translation) * rotate(trs.rotation) * scale(trs.scale).
+    Mat64 ref_local(math::TRS const& trs) {
+        f64 const x = trs.rotation.x;
+        f64 const y = trs.rotation.y;
+        f64 const z = trs.rotation.z;
+        f64 const w = trs.rotation.w;
+        f64 const n = std::sqrt(x * x + y * y + z * z + w * w);
+        Quat64 const u{x / n, y / n, z / n, w / n};
+        f64 const rotation[3][3] = {{1 - 2 * (u.y * u.y + u.z * u.z), 2 * (u.x * u.y + u.z * u.w), 2 * (u.x * u.z - u.y * u.w)},
+                                    {2 * (u.x * u.y - u.z * u.w), 1 - 2 * (u.x * u.x + u.z * u.z), 2 * (u.y * u.z + u.x * u.w)},
+                                    {2 * (u.x * u.z + u.y * u.w), 2 * (u.y * u.z - u.x * u.w), 1 - 2 * (u.x * u.x + u.y * u.y)}};
+        f64 const scale[3] = {trs.scale.x, trs.scale.y, trs.scale.z};
+        f64 const translation[3] = {trs.translation.x, trs.translation.y, trs.translation.z};
+        Mat64 r;
+        for(i32 c = 0; c < 3; ++c) {
+            for(i32 j = 0; j < 3; ++j) {
+                r.m[c][j] = rotation[c][j] * scale[c];
+            }
+            r.m[c][3] = 0.0;
+            r.m[3][c] = translation[c];
+        }
+        r.m[3][3] = 1.0;
+        return r;
+    }
+
+    // Unit rotation, scale in [0.8, 1.25] and translation in [-1, 1], which keep the
+    // world transformations within a few units at the depths of the hierarchies.
+    void random_local(Random& random, math::TRS& trs) {
+        trs.rotation = random_quat(random);
+        trs.translation = {static_cast<f32>(random.uniform(-1.0, 1.0)), static_cast<f32>(random.uniform(-1.0, 1.0)),
+                           static_cast<f32>(random.uniform(-1.0, 1.0))};
+        trs.scale = {static_cast<f32>(random.uniform(0.8, 1.25)), static_cast<f32>(random.uniform(0.8, 1.25)), static_cast<f32>(random.uniform(0.8, 1.25))};
+    }
+
+    void random_local(Random& random, math::Affine3& m) {
+        math::TRS trs;
+        random_local(random, trs);
+        m = math::compose_affine(trs);
+    }
+
+    void random_local(Random& random, math::Mat4& m) {
+        math::TRS trs;
+        random_local(random, trs);
+        m = math::compose(trs);
+    }
+
+    // The parents of a random forest of count nodes in random order. Most nodes hang
+    // off a uniformly chosen earlier node, which makes wide levels, the rest off one of
+    // the few latest nodes, which makes deep chains. order receives the nodes in an
+    // order in which every parent precedes its children.
+    void random_hierarchy(Random& random, i64 const count, i64* const parents, i64* const order) {
+        for(i64 i = 0; i < count; ++i) {
+            order[i] = i;
+        }
+        for(i64 i = count - 1; i > 0; --i) {
+            i64 const j = static_cast<i64>(random.uniform(0.0, static_cast<f64>(i) + 0.999));
+            i64 const t = order[i];
+            order[i] = order[j];
+            order[j] = t;
+        }
+        for(i64 i = 0; i < count; ++i) {
+            i64 const node = order[i];
+            if(i < 4 || random.uniform(0.0, 1.0) < 0.01) {
+                parents[node] = -1;
+            } else if(random.uniform(0.0, 1.0) < 0.9) {
+                parents[node] = order[static_cast<i64>(random.uniform(0.0, static_cast<f64>(i) - 0.001))];
+            } else {
+                i64 const back = static_cast<i64>(random.uniform(1.0, 4.999));
+                parents[node] = order[i - (back < i ? back : i)];
+            }
+        }
+    }
+
+    // compute_world_transforms and update_world_transforms against the product of the
+    // world transformation of the parent and the local transformation evaluated in
+    // f64 node by node. The update changes the local transformations of some nodes and
+    // marks them dirty and changes the local transformations of other nodes without
+    // marking them. The nodes that are dirty or have a dirty ancestor must match the
+    // reference and be marked, all other nodes must keep their world transformations
+    // and stay unmarked.
+    template<typename Local>
+    void run_hierarchy_case(char const* const local_name, math::Instruction_Set const instruction_set) {
+        std::string const suffix = std::string("(") + local_name + ")[" + math::get_instruction_set_name(instruction_set) + "]";
+        std::string const compute_name = "hierarchy.compute_world_transforms" + suffix;
+        std::string const update_name = "hierarchy.update_world_transforms" + suffix;
+        bool const run_compute = is_selected(compute_name.c_str());
+        bool const run_update = is_selected(update_name.c_str());
+        if(!run_compute && !run_update) {
+            return;
+        }
+
+        // The error grows with the depth of the nodes, which reaches about 25.
+        char const* const domain = "random forests of 4096 nodes, scale in [0.8, 1.25], translation in [-1, 1]";
+        Result* const r_compute = run_compute ? &begin_case(compute_name, domain, {Metric::relative, 1e-5}) : nullptr;
+        Result* const r_update = run_update ? &begin_case(update_name, domain, {Metric::relative, 1e-5}) : nullptr;
+        constexpr i64 count = 4096;
+        std::vector<i64> parents(count);
+        std::vector<i64> order(count);
+        std::vector<Local> locals(count);
+        std::vector<math::Mat4> worlds(count);
+        std::vector<math::Mat4> previous_worlds(count);
+        std::vector<u8> dirty(count);
+        std::vector<u8> affected(count);
+        std::vector<Mat64> reference(count);
+        Random random{10};
+        i64 const samples = get_random_samples() / 4;
+        for(i64 done = 0; done < samples; done += count) {
+            random_hierarchy(random, count, parents.data(), order.data());
+            math::Hierarchy const hierarchy(parents.data(), count);
+            for(Local& local: locals) {
+                random_local(random, local);
+            }
+
+            math::compute_world_transforms(hierarchy, locals.data(), worlds.data());
+            if(r_compute != nullptr) {
+                for(i64 const node: order) {
+                    i64 const parent = parents[node];
+                    reference[node] = parent < 0 ? ref_local(locals[node]) : ref_multiply(reference[parent], ref_local(locals[node]));
+                    record_vector(*r_compute, worlds[node].data(), &reference[node].m[0][0], 16, static_cast<f32>(node));
+                }
+            }
+
+            if(r_update == nullptr) {
+                continue;
+            }
+
+            previous_worlds = worlds;
+            for(i64 i = 0; i < count; ++i) {
+                f64 const u = random.uniform(0.0, 1.0);
+                dirty[i] = u < 0.05;
+                if(u < 0.1) {
+                    random_local(random, locals[i]);
+                }
+            }
+            for(i64 const node: order) {
+                i64 const parent = parents[node];
+                affected[node] = dirty[node] || (parent >= 0 && affected[parent]);
+            }
+
+            math::update_world_transforms(hierarchy, locals.data(), dirty.data(), worlds.data());
+            for(i64 const node: order) {
+                i64 const parent = parents[node];
+                if(affected[node]) {
+                    Mat64 const parent_world = parent < 0 ? Mat64{} : (affected[parent] ? reference[parent] : ref_local(previous_worlds[parent]));
+                    reference[node] = parent < 0 ? ref_local(locals[node]) : ref_multiply(parent_world, ref_local(locals[node]));
+                } else {
+                    reference[node] = ref_local(previous_worlds[node]);
+                }
+                record_vector(*r_update, worlds[node].data(), &reference[node].m[0][0], 16, static_cast<f32>(node), static_cast<f32>(affected[node]));
+                if((dirty[node] != 0) != (affected[node] != 0)) {
+                    record_error(*r_update, HUGE_VAL, HUGE_VAL, HUGE_VAL, static_cast<f32>(node), static_cast<f32>(affected[node]));
+                }
+            }
+        }
+    }
+
+    void run_hierarchy_cases() {
+        math::Instruction_Set const previous = math::get_instruction_set();
+        for(u8 i = 0; i <= static_cast<u8>(math::Instruction_Set::avx512); ++i) {
+            math::Instruction_Set const instruction_set = static_cast<math::Instruction_Set>(i);
+            if(!math::is_instruction_set_supported(instruction_set)) {
+                continue;
+            }
+
+            math::set_instruction_set(instruction_set);
+            run_hierarchy_case<math::TRS>("TRS", instruction_set);
+            run_hierarchy_case<math::Affine3>("Affine3", instruction_set);
+            run_hierarchy_case<math::Mat4>("Mat4", instruction_set);
+        }
+        math::set_instruction_set(previous);
+    }
+
+    // The array slerp of unit quaternions and unit vectors for every method and
+    // instruction set. The quaternions are interpolated along the shorter path and the
+    // vectors are at most 90 degrees apart, the domain of the bound of nlerp_corrected.
+    void run_blend_cases() {
+        struct Method_Case {
+            char const* name;
+            math::Slerp_Method method;
+            f64 budget;
+        };
+
+        Method_Case const methods[] = {
+            {"exact", math::Slerp_Method::exact, 1e-6},
+            {"nlerp", math::Slerp_Method::nlerp, 0.08},
+            // 3e-5 radians plus the rounding errors.
+            {"nlerp_corrected", math::Slerp_Method::nlerp_corrected, 3.5e-5},
+        };
+
+        constexpr i64 block = 1 << 12;
+        math::Quat_Array qa(block);
+        math::Quat_Array qb(block);
+        math::Quat_Array qr(block);
+        math::Vec3_Array va(block);
+        math::Vec3_Array vb(block);
+        math::Vec3_Array vr(block);
+        i64 const samples = get_random_samples() / 4;
+        math::Instruction_Set const previous = math::get_instruction_set();
+        for(u8 i = 0; i <= static_cast<u8>(math::Instruction_Set::avx512); ++i) {
+            math::Instruction_Set const instruction_set = static_cast<math::Instruction_Set>(i);
+            if(!math::is_instruction_set_supported(instruction_set)) {
+                continue;
+            }
+
+            math::set_instruction_set(instruction_set);
+            std::string const suffix = std::string("[") + math::get_instruction_set_name(instruction_set) + "]";
+            for(Method_Case const& m: methods) {
+                std::string const quat_name = std::string("array.slerp(Quat).") + m.name + suffix;
+                std::string const vec3_name = std::string("array.slerp(Vec3).") + m.name + suffix;
+                bool const run_quat = is_selected(quat_name.c_str());
+                bool const run_vec3 = is_selected(vec3_name.c_str());
+                if(!run_quat && !run_vec3) {
+                    continue;
+                }
+
+                Result* const r_quat = run_quat ? &begin_case(quat_name, "unit quaternions, t in [0, 1]", {Metric::absolute, m.budget}) : nullptr;
+                Result* const r_vec3 =
+                    run_vec3 ? &begin_case(vec3_name, "unit vectors at most 90 degrees apart, t in [0, 1]", {Metric::absolute, m.budget}) : nullptr;
+                Random random{8};
+                for(i64 done = 0; done < samples; done += block) {
+                    for(i64 j = 0; j < block; ++j) {
+                        qa.set(j, random_quat(random));
+                        qb.set(j, random_quat(random));
+                        math::Vec3 const a = random_unit_vec3(random);
+                        math::Vec3 b = random_unit_vec3(random);
+                        if(math::dot(a, b) < 0.0f) {
+                            b = -b;
+                        }
+                        va.set(j, a);
+                        vb.set(j, b);
+                    }
+
+                    f32 const t = static_cast<f32>(random.uniform(0.0, 1.0));
+                    if(r_quat != nullptr) {
+                        math::slerp(qa, qb, t, m.method, qr);
+                        for(i64 j = 0; j < block; ++j) {
+                            math::Quat const a = qa.get(j);
+                            math::Quat const b = qb.get(j);
+                            f64 const pa[4] = {a.x, a.y, a.z, a.w};
+                            f64 pb[4] = {b.x, b.y, b.z, b.w};
+                            if(pa[0] * pb[0] + pa[1] * pb[1] + pa[2] * pb[2] + pa[3] * pb[3] < 0.0) {
+                                for(f64& c: pb) {
+                                    c = -c;
+                                }
+                            }
+                            f64 reference[4];
+                            ref_slerp(pa, pb, 4, t, reference);
+                            math::Quat const result = qr.get(j);
+                            record_vector(*r_quat, &result.x, reference, 4, t);
+                        }
+                    }
+
+                    if(r_vec3 != nullptr) {
+                        math::slerp(va, vb, t, m.method, vr);
+                        for(i64 j = 0; j < block; ++j) {
+                            math::Vec3 const a = va.get(j);
+                            math::Vec3 const b = vb.get(j);
+                            f64 const pa[3] = {a.x, a.y, a.z};
+                            f64 const pb[3] = {b.x, b.y, b.z};
+                            f64 reference[3];
+                            ref_slerp(pa, pb, 3, t, reference);
+                            math::Vec3 const result = vr.get(j);
+                            record_vector(*r_vec3, &result.x, reference, 3, t);
+                        }
+                    }
+                }
+            }
+        }
+        math::set_instruction_set(previous);
+    }
+
+    //
+    // Tracks
+    //
+
+    // The index of the last key whose time is at most time or -1 if there is none,
+    // found with a linear search.
+    i64 find_key(std::vector<f32> const& times, f32 const time) {
+        i64 k = -1;
+        for(i64 i = 0; i < static_cast<i64>(times.size()) && times[i] <= time; ++i) {
+            k = i;
+        }
+        return k;
+    }
+
+    // The keys surrounding time and the interpolation parameter between them like
+    // sample, with the parameter in f64.
+    struct Ref_Segment {
+        i64 key0;
+        i64 key1;
+        f64 t;
+    };
+
+    Ref_Segment ref_locate(std::vector<f32> const& times, f32 const time) {
+        i64 const k = find_key(times, time);
+        i64 const last = static_cast<i64>(times.size()) - 1;
+        if(k < 0) {
+            return {0, 0, 0.0};
+        } else if(k == last) {
+            return {k, k, 0.0};
+        } else {
+            return {k, k + 1, (static_cast<f64>(time) - times[k]) / (static_cast<f64>(times[k + 1]) - times[k])};
+        }
+    }
+
+    struct Random_Track {
+        std::vector<f32> times;
+        math::Quat_Track rotations;
+        math::Vec3_Track vectors;
+    };
+
+    // A track of up to 40 keys, a fifth of them empty or with a single key, starting in
+    // [-1, 1] with the keys 0.05 to 0.5 apart. The rotations are random unit
+    // quaternions and the vectors lie in [-10, 10].
+    Random_Track random_track(Random& random) {
+        f64 const u = random.uniform(0.0, 1.0);
+        i64 const size = u < 0.1 ? 0 : (u < 0.2 ? 1 : static_cast<i64>(random.uniform(2.0, 40.999)));
+        std::vector<f32> times(size);
+        std::vector<math::Quat> rotations(size);
+        std::vector<math::Vec3> vectors(size);
+        f32 time = static_cast<f32>(random.uniform(-1.0, 1.0));
+        for(i64 i = 0; i < size; ++i) {
+            times[i] = time;
+            time += static_cast<f32>(random.uniform(0.05, 0.5));
+            rotations[i] = random_quat(random);
+            vectors[i] = random_unit_vec3(random) * static_cast<f32>(random.uniform(0.0, 10.0));
+        }
+        return {times, math::Quat_Track(times.data(), rotations.data(), size), math::Vec3_Track(times.data(), vectors.data(), size)};
+    }
+
+    // The next time of a playback within [-3, 23], which covers the times before the
+    // first and after the last key of the tracks. Mostly moves forward by less than a
+    // few keys, the path of the cursor, but also skips many keys, seeks backward and
+    // jumps to random times.
+    f32 next_time(Random& random, f32 const time) {
+        f64 const u = random.uniform(0.0, 1.0);
+        f64 next = time;
+        if(u < 0.6) {
+            next += random.uniform(0.0, 0.5);
+        } else if(u < 0.75) {
+            next += random.uniform(2.0, 10.0);
+        } else if(u < 0.9) {
+            next -= random.uniform(0.0, 10.0);
+        } else {
+            next = random.uniform(-3.0, 23.0);
+        }
+        return static_cast<f32>(next < -3.0 || next > 23.0 ? random.uniform(-3.0, 23.0) : next);
+    }
+
+    // A cursor that a previous sample could have left, possibly out of the range of the
+    // keys of a track of size keys.
+    i64 random_cursor(Random& random, i64 const size) {
+        return random.uniform(0.0, 1.0) < 0.5 ? 0 : static_cast<i64>(random.uniform(-3.0, static_cast<f64>(size) + 3.0));
+    }
+
+    void record_track_sample(Result& r, Random_Track const& track, f32 const time, math::Quat const& result) {
+        Ref_Segment const s = ref_locate(track.times, time);
+        f64 reference[4] = {0.0, 0.0, 0.0, 1.0};
+        if(track.rotations.size() > 0) {
+            math::Quat const a = track.rotations.get_keys()[s.key0];
+            math::Quat const b = track.rotations.get_keys()[s.key1];
+            f64 const pa[4] = {a.x, a.y, a.z, a.w};
+            f64 pb[4] = {b.x, b.y, b.z, b.w};
+            if(pa[0] * pb[0] + pa[1] * pb[1] + pa[2] * pb[2] + pa[3] * pb[3] < 0.0) {
+                for(f64& c: pb) {
+                    c = -c;
+                }
+            }
+            ref_slerp(pa, pb, 4, s.t, reference);
+        }
+        record_vector(r, &result.x, reference, 4, time, static_cast<f32>(track.times.size()));
+    }
+
+    void record_track_sample(Result& r, Random_Track const& track, f32 const time, math::Vec3 const& result) {
+        Ref_Segment const s = ref_locate(track.times, time);
+        f64 reference[3] = {0.0, 0.0, 0.0};
+        if(track.vectors.size() > 0) {
+            math::Vec3 const a = track.vectors.get_keys()[s.key0];
+            math::Vec3 const b = track.vectors.get_keys()[s.key1];
+            reference[0] = (1.0 - s.t) * a.x + s.t * b.x;
+            reference[1] = (1.0 - s.t) * a.y + s.t * b.y;
+            reference[2] = (1.0 - s.t) * a.z + s.t * b.z;
+        }
+        record_vector(r, &result.x, reference, 3, time, static_cast<f32>(track.times.size()));
+    }
+
+    // A cursor must be left at the last key whose time is at most time, or at 0 before
+    // the first key and for empty tracks.
+    void record_cursor(Result& r, Random_Track const& track, f32 const time, i64 const cursor) {
+        i64 const k = find_key(track.times, time);
+        if(cursor != (k < 0 ? 0 : k)) {
+            record_error(r, HUGE_VAL, HUGE_VAL, HUGE_VAL, time, static_cast<f32>(cursor));
+        }
+    }
+
+    // sample of single tracks and of arrays of tracks against the interpolation of the
+    // keys found by a linear search. Every instance starts from a random cursor and
+    // follows a playback of forward steps, skips, backward seeks and jumps before and
+    // after the keys. The cursors must end up where the linear search finds the keys.
+    void run_track_cases() {
+        std::string const quat_name = "track.sample(Quat_Track)";
+        std::string const vec3_name = "track.sample(Vec3_Track)";
+        bool const run_quat = is_selected(quat_name.c_str());
+        bool const run_vec3 = is_selected(vec3_name.c_str());
+        i64 const samples = get_random_samples() / 4;
+        constexpr i64 steps = 64;
+        if(run_quat || run_vec3) {
+            char const* const domain = "random tracks of 0 to 40 keys, time in [-3, 23]";
+            // math::slerp falls back to an unnormalized lerp when the cosine of the angle
+            // exceeds 0.9999, which is off the sphere by up to 2.5e-5.
+            Result* const r_quat = run_quat ? &begin_case(quat_name, domain, {Metric::absolute, 3e-5}) : nullptr;
+            Result* const r_vec3 = run_vec3 ? &begin_case(vec3_name, domain, {Metric::absolute, 4e-6}) : nullptr;
+            Random random{11};
+            for(i64 done = 0; done < samples; done += steps) {
+                Random_Track const track = random_track(random);
+                i64 quat_cursor = random_cursor(random, track.rotations.size());
+                i64 vec3_cursor = quat_cursor;
+                f32 time = static_cast<f32>(random.uniform(-3.0, 23.0));
+                for(i64 i = 0; i < steps; ++i) {
+                    time = next_time(random, time);
+                    if(r_quat != nullptr) {
+                        math::Quat const result = math::sample(track.rotations, time, quat_cursor);
+                        record_track_sample(*r_quat, track, time, result);
+                        record_cursor(*r_quat, track, time, quat_cursor);
+                    }
+                    if(r_vec3 != nullptr) {
+                        math::Vec3 const result = math::sample(track.vectors, time, vec3_cursor);
+                        record_track_sample(*r_vec3, track, time, result);
+                        record_cursor(*r_vec3, track, time, vec3_cursor);
+                    }
+                }
+            }
+        }
+
+        constexpr i64 track_count = 1024;
+        std::vector<Random_Track> tracks;
+        std::vector<math::Quat_Track> quat_tracks;
+        std::vector<math::Vec3_Track> vec3_tracks;
+        std::vector<i64> quat_cursors(track_count);
+        std::vector<i64> vec3_cursors(track_count);
+        math::Quat_Array quats(track_count);
+        math::Vec3_Array vec3s(track_count);
+        math::Instruction_Set const previous = math::get_instruction_set();
+        for(u8 i = 0; i <= static_cast<u8>(math::Instruction_Set::avx512); ++i) {
+            math::Instruction_Set const instruction_set = static_cast<math::Instruction_Set>(i);
+            if(!math::is_instruction_set_supported(instruction_set)) {
+                continue;
+            }
+
+            math::set_instruction_set(instruction_set);
+            std::string const suffix = std::string("[") + math::get_instruction_set_name(instruction_set) + "]";
+            std::string const quat_array_name = "track.sample(Quat_Track[])" + suffix;
+            std::string const vec3_array_name = "track.sample(Vec3_Track[])" + suffix;
+            bool const run_quat_array = is_selected(quat_array_name.c_str());
+            bool const run_vec3_array = is_selected(vec3_array_name.c_str());
+            if(!run_quat_array && !run_vec3_array) {
+                continue;
+            }
+
+            char const* const domain = "1024 random tracks of 0 to 40 keys, time in [-3, 23], Slerp_Method::exact";
+            Result* const r_quat = run_quat_array ? &begin_case(quat_array_name, domain, {Metric::absolute, 1e-6}) : nullptr;
+            Result* const r_vec3 = run_vec3_array ? &begin_case(vec3_array_name, domain, {Metric::absolute, 4e-6}) : nullptr;
+            Random random{12};
+            tracks.clear();
+            quat_tracks.clear();
+            vec3_tracks.clear();
+            for(i64 j = 0; j < track_count; ++j) {
+                tracks.push_back(random_track(random));
+                quat_tracks.push_back(tracks.back().rotations);
+                vec3_tracks.push_back(tracks.back().vectors);
+                quat_cursors[j] = random_cursor(random, quat_tracks.back().size());
+                vec3_cursors[j] = quat_cursors[j];
+            }
+
+            f32 time = static_cast<f32>(random.uniform(-3.0, 23.0));
+            for(i64 done = 0; done < samples; done += track_count) {
+                time = next_time(random, time);
+                if(r_quat != nullptr) {
+                    math::sample(quat_tracks.data(), track_count, time, math::Slerp_Method::exact, quat_cursors.data(), quats);
+                    for(i64 j = 0; j < track_count; ++j) {
+                        record_track_sample(*r_quat, tracks[j], time, quats.get(j));
+                        record_cursor(*r_quat, tracks[j], time, quat_cursors[j]);
+                    }
+                }
+                if(r_vec3 != nullptr) {
+                    math::sample(vec3_tracks.data(), track_count, time, vec3_cursors.data(), vec3s);
+                    for(i64 j = 0; j < track_count; ++j) {
+                        record_track_sample(*r_vec3, tracks[j], time, vec3s.get(j));
+                        record_cursor(*r_vec3, tracks[j], time, vec3_cursors[j]);
+                    }
+                }
+            }
+        }
+        math::set_instruction_set(previous);
+    }
+
+    // ref_rotate
+    // Rotates v by the unit quaternion q. v' = v + w * t + cross(q.xyz, t) where
+    // t = 2 * cross(q.xyz, v).
+    //
+    void ref_rotate(f64 const* const q, f64 const* const v, f64* const out) {
+        f64 const t[3] = {2.0 * (q[1] * v[2] - q[2] * v[1]), 2.0 * (q[2] * v[0] - q[0] * v[2]), 2.0 * (q[0] * v[1] - q[1] * v[0])};
+        out[0] = v[0] + q[3] * t[0] + (q[1] * t[2] - q[2] * t[1]);
+        out[1] = v[1] + q[3] * t[1] + (q[2] * t[0] - q[0] * t[2]);
+        out[2] = v[2] + q[3] * t[2] + (q[0] * t[1] - q[1] * t[0]);
+    }
+
+    void run_skin_cases() {
+        constexpr i64 bone_count = 64;
+        constexpr i64 block = 1 << 12;
+        std::vector<math::Dual_Quat> palette(bone_count);
+        std::vector<u16> bones(4 * block);
+        std::vector<f32> weights(4 * block);
+        std::vector<math::Vec3> positions(block);
+        std::vector<math::Vec3> normals(block);
+        std::vector<math::Vec3> out_positions(block);
+        std::vector<math::Vec3> out_normals(block);
+        i64 const samples = get_random_samples() / 4;
+        math::Instruction_Set const previous = math::get_instruction_set();
+        for(u8 i = 0; i <= static_cast<u8>(math::Instruction_Set::avx512); ++i) {
+            math::Instruction_Set const instruction_set = static_cast<math::Instruction_Set>(i);
+            if(!math::is_instruction_set_supported(instruction_set)) {
+                continue;
+            }
+
+            math::set_instruction_set(instruction_set);
+            std::string const suffix = std::string("[") + math::get_instruction_set_name(instruction_set) + "]";
+            std::string const position_name = "array.skin(position)" + suffix;
+            std::string const normal_name = "array.skin(normal)" + suffix;
+            bool const run_position = is_selected(position_name.c_str());
+            bool const run_normal = is_selected(normal_name.c_str());
+            if(!run_position && !run_normal) {
+                continue;
+            }
+
+            // The rounding errors of the blend, the normalization and the transformation
+            // of positions whose skinned magnitude is up to 2.
+            char const* const domain = "4 influences of 64 random rigid bones, |translation| <= 1, |position| <= 1";
+            Result* const r_position = run_position ? &begin_case(position_name, domain, {Metric::absolute, 2e-6}) : nullptr;
+            Result* const r_normal = run_normal ? &begin_case(normal_name, domain, {Metric::absolute, 2e-6}) : nullptr;
+            Random random{9};
+            for(i64 done = 0; done < samples; done += block) {
+                for(math::Dual_Quat& q: palette) {
+                    math::Vec3 const t = random_unit_vec3(random) * static_cast<f32>(random.uniform(0.0, 1.0));
+                    q = math::Dual_Quat::from_rotation_translation(random_quat(random), t);
+                }
+                for(i64 j = 0; j < block; ++j) {
+                    f32 sum = 0.0f;
+                    for(i64 k = 0; k < 4; ++k) {
+                        bones[4 * j + k] = static_cast<u16>(random.uniform(0.0, bone_count - 1));
+                        weights[4 * j + k] = static_cast<f32>(random.uniform(0.0, 1.0));
+                        sum += weights[4 * j + k];
+                    }
+                    for(i64 k = 0; k < 4; ++k) {
+                        weights[4 * j + k] /= sum;
+                    }
+                    positions[j] = random_unit_vec3(random) * static_cast<f32>(random.uniform(0.0, 1.0));
+                    normals[j] = random_unit_vec3(random);
+                }
+
+                math::skin(palette.data(), bones.data(), weights.data(), positions.data(), normals.data(), out_positions.data(), out_normals.data(), block);
+                for(i64 j = 0; j < block; ++j) {
+                    f64 blend[8] = {};
+                    f32 const* const first = palette[bones[4 * j]].data();
+                    for(i64 k = 0; k < 4; ++k) {
+                        f32 const* const q = palette[bones[4 * j + k]].data();
+                        f64 const d = static_cast<f64>(first[0]) * q[0] + static_cast<f64>(first[1]) * q[1] + static_cast<f64>(first[2]) * q[2] +
+                                      static_cast<f64>(first[3]) * q[3];
+                        f64 const w = d < 0.0 ? -weights[4 * j + k] : weights[4 * j + k];
+                        for(i64 c = 0; c < 8; ++c) {
+                            blend[c] += w * q[c];
+                        }
+                    }
+                    f64 const length = std::sqrt(blend[0] * blend[0] + blend[1] * blend[1] + blend[2] * blend[2] + blend[3] * blend[3]);
+                    for(f64& c: blend) {
+                        c /= length;
+                    }
+                    f64 const* const r = blend;
+                    f64 const* const d = blend + 4;
+                    f64 const t[3] = {2.0 * (r[3] * d[0] - d[3] * r[0] + r[1] * d[2] - r[2] * d[1]),
+                                      2.0 * (r[3] * d[1] - d[3] * r[1] + r[2] * d[0] - r[0] * d[2]),
+                                      2.0 * (r[3] * d[2] - d[3] * r[2] + r[0] * d[1] - r[1] * d[0])};
+                    if(r_position != nullptr) {
+                        f64 const p[3] = {positions[j].x, positions[j].y, positions[j].z};
+                        f64 reference[3];
+                        ref_rotate(r, p, reference);
+                        for(i64 c = 0; c < 3; ++c) {
+                            reference[c] += t[c];
+                        }
+                        record_vector(*r_position, &out_positions[j].x, reference, 3, positions[j].x, weights[4 * j]);
+                    }
+
+                    if(r_normal != nullptr) {
+                        f64 const n[3] = {normals[j].x, normals[j].y, normals[j].z};
+                        f64 reference[3];
+                        ref_rotate(r, n, reference);
+                        record_vector(*r_normal, &out_normals[j].x, reference, 3, normals[j].x, weights[4 * j]);
+                    }
+                }
+            }
+        }
+        math::set_instruction_set(previous);
+    }
+
+    //
+    // Clips
+    //
+
+    // The largest distance between the points at shell from the origin transformed by a
+    // and by b, evaluated in f64 at the 6 axes and the 8 diagonals.
+    f64 get_shell_error(math::TRS const& a, math::TRS const& b, f64 const shell) {
+        constexpr f64 d = 0.57735026918962576;
+        constexpr f64 directions[14][3] = {{1, 0, 0},  {-1, 0, 0}, {0, 1, 0},  {0, -1, 0}, {0, 0, 1},  {0, 0, -1}, {d, d, d},
+                                           {d, d, -d}, {d, -d, d}, {d, -d, -d}, {-d, d, d}, {-d, d, -d}, {-d, -d, d}, {-d, -d, -d}};
+        auto transform = [](math::TRS const& trs, f64 const* const p, f64* const out) {
+            f64 q[4] = {trs.rotation.x, trs.rotation.y, trs.rotation.z, trs.rotation.w};
+            f64 const n = std::sqrt(q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3]);
+            for(f64& c: q) {
+                c /= n;
+            }
+            f64 const scaled[3] = {trs.scale.x * p[0], trs.scale.y * p[1], trs.scale.z * p[2]};
+            ref_rotate(q, scaled, out);
+            out[0] += trs.translation.x;
+            out[1] += trs.translation.y;
+            out[2] += trs.translation.z;
+        };
+
+        f64 error = 0.0;
+        for(auto const& direction: directions) {
+            f64 const p[3] = {shell * direction[0], shell * direction[1], shell * direction[2]};
+            f64 pa[3];
+            f64 pb[3];
+            transform(a, p, pa);
+            transform(b, p, pb);
+            f64 const dx = pa[0] - pb[0];
+            f64 const dy = pa[1] - pb[1];
+            f64 const dz = pa[2] - pb[2];
+            error = std::fmax(error, std::sqrt(dx * dx + dy * dy + dz * dz));
+        }
+        return error;
+    }
+
+    bool is_same_trs(math::TRS const& a, math::TRS const& b) {
+        return std::memcmp(&a, &b, sizeof(math::TRS)) == 0;
+    }
+
+    enum struct Bone_Motion { constant, animated, noisy, scaled };
+
+    // A clip of up to 40 bones and 1 to 80 frames at 30 frames per second. Every bone is
+    // constant, animated by sinusoids, animated with per-frame noise of several times
+    // its budget, or animated including a nonuniform scale. The rotations flip their sign
+    // at random frames.
+    void random_clip(Random& random, i64 const bone_count, i64 const frame_count, std::vector<math::TRS>& frames,
+                     std::vector<math::Bone_Error>& errors) {
+        frames.resize(bone_count * frame_count);
+        errors.resize(bone_count);
+        for(i64 bone = 0; bone < bone_count; ++bone) {
+            f64 const u = random.uniform(0.0, 1.0);
+            Bone_Motion const motion = u < 0.25 ? Bone_Motion::constant : (u < 0.6 ? Bone_Motion::animated : (u < 0.8 ? Bone_Motion::noisy : Bone_Motion::scaled));
+            f32 const max_error = static_cast<f32>(std::exp2(random.uniform(-14.0, -6.0)));
+            f32 const shell = static_cast<f32>(random.uniform(0.1, 2.0));
+            errors[bone] = {max_error, shell};
+            math::Vec3 const axis = random_unit_vec3(random);
+            math::Vec3 const base_translation = random_unit_vec3(random) * static_cast<f32>(random.uniform(0.0, 2.0));
+            math::Vec3 const direction = random_unit_vec3(random);
+            math::Vec3 const base_scale = {static_cast<f32>(random.uniform(0.5, 2.0)), static_cast<f32>(random.uniform(0.5, 2.0)),
+                                           static_cast<f32>(random.uniform(0.5, 2.0))};
+            f64 const base_angle = random.uniform(-pi, pi);
+            f64 const amplitude = random.uniform(0.1, 2.0);
+            f64 const frequency = random.uniform(0.5, 4.0);
+            f64 const phase = random.uniform(0.0, 2.0 * pi);
+            for(i64 f = 0; f < frame_count; ++f) {
+                f64 const wave = motion == Bone_Motion::constant ? 0.0 : std::sin(frequency * static_cast<f64>(f) / 30.0 + phase);
+                f64 const angle = base_angle + amplitude * wave;
+                math::Vec3 const noise =
+                    motion == Bone_Motion::noisy ? random_unit_vec3(random) * static_cast<f32>(random.uniform(0.0, 8.0 * max_error)) : math::Vec3{0.0f};
+                math::TRS& trs = frames[f * bone_count + bone];
+                trs.rotation = math::Quat::from_axis_angle(axis, static_cast<f32>(angle));
+                if(random.uniform(0.0, 1.0) < 0.1) {
+                    trs.rotation = -trs.rotation;
+                }
+                trs.translation = base_translation + direction * static_cast<f32>(amplitude * wave) + noise;
+                trs.scale = math::Vec3{1.0f};
+                if(motion == Bone_Motion::scaled) {
+                    trs.scale = base_scale * (1.0f + 0.3f * static_cast<f32>(wave));
+                }
+            }
+        }
+    }
+
+    // compress_clip against the error budgets of the bones at every frame of random
+    // clips, the rejection of invalid sample rates, the loading of the data of a clip
+    // and the clamping of the times to the
+    // duration of the clip.
+    void run_clip_cases() {
+        bool const run_compress = is_selected("clip.compress_clip");
+        bool const run_layout = is_selected("clip.round_trip");
+        bool const run_clamp = is_selected("clip.sample(time clamping)");
+        if(!run_compress && !run_layout && !run_clamp) {
+            return;
+        }
+
+        char const* const domain = "random clips of 1 to 40 bones and 1 to 80 frames, max_error in [2^-14, 2^-6]";
+        // The error relative to max_error of the bone.
+        Result* const r_compress = run_compress ? &begin_case("clip.compress_clip", domain, {Metric::relative, 1.0}) : nullptr;
+        // The clips must sample identically, the differences are absolute.
+        Result* const r_layout = run_layout ? &begin_case("clip.round_trip", domain, {Metric::absolute, 0.0}) : nullptr;
+        Result* const r_clamp = run_clamp ? &begin_case("clip.sample(time clamping)", domain, {Metric::absolute, 0.0}) : nullptr;
+        std::vector<math::TRS> frames;
+        std::vector<math::Bone_Error> errors;
+        std::vector<math::TRS> samples;
+        std::vector<math::TRS> other_samples;
+        Random random{13};
+        i64 const clip_count = options.exhaustive ? 4096 : 64;
+        for(i64 i = 0; i < clip_count; ++i) {
+            i64 const bone_count = static_cast<i64>(random.uniform(1.0, 40.999));
+            i64 const frame_count = static_cast<i64>(random.uniform(1.0, 80.999));
+            random_clip(random, bone_count, frame_count, frames, errors);
+            math::Compressed_Clip const clip = math::compress_clip(frames.data(), bone_count, frame_count, 30.0f, errors.data());
+            samples.resize(bone_count);
+            other_samples.resize(bone_count);
+
+            if(r_compress != nullptr) {
+                for(i64 f = 0; f < frame_count; ++f) {
+                    f32 const time = static_cast<f32>(f) / 30.0f;
+                    math::sample(clip, time, samples.data());
+                    for(i64 bone = 0; bone < bone_count; ++bone) {
+                        f64 const error = get_shell_error(frames[f * bone_count + bone], samples[bone], errors[bone].shell_distance);
+                        record_error(*r_compress, 0.0, error, error / errors[bone].max_error, time, static_cast<f32>(bone));
+                    }
+                }
+            }
+
+            // A clip loaded from the data of another and the copies of a clip sample
+            // identically to the original.
+            if(r_layout != nullptr) {
+                math::Compressed_Clip const loaded(clip.get_data(), clip.size());
+                math::Compressed_Clip copy;
+                copy = loaded;
+                bool const same_header = loaded.get_bone_count() == bone_count && loaded.get_frame_count() == frame_count &&
+                                         loaded.get_sample_rate() == 30.0f && loaded.get_duration() == clip.get_duration() && copy.size() == clip.size();
+                record_error(*r_layout, 0.0, same_header ? 0.0 : HUGE_VAL, 0.0, static_cast<f32>(bone_count), static_cast<f32>(frame_count));
+                for(i64 f = 0; f < frame_count; ++f) {
+                    f32 const time = static_cast<f32>(f) / 30.0f;
+                    math::sample(clip, time, samples.data());
+                    math::sample(copy, time, other_samples.data());
+                    for(i64 bone = 0; bone < bone_count; ++bone) {
+                        bool const same = is_same_trs(samples[bone], other_samples[bone]);
+                        record_error(*r_layout, 0.0, same ? 0.0 : HUGE_VAL, 0.0, time, static_cast<f32>(bone));
+                    }
+                }
+
+                // A sample rate that is not positive gives an empty clip.
+                f32 const invalid_rates[] = {0.0f, -30.0f, std::nanf("")};
+                f32 const invalid_rate = invalid_rates[i % 3];
+                math::Compressed_Clip const empty = math::compress_clip(frames.data(), bone_count, frame_count, invalid_rate, errors.data());
+                bool const is_empty = empty.size() == 0 && empty.get_bone_count() == 0 && empty.get_duration() == 0.0f;
+                record_error(*r_layout, 0.0, is_empty ? 0.0 : HUGE_VAL, 0.0, invalid_rate, static_cast<f32>(frame_count));
+            }
+
+            // The times before the clip and nan sample the first frame, the times after
+            // the clip sample the last frame. duration * sample_rate rounds to either side
+            // of the last frame, hence the last frame is sampled past the duration.
+            if(r_clamp != nullptr) {
+                f32 const duration = clip.get_duration();
+                struct Clamped_Time {
+                    f32 time;
+                    f32 clamped;
+                };
+                Clamped_Time const times[] = {{-1.0f, 0.0f},
+                                              {-HUGE_VALF, 0.0f},
+                                              {std::nanf(""), 0.0f},
+                                              {duration + 0.5f, duration + 1.0f},
+                                              {HUGE_VALF, duration + 1.0f},
+                                              {1e30f, duration + 1.0f}};
+                for(Clamped_Time const& t: times) {
+                    math::sample(clip, t.clamped, samples.data());
+                    math::sample(clip, t.time, other_samples.data());
+                    for(i64 bone = 0; bone < bone_count; ++bone) {
+                        bool const same = is_same_trs(samples[bone], other_samples[bone]);
+                        record_error(*r_clamp, 0.0, same ? 0.0 : HUGE_VAL, 0.0, t.time, static_cast<f32>(bone));
+                    }
+                }
+            }
+        }
+    }
+
+    //
+    // Output
+    //
+
+    bool passes(Result const& r) {
+        return r.worst_error <= r.budget.value;
+    }
+
+    void write_json_string(FILE* const file, std::string const& string) {
+        std::fputc('"', file);
+        for(char const c: string) {
+            if(c == '"' || c == '\\') {
+                std::fputc('\\', file);
+            }
+            std::fputc(c, file);
+        }
+        std::fputc('"', file);
+    }
+
+    // JSON has no representation of infinity, use null instead.
+    void write_json_number(FILE* const file, f64 const v) {
+        if(std::isfinite(v)) {
+            std::fprintf(file, "%.9g", v);
+        } else {
+            std::fputs("null", file);
+        }
+    }
+
+    bool write_json(char const* const path, bool const all_passed) {
+        FILE* const file = std::fopen(path, "w");
+        if(file == nullptr) {
+            std::fprintf(stderr, "error: could not open %s for writing\n", path);
+            return false;
+        }
+
+        std::fprintf(file, "{\n  \"exhaustive\": %s,\n  \"inline\": %s,\n  \"simd\": %s,\n  \"pass\": %s,\n  \"results\": [", options.exhaustive ? "true" : "false",
+                     ANTON_MATH_INLINE ? "true" : "false", ANTON_MATH_SIMD ? "true" : "false", all_passed ? "true" : "false");
+        for(std::size_t i = 0; i < results.size(); ++i) {
+            Result const& r = results[i];
+            std::fputs(i == 0 ? "\n    {\"name\": " : ",\n    {\"name\": ", file);
+            write_json_string(file, r.name);
+            std::fputs(", \"domain\": ", file);
+            write_json_string(file, r.domain);
+            std::fprintf(file, ", \"samples\": %lld, \"max_ulp\": ", static_cast<long long>(r.samples));
+            write_json_number(file, r.max_ulp);
+            std::fputs(", \"mean_ulp\": ", file);
+            write_json_number(file, r.samples > 0 ? r.sum_ulp / static_cast<f64>(r.samples) : 0.0);
+            std::fputs(", \"max_abs\": ", file);
+            write_json_number(file, r.max_abs);
+            std::fputs(", \"max_rel\": ", file);
+            write_json_number(file, r.max_rel);
+            std::fprintf(file, ", \"worst_input\": [%.9g, %.9g], \"budget\": {\"metric\": \"%s\", \"value\": ", r.worst[0], r.worst[1],
+                         get_metric_name(r.budget.metric));
+            write_json_number(file, r.budget.value);
+            std::fprintf(file, "}, \"pass\": %s}", passes(r) ? "true" : "false");
+        }
+        std::fputs("\n  ]\n}\n", file);
+        std::fclose(file);
+        return true;
+    }
+} // namespace
+
+int main(int argc, char** argv) {
+    for(int i = 1; i < argc; ++i) {
+        if(std::strcmp(argv[i], "--exhaustive") == 0) {
+            options.exhaustive = true;
+        } else if(std::strcmp(argv[i], "--filter") == 0 && i + 1 < argc) {
+            options.filter = argv[++i];
+        } else if(std::strcmp(argv[i], "--json") == 0 && i + 1 < argc) {
+            options.json = argv[++i];
+        } else {
+            std::fprintf(stderr, "usage: %s [--exhaustive] [--filter <substring>] [--json <path>]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    run_scalar_cases();
+    run_array_cases();
+    run_vector_cases();
+    run_hierarchy_cases();
+    run_blend_cases();
+    run_track_cases();
+    run_clip_cases();
+    run_skin_cases();
+
+    bool all_passed = true;
+    std::printf("%-48s %12s %12s %12s %12s %-8s %10s  %s\n", "name", "max ulp", "mean ulp", "max abs", "max rel", "metric", "budget", "result");
+    for(Result const& r: results) {
+        bool const passed = passes(r);
+        all_passed = all_passed && passed;
+        f64 const mean = r.samples > 0 ? r.sum_ulp / static_cast<f64>(r.samples) : 0.0;
+        std::printf("%-48s %12.4g %12.4g %12.4g %12.4g %-8s %10.3g  %s", r.name.c_str(), r.max_ulp, mean, r.max_abs, r.max_rel,
+                    get_metric_name(r.budget.metric), r.budget.value, passed ? "pass" : "FAIL");
+        if(!passed) {
+            std::printf(" (error %.4g at %.9g, %.9g)", r.worst_error, r.worst[0], r.worst[1]);
+        }
+        std::printf("\n");
+    }
+
+    if(options.json != nullptr && !write_json(options.json, all_passed)) {
+        return 2;
+    }
+
+    return all_passed ? 0 : 1;
+}